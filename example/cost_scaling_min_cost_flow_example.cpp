@@ -0,0 +1,26 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/cost_scaling_min_cost_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+
+#include "../test/min_cost_max_flow_utils.hpp"
+
+
+int main() {
+    boost::SampleGraph::vertex_descriptor s,t;
+    boost::SampleGraph::Graph g;
+    boost::SampleGraph::getSampleGraph(g, s, t);
+
+    boost::push_relabel_max_flow(g, s, t);
+    boost::cost_scaling_min_cost_flow(g);
+
+    int cost = boost::find_flow_cost(g);
+    assert(cost == 29);
+    return 0;
+}
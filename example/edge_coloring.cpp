@@ -11,6 +11,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/edge_coloring.hpp>
 #include <boost/graph/properties.hpp>
+#include <iostream>
 
 /*
   Sample output
@@ -0,0 +1,543 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+//
+#ifndef BOOST_GRAPH_APPROXIMATE_MINIMUM_DEGREE_ORDERING_HPP
+#define BOOST_GRAPH_APPROXIMATE_MINIMUM_DEGREE_ORDERING_HPP
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // The quotient graph of the approximate minimum degree algorithm.
+    // Variables and elements share the index space [0, n); index n is a
+    // root to which the dense variables are attached.  The adjacency
+    // lists live in one array iw: the list of variable i starts at pe[i]
+    // and holds first the elen[i] elements adjacent to i, then the
+    // remaining len[i] - elen[i] variables; the list of element e holds
+    // its len[e] variables.  Eliminated and absorbed nodes point to their
+    // parent with pe[i] == flip(parent).
+    //
+    // nv[i] is the number of variables in supervariable i (0 once i is
+    // absorbed into another supervariable), and the size of element i
+    // after i is eliminated; it is negated while i is in the pivot
+    // element.  elen[i] is -1 for absorbed variables and -2 for
+    // elements.
+    class amd_impl
+    {
+    public:
+      typedef std::ptrdiff_t index_t;
+
+      // adjacency holds the neighbours of each vertex, without self-loops
+      // and duplicates, from first[i] to first[i + 1].
+      amd_impl(index_t n, const std::vector<index_t>& first,
+               const std::vector<index_t>& adjacency, double dense)
+        : n(n), nzmax(first[n] + first[n] / 5 + 2 * n),
+          iw(nzmax), pe(n + 1), len(n + 1), nv(n + 1, 1), next(n + 1, -1),
+          head(n + 1, -1), elen(n + 1, 0), degree(n + 1), w(n + 1, 1),
+          hhead(n + 1, -1), last(n + 1, -1), order(n + 1)
+      {
+        std::copy(adjacency.begin(), adjacency.end(), iw.begin());
+        cnz = first[n];
+        for (index_t i = 0; i < n; ++i) {
+          pe[i] = first[i];
+          len[i] = first[i + 1] - first[i];
+          degree[i] = len[i];
+        }
+        len[n] = 0;
+        nv[n] = 0;
+        degree[n] = 0;
+        elen[n] = -2;
+        pe[n] = -1;
+        w[n] = 0;
+        if (dense < 0)
+          dense_degree = n;
+        else {
+          dense_degree = (std::max)(index_t(16),
+                                    index_t(dense * std::sqrt(double(n))));
+          dense_degree = (std::min)(n - 2, dense_degree);
+        }
+      }
+
+      void do_amd()
+      {
+        index_t mindeg = 0, nel = 0, lemax = 0;
+        mark = clear_marks(0, 0);
+
+        // empty variables are eliminated at once; dense variables are
+        // attached to the root and ordered last
+        for (index_t i = 0; i < n; ++i) {
+          index_t d = degree[i];
+          if (d == 0) {
+            elen[i] = -2;
+            ++nel;
+            pe[i] = -1;
+            w[i] = 0;
+          } else if (d > dense_degree) {
+            nv[i] = 0;
+            elen[i] = -1;
+            ++nel;
+            pe[i] = flip(n);
+            ++nv[n];
+          } else
+            push_degree(i, d);
+        }
+
+        while (nel < n) {
+          // the pivot: a supervariable of minimum approximate degree
+          index_t k = -1;
+          for (; mindeg < n && (k = head[mindeg]) == -1; ++mindeg)
+            ;
+          BOOST_ASSERT(k >= 0);
+          if (next[k] != -1)
+            last[next[k]] = -1;
+          head[mindeg] = next[k];
+          index_t elenk = elen[k], nvk = nv[k];
+          nel += nvk;
+
+          if (elenk > 0 && cnz + mindeg >= nzmax)
+            collect_garbage();
+
+          // the new element k is the union of the variables of k and of
+          // those of the elements adjacent to k, which are absorbed
+          index_t dk = 0;
+          nv[k] = -nvk;
+          index_t p = pe[k];
+          const index_t pk1 = elenk == 0 ? p : cnz;
+          index_t pk2 = pk1;
+          for (index_t k1 = 1; k1 <= elenk + 1; ++k1) {
+            index_t e, pj, ln;
+            if (k1 > elenk) {
+              e = k;
+              pj = p;
+              ln = len[k] - elenk;
+            } else {
+              e = iw[p++];
+              pj = pe[e];
+              ln = len[e];
+            }
+            for (index_t k2 = 1; k2 <= ln; ++k2) {
+              index_t i = iw[pj++], nvi = nv[i];
+              if (nvi <= 0)
+                continue;
+              dk += nvi;
+              nv[i] = -nvi;
+              iw[pk2++] = i;
+              remove_degree(i);
+            }
+            if (e != k) {
+              pe[e] = flip(k);
+              w[e] = 0;
+            }
+          }
+          if (elenk != 0)
+            cnz = pk2;
+          degree[k] = dk;
+          pe[k] = pk1;
+          len[k] = pk2 - pk1;
+          elen[k] = -2;
+
+          // w[e] - mark becomes |Le \ Lk|, the external degree of each
+          // element e adjacent to a variable of Lk
+          mark = clear_marks(mark, lemax);
+          for (index_t pk = pk1; pk < pk2; ++pk) {
+            index_t i = iw[pk], eln = elen[i];
+            if (eln <= 0)
+              continue;
+            index_t nvi = -nv[i], wnvi = mark - nvi;
+            for (p = pe[i]; p <= pe[i] + eln - 1; ++p) {
+              index_t e = iw[p];
+              if (w[e] >= mark)
+                w[e] -= nvi;
+              else if (w[e] != 0)
+                w[e] = degree[e] + wnvi;
+            }
+          }
+
+          // approximate degrees of the variables of Lk; elements whose
+          // variables are all in Lk are absorbed (aggressive absorption)
+          for (index_t pk = pk1; pk < pk2; ++pk) {
+            index_t i = iw[pk];
+            index_t p1 = pe[i], p2 = p1 + elen[i] - 1, pn = p1;
+            std::size_t h = 0;
+            index_t d = 0;
+            for (p = p1; p <= p2; ++p) {
+              index_t e = iw[p];
+              if (w[e] != 0) {
+                index_t dext = w[e] - mark;
+                if (dext > 0) {
+                  d += dext;
+                  iw[pn++] = e;
+                  h += e;
+                } else {
+                  pe[e] = flip(k);
+                  w[e] = 0;
+                }
+              }
+            }
+            elen[i] = pn - p1 + 1;
+            index_t p3 = pn, p4 = p1 + len[i];
+            for (p = p2 + 1; p < p4; ++p) {
+              index_t j = iw[p], nvj = nv[j];
+              if (nvj <= 0)
+                continue;
+              d += nvj;
+              iw[pn++] = j;
+              h += j;
+            }
+            if (d == 0) {
+              // mass elimination: i is adjacent to k only
+              pe[i] = flip(k);
+              index_t nvi = -nv[i];
+              dk -= nvi;
+              nvk += nvi;
+              nel += nvi;
+              nv[i] = 0;
+              elen[i] = -1;
+            } else {
+              degree[i] = (std::min)(degree[i], d);
+              // k becomes the first element of i
+              iw[pn] = iw[p3];
+              iw[p3] = iw[p1];
+              iw[p1] = k;
+              len[i] = pn - p1 + 1;
+              h %= std::size_t(n);
+              next[i] = hhead[h];
+              hhead[h] = i;
+              last[i] = index_t(h);
+            }
+          }
+          degree[k] = dk;
+          lemax = (std::max)(lemax, dk);
+          mark = clear_marks(mark + lemax, lemax);
+
+          // merge the indistinguishable variables of Lk, which have the
+          // same hash
+          for (index_t pk = pk1; pk < pk2; ++pk) {
+            index_t i = iw[pk];
+            if (nv[i] >= 0)
+              continue;
+            index_t h = last[i];
+            i = hhead[h];
+            hhead[h] = -1;
+            for (; i != -1 && next[i] != -1; i = next[i], ++mark) {
+              index_t ln = len[i], eln = elen[i];
+              for (p = pe[i] + 1; p <= pe[i] + ln - 1; ++p)
+                w[iw[p]] = mark;
+              index_t jlast = i;
+              for (index_t j = next[i]; j != -1;) {
+                bool same = len[j] == ln && elen[j] == eln;
+                for (p = pe[j] + 1; same && p <= pe[j] + ln - 1; ++p)
+                  if (w[iw[p]] != mark)
+                    same = false;
+                if (same) {
+                  pe[j] = flip(i);
+                  nv[i] += nv[j];
+                  nv[j] = 0;
+                  elen[j] = -1;
+                  j = next[j];
+                  next[jlast] = j;
+                } else {
+                  jlast = j;
+                  j = next[j];
+                }
+              }
+            }
+          }
+
+          // the variables of Lk get their final degrees and go back into
+          // the degree lists
+          p = pk1;
+          for (index_t pk = pk1; pk < pk2; ++pk) {
+            index_t i = iw[pk], nvi = -nv[i];
+            if (nvi <= 0)
+              continue;
+            nv[i] = nvi;
+            index_t d = degree[i] + dk - nvi;
+            d = (std::min)(d, n - nel - nvi);
+            push_degree(i, d);
+            mindeg = (std::min)(mindeg, d);
+            degree[i] = d;
+            iw[p++] = i;
+          }
+          nv[k] = nvk;
+          if ((len[k] = p - pk1) == 0) {
+            pe[k] = -1;
+            w[k] = 0;
+          }
+          if (elenk != 0)
+            cnz = p;
+        }
+        postorder();
+      }
+
+      // The elimination order, in which the variables of a supernode are
+      // consecutive, and for each vertex the size of its supernode if it
+      // is the principal variable, or minus the principal variable.
+      template <class InversePermutationMap, class PermutationMap,
+                class SuperNodeSizes>
+      void build_permutation(InversePermutationMap inverse_perm,
+                             PermutationMap perm,
+                             SuperNodeSizes& sizes) const
+      {
+        for (index_t k = 0; k < n; ++k) {
+          perm[k] = order[k];
+          inverse_perm[order[k]] = k;
+        }
+        sizes.resize(n);
+        for (index_t i = 0; i < n; ++i) {
+          if (nv[i] > 0)
+            sizes[i] = nv[i];
+          else {
+            // pe holds the parents in the assembly tree; the dense
+            // variables are children of the root n
+            index_t r = pe[i];
+            while (r != n && nv[r] == 0)
+              r = pe[r];
+            sizes[i] = r == n ? 1 : -r;
+          }
+        }
+      }
+
+    private:
+      static index_t flip(index_t i) { return -i - 2; }
+
+      index_t clear_marks(index_t m, index_t lemax)
+      {
+        if (m < 2 || m + lemax < 0) {
+          for (index_t i = 0; i < n; ++i)
+            if (w[i] != 0)
+              w[i] = 1;
+          m = 2;
+        }
+        return m;
+      }
+
+      void push_degree(index_t i, index_t d)
+      {
+        if (head[d] != -1)
+          last[head[d]] = i;
+        next[i] = head[d];
+        last[i] = -1;
+        head[d] = i;
+      }
+
+      void remove_degree(index_t i)
+      {
+        if (next[i] != -1)
+          last[next[i]] = last[i];
+        if (last[i] != -1)
+          next[last[i]] = next[i];
+        else
+          head[degree[i]] = next[i];
+      }
+
+      // compacts the lists in iw; the first entry of each live list is
+      // temporarily replaced by the flipped index of its owner
+      void collect_garbage()
+      {
+        for (index_t j = 0; j < n; ++j) {
+          index_t p = pe[j];
+          if (p >= 0) {
+            pe[j] = iw[p];
+            iw[p] = flip(j);
+          }
+        }
+        index_t q = 0;
+        for (index_t p = 0; p < cnz;) {
+          index_t j = flip(iw[p++]);
+          if (j >= 0) {
+            iw[q] = pe[j];
+            pe[j] = q++;
+            for (index_t k = 0; k < len[j] - 1; ++k)
+              iw[q++] = iw[p++];
+          }
+        }
+        cnz = q;
+      }
+
+      // orders the assembly tree so that every subtree is contiguous;
+      // the variables absorbed into a supervariable come right before it
+      void postorder()
+      {
+        for (index_t i = 0; i < n; ++i)
+          pe[i] = flip(pe[i]);
+        std::fill(head.begin(), head.end(), -1);
+        for (index_t j = n - 1; j >= 0; --j) {
+          if (nv[j] > 0)
+            continue;
+          next[j] = head[pe[j]];
+          head[pe[j]] = j;
+        }
+        for (index_t e = n; e >= 0; --e) {
+          if (nv[e] <= 0)
+            continue;
+          if (pe[e] != -1) {
+            next[e] = head[pe[e]];
+            head[pe[e]] = e;
+          }
+        }
+        index_t k = 0;
+        std::vector<index_t>& stack = hhead;
+        for (index_t i = 0; i <= n; ++i) {
+          if (pe[i] != -1)
+            continue;
+          index_t top = 0;
+          stack[0] = i;
+          while (top >= 0) {
+            index_t p = stack[top], child = head[p];
+            if (child == -1) {
+              --top;
+              order[k++] = p;
+            } else {
+              head[p] = next[child];
+              stack[++top] = child;
+            }
+          }
+        }
+        BOOST_ASSERT(k == n + 1);
+      }
+
+      const index_t n;
+      const index_t nzmax;
+      index_t cnz, mark, dense_degree;
+      std::vector<index_t> iw, pe, len, nv, next, head, elen, degree, w,
+        hhead, last, order;
+    };
+
+    // The adjacency lists of the symmetric matrix of G in compressed form:
+    // the neighbours of vertex index i are adjacency[first[i]] to
+    // adjacency[first[i + 1] - 1].  An edge in either direction gives a
+    // pair of entries; self-loops and parallel edges are dropped.
+    // index_vertex maps the indices back to the vertices.
+    template <class Graph, class VertexIndexMap>
+    void symmetric_adjacency
+      (const Graph& G, VertexIndexMap vertex_index_map,
+       std::vector<typename graph_traits<Graph>::vertex_descriptor>&
+         index_vertex,
+       std::vector<amd_impl::index_t>& first,
+       std::vector<amd_impl::index_t>& adjacency)
+    {
+      typedef amd_impl::index_t index_t;
+      const index_t n = num_vertices(G);
+      index_vertex.resize(n);
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(G); vi != vi_end; ++vi)
+        index_vertex[get(vertex_index_map, *vi)] = *vi;
+
+      std::vector<index_t> count(n + 1, 0);
+      first.assign(n + 1, 0);
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (index_t i = 0; i < n; ++i)
+        for (boost::tie(ei, ei_end) = out_edges(index_vertex[i], G);
+             ei != ei_end; ++ei) {
+          index_t j = get(vertex_index_map, target(*ei, G));
+          if (j != i) {
+            ++count[i];
+            ++count[j];
+          }
+        }
+      for (index_t i = 0; i < n; ++i)
+        first[i + 1] = first[i] + count[i];
+      adjacency.resize(first[n]);
+      std::copy(first.begin(), first.end() - 1, count.begin());
+      for (index_t i = 0; i < n; ++i)
+        for (boost::tie(ei, ei_end) = out_edges(index_vertex[i], G);
+             ei != ei_end; ++ei) {
+          index_t j = get(vertex_index_map, target(*ei, G));
+          if (j != i) {
+            adjacency[count[i]++] = j;
+            adjacency[count[j]++] = i;
+          }
+        }
+      std::vector<index_t> seen(n, -1);
+      index_t q = 0;
+      for (index_t i = 0; i < n; ++i) {
+        index_t begin = first[i];
+        first[i] = q;
+        for (index_t p = begin; p < first[i + 1]; ++p) {
+          index_t j = adjacency[p];
+          if (seen[j] != i) {
+            seen[j] = i;
+            adjacency[q++] = j;
+          }
+        }
+      }
+      first[n] = q;
+      adjacency.resize(q);
+    }
+
+  } // namespace detail
+
+  // Approximate minimum degree ordering
+  //
+  // Like minimum_degree_ordering(), computes a fill-reducing ordering of
+  // a symmetric sparse matrix given by the graph of its nonzeros, with
+  // the same inverse_perm, perm and supernode_size outputs.  Instead of
+  // the exact external degrees, which multiple minimum degree has to
+  // recompute for every vertex adjacent to an eliminated one, it uses
+  // the upper bounds of Amestoy, Davis and Duff, which cost time
+  // proportional to the size of the quotient graph.  It also includes
+  // element absorption, aggressive absorption, mass elimination and
+  // supervariable detection.  Vertices whose degree exceeds
+  // max(16, dense * sqrt(n)) are ordered last; a negative dense disables
+  // this.
+  //
+  // The graph may be directed or undirected.  An edge in either direction
+  // stands for a nonzero pair of the matrix; self-loops and parallel
+  // edges are ignored.  The degree map is a work map that receives the
+  // degree of each vertex in the symmetrized graph.
+  //
+  // see Patrick R. Amestoy, Timothy A. Davis and Iain S. Duff, An
+  // Approximate Minimum Degree Ordering Algorithm, SIAM Journal on Matrix
+  // Analysis and Applications, 17, 1996, Page 886-905
+  template<class Graph, class DegreeMap,
+           class InversePermutationMap,
+           class PermutationMap,
+           class SuperNodeMap, class VertexIndexMap>
+  void approximate_minimum_degree_ordering
+    (const Graph& G,
+     DegreeMap degree,
+     InversePermutationMap inverse_perm,
+     PermutationMap perm,
+     SuperNodeMap supernode_size,
+     VertexIndexMap vertex_index_map,
+     double dense = 10.0)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_t;
+    typedef detail::amd_impl::index_t index_t;
+    typedef typename property_traits<DegreeMap>::value_type degree_t;
+    typedef typename property_traits<SuperNodeMap>::value_type size_type;
+    const index_t n = num_vertices(G);
+
+    std::vector<vertex_t> index_vertex;
+    std::vector<index_t> first, adjacency;
+    detail::symmetric_adjacency(G, vertex_index_map, index_vertex, first,
+                                adjacency);
+    for (index_t i = 0; i < n; ++i)
+      put(degree, index_vertex[i], degree_t(first[i + 1] - first[i]));
+
+    detail::amd_impl impl(n, first, adjacency, dense);
+    impl.do_amd();
+    std::vector<index_t> sizes;
+    impl.build_permutation(inverse_perm, perm, sizes);
+    for (index_t i = 0; i < n; ++i)
+      put(supernode_size, index_vertex[i], size_type(sizes[i]));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_APPROXIMATE_MINIMUM_DEGREE_ORDERING_HPP
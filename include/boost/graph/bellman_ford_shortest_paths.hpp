@@ -15,13 +15,29 @@
   template <class EdgeListGraph, class Size, class P, class T, class R>
   bool bellman_ford_shortest_paths(EdgeListGraph& g, Size N, 
      const bgl_named_params<P, T, R>& params)
-  
+
+  together with two alternatives for the single-source problem:
+
+  template <class Graph, class P, class T, class R>
+  bool bellman_ford_shortest_paths_fifo(const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     const bgl_named_params<P, T, R>& params)
+
+  a FIFO label-correcting search with subtree disassembly, and
+
+  template <class VertexAndEdgeListGraph, class Size, class P, class T, class R>
+  bool bellman_ford_shortest_paths_parallel(const VertexAndEdgeListGraph& g,
+     Size N, const bgl_named_params<P, T, R>& params)
+
+  a multithreaded edge sweep.
  */
 
 
 #ifndef BOOST_GRAPH_BELLMAN_FORD_SHORTEST_PATHS_HPP
 #define BOOST_GRAPH_BELLMAN_FORD_SHORTEST_PATHS_HPP
 
+#include <vector>
+#include <algorithm>
 #include <boost/config.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/graph_concepts.hpp>
@@ -29,6 +45,8 @@
 #include <boost/graph/relax.hpp>
 #include <boost/graph/visitors.hpp>
 #include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/pending/queue.hpp>
 #include <boost/concept/assert.hpp>
 
 namespace boost {
@@ -235,6 +253,430 @@ namespace boost {
        choose_pmap(get_param(params, vertex_distance), g, vertex_distance),
        params);
   }
+
+  // Queue-based Bellman-Ford with Tarjan's subtree disassembly.
+  //
+  // Vertices whose distance decreased are scanned in FIFO order, as in the
+  // classic "Bellman-Ford-Moore" label-correcting method, so only edges
+  // leaving improved vertices are examined.  In addition the current
+  // shortest path tree is kept as a preorder thread.  When the distance of
+  // v decreases, every descendant of v in the tree is removed from it:
+  // their labels are known to be out of date and scanning them is wasted
+  // work, so they are skipped until they are improved again.  If the
+  // vertex u whose scan improved v is itself found in v's subtree, the
+  // tree edge (u,v) closes a cycle of negative length and the search stops
+  // at once instead of after N passes.
+
+  namespace detail {
+
+    // Preorder thread of the shortest path tree over vertex indices.
+    // Vertices not in the tree have depth npos.
+    struct bellman_ford_tree
+    {
+      static const std::size_t npos = static_cast<std::size_t>(-1);
+
+      explicit bellman_ford_tree(std::size_t n)
+        : next(n), prev(n), depth(n, npos) { }
+
+      bool contains(std::size_t v) const { return depth[v] != npos; }
+
+      void make_root(std::size_t s)
+      {
+        next[s] = prev[s] = s;
+        depth[s] = 0;
+      }
+
+      // Removes v and all of its descendants from the tree.  Returns false
+      // if u is among them.
+      bool disassemble(std::size_t v, std::size_t u)
+      {
+        std::size_t d = depth[v], before = prev[v], x = next[v];
+        bool ok = (v != u);
+        depth[v] = npos;
+        while (x != v && depth[x] != npos && depth[x] > d) {
+          if (x == u)
+            ok = false;
+          depth[x] = npos;
+          x = next[x];
+        }
+        next[before] = x;
+        prev[x] = before;
+        return ok;
+      }
+
+      // Makes v (not in the tree) the first child of u.
+      void attach(std::size_t v, std::size_t u)
+      {
+        std::size_t after = next[u];
+        next[v] = after;
+        prev[after] = v;
+        next[u] = v;
+        prev[v] = u;
+        depth[v] = depth[u] + 1;
+      }
+
+      std::vector<std::size_t> next, prev, depth;
+    };
+
+  } // namespace detail
+
+  template <class Graph, class WeightMap, class PredecessorMap,
+            class DistanceMap, class IndexMap, class BinaryFunction,
+            class BinaryPredicate, class BellmanFordVisitor>
+  bool bellman_ford_shortest_paths_fifo
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     WeightMap weight, PredecessorMap pred, DistanceMap distance,
+     IndexMap index_map, BinaryFunction combine, BinaryPredicate compare,
+     typename property_traits<DistanceMap>::value_type inf,
+     typename property_traits<DistanceMap>::value_type zero,
+     BellmanFordVisitor v)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef graph_traits<Graph> GTraits;
+    typedef typename GTraits::vertex_descriptor Vertex;
+    typedef typename property_traits<DistanceMap>::value_type D;
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<DistanceMap, Vertex> ));
+
+    typename GTraits::vertex_iterator ui, ui_end;
+    for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui) {
+      put(distance, *ui, inf);
+      put(pred, *ui, *ui);
+    }
+    put(distance, s, zero);
+
+    const std::size_t n = num_vertices(g);
+    detail::bellman_ford_tree tree(n);
+    std::vector<char> in_queue(n, false);
+    boost::queue<Vertex> Q;
+
+    tree.make_root(get(index_map, s));
+    Q.push(s);
+    in_queue[get(index_map, s)] = true;
+
+    typename GTraits::out_edge_iterator ei, ei_end;
+    while (!Q.empty()) {
+      Vertex u = Q.top(); Q.pop();
+      std::size_t iu = get(index_map, u);
+      in_queue[iu] = false;
+      // Labels of vertices cut out of the tree are stale; they are queued
+      // again once a better path reaches them.
+      if (!tree.contains(iu))
+        continue;
+      const D d_u = get(distance, u);
+      for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+        Vertex w = target(*ei, g);
+        v.examine_edge(*ei, g);
+        const D d_w = combine(d_u, get(weight, *ei));
+        if (!compare(d_w, get(distance, w))) {
+          v.edge_not_relaxed(*ei, g);
+          continue;
+        }
+        put(distance, w, d_w);
+        put(pred, w, u);
+        v.edge_relaxed(*ei, g);
+        std::size_t iw = get(index_map, w);
+        if (tree.contains(iw) && !tree.disassemble(iw, iu)) {
+          v.edge_not_minimized(*ei, g);
+          return false;
+        }
+        tree.attach(iw, iu);
+        if (!in_queue[iw]) {
+          Q.push(w);
+          in_queue[iw] = true;
+        }
+      }
+    }
+    return true;
+  }
+
+  namespace detail {
+
+    template <class Graph, class WeightMap, class PredecessorMap,
+              class DistanceMap, class IndexMap,
+              class P, class T, class R>
+    bool bellman_fifo_dispatch
+      (const Graph& g, typename graph_traits<Graph>::vertex_descriptor s,
+       WeightMap weight, PredecessorMap pred, DistanceMap distance,
+       IndexMap index_map, const bgl_named_params<P, T, R>& params)
+    {
+      typedef typename property_traits<DistanceMap>::value_type D;
+      bellman_visitor<> null_vis;
+      return bellman_ford_shortest_paths_fifo
+               (g, s, weight, pred, distance, index_map,
+                choose_param(get_param(params, distance_combine_t()),
+                             closed_plus<D>()),
+                choose_param(get_param(params, distance_compare_t()),
+                             std::less<D>()),
+                choose_param(get_param(params, distance_inf_t()),
+                             (std::numeric_limits<D>::max)()),
+                choose_param(get_param(params, distance_zero_t()), D()),
+                choose_param(get_param(params, graph_visitor),
+                             null_vis));
+    }
+
+  } // namespace detail
+
+  template <class Graph, class P, class T, class R>
+  bool bellman_ford_shortest_paths_fifo
+    (const Graph& g, typename graph_traits<Graph>::vertex_descriptor s,
+     const bgl_named_params<P, T, R>& params)
+  {
+    dummy_property_map dummy_pred;
+    return detail::bellman_fifo_dispatch
+      (g, s,
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_param(get_param(params, vertex_predecessor), dummy_pred),
+       choose_pmap(get_param(params, vertex_distance), g, vertex_distance),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       params);
+  }
+
+  // Data-parallel Bellman-Ford for the dense worst case.
+  //
+  // The edges are grouped by target vertex once, then every pass
+  // recomputes all distances from those of the previous pass (a Jacobi
+  // sweep) with the targets divided between the threads, so no two threads
+  // ever write the same label.  A pass can propagate a distance by only
+  // one edge, but no more than N passes are needed, just as for the
+  // sequential sweep.  The visitor is not supported because its events
+  // would be raised concurrently.
+
+  namespace detail {
+
+    template <class Graph, class WeightMap, class Combine, class Compare,
+              class D>
+    struct bellman_ford_sweep_body
+    {
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+
+      bellman_ford_sweep_body(const Graph& g, WeightMap weight,
+                              Combine combine, Compare compare,
+                              const std::vector<std::size_t>& offsets,
+                              const std::vector<std::size_t>& sources,
+                              const std::vector<Edge>& in_edges,
+                              const std::vector<D>& d_old,
+                              std::vector<D>& d_new,
+                              std::vector<std::size_t>& parent,
+                              std::vector<char>& changed)
+        : m_g(g), m_weight(weight), m_combine(combine), m_compare(compare),
+          m_offsets(offsets), m_sources(sources), m_in_edges(in_edges),
+          m_d_old(d_old), m_d_new(d_new), m_parent(parent),
+          m_changed(changed) { }
+
+      void operator()(std::size_t v, std::size_t t)
+      {
+        D best = m_d_old[v];
+        std::size_t best_parent = m_parent[v];
+        for (std::size_t k = m_offsets[v]; k < m_offsets[v + 1]; ++k) {
+          D candidate = m_combine(m_d_old[m_sources[k]],
+                                  get(m_weight, m_in_edges[k]));
+          if (m_compare(candidate, best)) {
+            best = candidate;
+            best_parent = m_sources[k];
+          }
+        }
+        m_d_new[v] = best;
+        if (m_compare(best, m_d_old[v])) {
+          m_parent[v] = best_parent;
+          m_changed[t] = true;
+        }
+      }
+
+      const Graph& m_g;
+      WeightMap m_weight;
+      Combine m_combine;
+      Compare m_compare;
+      const std::vector<std::size_t>& m_offsets;
+      const std::vector<std::size_t>& m_sources;
+      const std::vector<Edge>& m_in_edges;
+      const std::vector<D>& m_d_old;
+      std::vector<D>& m_d_new;
+      std::vector<std::size_t>& m_parent;
+      std::vector<char>& m_changed;
+    };
+
+    template <class Graph, class WeightMap, class Combine, class Compare,
+              class D>
+    struct bellman_ford_check_body
+    {
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+
+      bellman_ford_check_body(WeightMap weight, Combine combine,
+                              Compare compare,
+                              const std::vector<std::size_t>& offsets,
+                              const std::vector<std::size_t>& sources,
+                              const std::vector<Edge>& in_edges,
+                              const std::vector<D>& d,
+                              std::vector<char>& violated)
+        : m_weight(weight), m_combine(combine), m_compare(compare),
+          m_offsets(offsets), m_sources(sources), m_in_edges(in_edges),
+          m_d(d), m_violated(violated) { }
+
+      void operator()(std::size_t v, std::size_t t)
+      {
+        for (std::size_t k = m_offsets[v]; k < m_offsets[v + 1]; ++k)
+          if (m_compare(m_combine(m_d[m_sources[k]],
+                                  get(m_weight, m_in_edges[k])), m_d[v]))
+            m_violated[t] = true;
+      }
+
+      WeightMap m_weight;
+      Combine m_combine;
+      Compare m_compare;
+      const std::vector<std::size_t>& m_offsets;
+      const std::vector<std::size_t>& m_sources;
+      const std::vector<Edge>& m_in_edges;
+      const std::vector<D>& m_d;
+      std::vector<char>& m_violated;
+    };
+
+  } // namespace detail
+
+  template <class VertexAndEdgeListGraph, class Size, class WeightMap,
+            class PredecessorMap, class DistanceMap, class IndexMap,
+            class BinaryFunction, class BinaryPredicate>
+  bool bellman_ford_shortest_paths_parallel
+    (const VertexAndEdgeListGraph& g, Size N,
+     WeightMap weight, PredecessorMap pred, DistanceMap distance,
+     IndexMap index_map, BinaryFunction combine, BinaryPredicate compare,
+     std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( EdgeListGraphConcept<VertexAndEdgeListGraph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<VertexAndEdgeListGraph> ));
+    typedef graph_traits<VertexAndEdgeListGraph> GTraits;
+    typedef typename GTraits::edge_descriptor Edge;
+    typedef typename GTraits::vertex_descriptor Vertex;
+    typedef typename property_traits<DistanceMap>::value_type D;
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<DistanceMap, Vertex> ));
+
+    typedef typename GTraits::directed_category DirCat;
+    const bool is_undirected = is_same<DirCat, undirected_tag>::value;
+    const std::size_t n = num_vertices(g);
+    const std::size_t none = static_cast<std::size_t>(-1);
+
+    // Group the (source, edge) pairs by target with a counting sort.
+    std::vector<Vertex> verts(n);
+    std::vector<std::size_t> offsets(n + 1, 0);
+    typename GTraits::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      verts[get(index_map, *vi)] = *vi;
+    typename GTraits::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+      ++offsets[get(index_map, target(*ei, g)) + 1];
+      if (is_undirected)
+        ++offsets[get(index_map, source(*ei, g)) + 1];
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      offsets[i + 1] += offsets[i];
+    std::vector<std::size_t> sources(offsets[n]), fill(offsets.begin(),
+                                                       offsets.end() - 1);
+    std::vector<Edge> in(offsets[n]);
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+      std::size_t a = get(index_map, source(*ei, g)),
+        b = get(index_map, target(*ei, g));
+      sources[fill[b]] = a;
+      in[fill[b]++] = *ei;
+      if (is_undirected) {
+        sources[fill[a]] = b;
+        in[fill[a]++] = *ei;
+      }
+    }
+
+    std::vector<D> d_old(n), d_new(n);
+    std::vector<std::size_t> parent(n, none);
+    for (std::size_t i = 0; i < n; ++i)
+      d_old[i] = get(distance, verts[i]);
+
+    num_threads = detail::resolve_number_of_threads(num_threads);
+    std::vector<char> flags(num_threads);
+    const std::size_t grain = 256;
+    for (Size k = 0; k < N; ++k) {
+      std::fill(flags.begin(), flags.end(), false);
+      detail::bellman_ford_sweep_body<VertexAndEdgeListGraph, WeightMap,
+        BinaryFunction, BinaryPredicate, D>
+        sweep(g, weight, combine, compare, offsets, sources, in,
+              d_old, d_new, parent, flags);
+      detail::parallel_for(n, sweep, num_threads, grain);
+      d_old.swap(d_new);
+      if (std::find(flags.begin(), flags.end(), true) == flags.end())
+        break;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+      put(distance, verts[i], d_old[i]);
+      if (parent[i] != none)
+        put(pred, verts[i], verts[parent[i]]);
+    }
+
+    std::fill(flags.begin(), flags.end(), false);
+    detail::bellman_ford_check_body<VertexAndEdgeListGraph, WeightMap,
+      BinaryFunction, BinaryPredicate, D>
+      check(weight, combine, compare, offsets, sources, in, d_old, flags);
+    detail::parallel_for(n, check, num_threads, grain);
+    return std::find(flags.begin(), flags.end(), true) == flags.end();
+  }
+
+  namespace detail {
+
+    template <class VertexAndEdgeListGraph, class Size, class WeightMap,
+              class PredecessorMap, class DistanceMap, class P, class T,
+              class R>
+    bool bellman_parallel_dispatch2
+      (const VertexAndEdgeListGraph& g, param_not_found,
+       Size N, WeightMap weight, PredecessorMap pred, DistanceMap distance,
+       const bgl_named_params<P, T, R>& params)
+    {
+      typedef typename property_traits<DistanceMap>::value_type D;
+      return bellman_ford_shortest_paths_parallel
+        (g, N, weight, pred, distance,
+         choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+         choose_param(get_param(params, distance_combine_t()),
+                      closed_plus<D>()),
+         choose_param(get_param(params, distance_compare_t()),
+                      std::less<D>()),
+         choose_param(get_param(params, number_of_threads_t()),
+                      std::size_t(1)));
+    }
+
+    template <class VertexAndEdgeListGraph, class Size, class WeightMap,
+              class PredecessorMap, class DistanceMap, class P, class T,
+              class R>
+    bool bellman_parallel_dispatch2
+      (const VertexAndEdgeListGraph& g,
+       typename graph_traits<VertexAndEdgeListGraph>::vertex_descriptor s,
+       Size N, WeightMap weight, PredecessorMap pred, DistanceMap distance,
+       const bgl_named_params<P, T, R>& params)
+    {
+      typedef typename property_traits<DistanceMap>::value_type D;
+      typename graph_traits<VertexAndEdgeListGraph>::vertex_iterator v, v_end;
+      for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v) {
+        put(distance, *v, (std::numeric_limits<D>::max)());
+        put(pred, *v, *v);
+      }
+      put(distance, s, D(0));
+      return bellman_parallel_dispatch2(g, param_not_found(), N, weight,
+                                        pred, distance, params);
+    }
+
+  } // namespace detail
+
+  template <class VertexAndEdgeListGraph, class Size,
+            class P, class T, class R>
+  bool bellman_ford_shortest_paths_parallel
+    (const VertexAndEdgeListGraph& g, Size N,
+     const bgl_named_params<P, T, R>& params)
+  {
+    dummy_property_map dummy_pred;
+    return detail::bellman_parallel_dispatch2
+      (g, get_param(params, root_vertex_t()), N,
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_param(get_param(params, vertex_predecessor), dummy_pred),
+       choose_pmap(get_param(params, vertex_distance), g, vertex_distance),
+       params);
+  }
+
 } // namespace boost
 
 #endif // BOOST_GRAPH_BELLMAN_FORD_SHORTEST_PATHS_HPP
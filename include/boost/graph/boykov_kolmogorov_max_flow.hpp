@@ -35,12 +35,10 @@
 #include <boost/config.hpp>
 #include <boost/assert.hpp>
 #include <vector>
-#include <list>
 #include <utility>
 #include <iosfwd>
 #include <algorithm> // for std::min and std::max
 
-#include <boost/pending/queue.hpp>
 #include <boost/limits.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/none_t.hpp>
@@ -65,6 +63,54 @@ namespace boost {
 
 namespace detail {
 
+/**
+ * A FIFO queue that can also be pushed to at the front, stored in a ring of
+ * fixed capacity. Every vertex is in each of the solver's queues at most
+ * once, so with room for num_vertices(g) elements the queues never allocate
+ * after construction.
+ */
+template <class T>
+class bk_ring_queue {
+    public:
+      explicit bk_ring_queue(std::size_t capacity):
+      m_data(capacity), m_first(0), m_size(0){ }
+
+      bool empty() const { return m_size == 0; }
+      std::size_t size() const { return m_size; }
+
+      // i-th element counted from the front
+      const T& operator[](std::size_t i) const { return m_data[wrap(m_first + i)]; }
+      const T& front() const { return m_data[m_first]; }
+
+      void push_back(const T& x){
+        BOOST_ASSERT(m_size < m_data.size());
+        m_data[wrap(m_first + m_size)] = x;
+        ++m_size;
+      }
+
+      void push_front(const T& x){
+        BOOST_ASSERT(m_size < m_data.size());
+        m_first = (m_first == 0 ? m_data.size() : m_first) - 1;
+        m_data[m_first] = x;
+        ++m_size;
+      }
+
+      void pop_front(){
+        BOOST_ASSERT(m_size > 0);
+        m_first = wrap(m_first + 1);
+        --m_size;
+      }
+
+      void clear(){ m_first = 0; m_size = 0; }
+
+    private:
+      std::size_t wrap(std::size_t i) const { return i < m_data.size() ? i : i - m_data.size(); }
+
+      std::vector<T> m_data;
+      std::size_t m_first;
+      std::size_t m_size;
+};
+
 template <class Graph,
           class EdgeCapacityMap,
           class ResidualCapacityEdgeMap,
@@ -81,7 +127,7 @@ class bk_max_flow {
   typedef typename tGraphTraits::edge_descriptor edge_descriptor;
   typedef typename tGraphTraits::edge_iterator edge_iterator;
   typedef typename tGraphTraits::out_edge_iterator out_edge_iterator;
-  typedef boost::queue<vertex_descriptor> tQueue;                               //queue of vertices, used in adoption-stage
+  typedef bk_ring_queue<vertex_descriptor> tQueue;                              //queue of vertices, used in grow- and adoption-stage
   typedef typename property_traits<ColorMap>::value_type tColorValue;
   typedef color_traits<tColorValue> tColorTraits;
   typedef typename property_traits<DistanceMap>::value_type tDistanceVal;
@@ -107,16 +153,116 @@ class bk_max_flow {
       m_dist_map(dist),
       m_source(src),
       m_sink(sink),
-      m_active_nodes(),
+      m_active_nodes(num_vertices(g)),
       m_in_active_list_vec(num_vertices(g), false),
       m_in_active_list_map(make_iterator_property_map(m_in_active_list_vec.begin(), m_index_map)),
+      m_orphans(num_vertices(g)),
+      m_child_orphans(num_vertices(g)),
       m_has_parent_vec(num_vertices(g), false),
       m_has_parent_map(make_iterator_property_map(m_has_parent_vec.begin(), m_index_map)),
       m_time_vec(num_vertices(g), 0),
       m_time_map(make_iterator_property_map(m_time_vec.begin(), m_index_map)),
       m_flow(0),
+      m_offset(0),
       m_time(1),
-      m_last_grow_vertex(graph_traits<Graph>::null_vertex()){
+      m_last_grow_vertex(graph_traits<Graph>::null_vertex()),
+      m_solved(false){
+        init();
+      }
+
+      /**
+       * computes the maximum flow. Calling it again after add_capacity()
+       * continues from the previous flow and search trees
+       */
+      tEdgeVal max_flow(){
+        if(!m_solved){
+          //augment direct paths from SOURCE->SINK and SOURCE->VERTEX->SINK
+          augment_direct_paths();
+          m_solved = true;
+        } else{
+          //only the orphans left by add_capacity() have to be adopted
+          ++m_time;
+          adopt();
+        }
+        //start the main-loop
+        while(true){
+          bool path_found;
+          edge_descriptor connecting_edge;
+          boost::tie(connecting_edge, path_found) = grow(); //find a path from source to sink
+          if(!path_found){
+            //we're finished, no more paths were found
+            break;
+          }
+          ++m_time;
+          augment(connecting_edge); //augment that path
+          adopt(); //rebuild search tree structure
+        }
+        return m_flow - m_offset;
+      }
+
+      /**
+       * changes the capacity of e by delta and updates the residual graph and
+       * the search trees, so that the next max_flow() reuses both (Kohli, P.,
+       * Torr, P. "Efficiently Solving Dynamic Markov Random Fields Using
+       * Graph Cuts", ICCV 2005). If the flow on e exceeds its new capacity
+       * and e is a terminal edge (s,v) or (v,t), the surplus is first pushed
+       * back through the other terminal edge of v; what remains is added to
+       * the capacities of both terminal edges of v, which raises every cut
+       * by the same amount and is subtracted from the result of max_flow().
+       * In any other case the flow is recomputed from scratch.
+       */
+      void add_capacity(edge_descriptor e, tEdgeVal delta){
+        put(m_cap_map, e, get(m_cap_map, e) + delta);
+        const tEdgeVal res = get(m_res_cap_map, e) + delta;
+        if(!m_solved){
+          put(m_res_cap_map, e, res);
+          return;
+        }
+        if(res >= 0){
+          set_residual(e, res);
+          return;
+        }
+        const tEdgeVal surplus = -res;
+        const vertex_descriptor u = source(e, m_g);
+        const vertex_descriptor v = target(e, m_g);
+        tEdgeVal cancelled = surplus;
+        if(u != m_source || v != m_sink){
+          edge_descriptor other;
+          bool is_there = false;
+          if(u == m_source){
+            boost::tie(other, is_there) = lookup_edge(v, m_sink, m_g);
+          } else if(v == m_sink){
+            boost::tie(other, is_there) = lookup_edge(m_source, u, m_g);
+          }
+          if(!is_there){
+            init();
+            return;
+          }
+          //the flow through e continues on the other terminal edge, take as
+          //much of the surplus back from there as it carries
+          const tEdgeVal other_flow = get(m_cap_map, other) - get(m_res_cap_map, other);
+          cancelled = (std::max)(tEdgeVal(0), (std::min)(surplus, other_flow));
+          const tEdgeVal raise = surplus - cancelled;
+          if(raise > 0){
+            put(m_cap_map, e, get(m_cap_map, e) + raise);
+            put(m_cap_map, other, get(m_cap_map, other) + raise);
+            m_offset += raise;
+          }
+          set_residual(other, get(m_res_cap_map, other) + surplus);
+        }
+        // as in augment_direct_paths(), the reverse edges of terminal edges
+        // are left alone
+        set_residual(e, 0);
+        m_flow -= cancelled;
+      }
+
+      // the complete class is protected, as we want access to members in
+      // derived test-class (see test/boykov_kolmogorov_max_flow_test.cpp)
+    protected:
+      /**
+       * sets up zero flow and search trees holding only the terminals
+       */
+      void init(){
         // initialize the color-map with gray-values
         vertex_iterator vi, v_end;
         for(boost::tie(vi, v_end) = vertices(m_g); vi != v_end; ++vi){
@@ -129,35 +275,55 @@ class bk_max_flow {
           put(m_res_cap_map, *ei, get(m_cap_map, *ei));
           BOOST_ASSERT(get(m_rev_edge_map, get(m_rev_edge_map, *ei)) == *ei); //check if the reverse edge map is build up properly
         }
+        if(m_solved){
+          //forget the state of a previous run
+          std::fill(m_in_active_list_vec.begin(), m_in_active_list_vec.end(), false);
+          std::fill(m_has_parent_vec.begin(), m_has_parent_vec.end(), false);
+          std::fill(m_time_vec.begin(), m_time_vec.end(), 0);
+          m_active_nodes.clear();
+          m_orphans.clear();
+          m_flow = 0;
+          m_time = 1;
+          m_last_grow_vertex = graph_traits<Graph>::null_vertex();
+          m_solved = false;
+        }
         //init the search trees with the two terminals
         set_tree(m_source, tColorTraits::black());
         set_tree(m_sink, tColorTraits::white());
+        put(m_dist_map, m_source, 0);
+        put(m_dist_map, m_sink, 0);
         put(m_time_map, m_source, 1);
         put(m_time_map, m_sink, 1);
       }
 
-      tEdgeVal max_flow(){
-        //augment direct paths from SOURCE->SINK and SOURCE->VERTEX->SINK
-        augment_direct_paths();
-        //start the main-loop
-        while(true){
-          bool path_found;
-          edge_descriptor connecting_edge;
-          boost::tie(connecting_edge, path_found) = grow(); //find a path from source to sink
-          if(!path_found){
-            //we're finished, no more paths were found
-            break;
+      /**
+       * sets the residual capacity of e and repairs the search trees: if e
+       * gets saturated and was a tree edge, the child becomes an orphan; if
+       * e gets unsaturated, its tree endpoints become active again, as the
+       * trees may now grow through e
+       */
+      void set_residual(edge_descriptor e, tEdgeVal r){
+        const bool was_free = get(m_res_cap_map, e) > 0;
+        put(m_res_cap_map, e, r);
+        const vertex_descriptor u = source(e, m_g);
+        const vertex_descriptor v = target(e, m_g);
+        if(was_free && r <= 0){
+          if(get_tree(v) == tColorTraits::black() && has_parent(v) && get_edge_to_parent(v) == e){
+            set_no_parent(v);
+            m_orphans.push_back(v);
           }
-          ++m_time;
-          augment(connecting_edge); //augment that path
-          adopt(); //rebuild search tree structure
+          if(get_tree(u) == tColorTraits::white() && has_parent(u) && get_edge_to_parent(u) == e){
+            set_no_parent(u);
+            m_orphans.push_back(u);
+          }
+        } else if(!was_free && r > 0){
+          if(get_tree(u) == tColorTraits::black())
+            add_active_node(u);
+          if(get_tree(v) == tColorTraits::white())
+            add_active_node(v);
         }
-        return m_flow;
       }
 
-      // the complete class is protected, as we want access to members in
-      // derived test-class (see test/boykov_kolmogorov_max_flow_test.cpp)
-    protected:
       void augment_direct_paths(){
         // in a first step, we augment all direct paths from source->NODE->sink
         // and additionally paths from source->sink. This improves especially
@@ -413,7 +579,7 @@ class bk_max_flow {
             m_orphans.pop_front();
           } else{
             current_node = m_child_orphans.front();
-            m_child_orphans.pop();
+            m_child_orphans.pop_front();
           }
           if(get_tree(current_node) == tColorTraits::black()){
             //we're in the source-tree
@@ -450,7 +616,7 @@ class bk_max_flow {
                     //we are the parent of that node
                     //it has to find a new parent, too
                     set_no_parent(other_node);
-                    m_child_orphans.push(other_node);
+                    m_child_orphans.push_back(other_node);
                   }
                 }
               }
@@ -490,7 +656,7 @@ class bk_max_flow {
                   if(has_parent(other_node) && target(get_edge_to_parent(other_node), m_g) == current_node){
                     //we were it's parent, so it has to find a new one, too
                     set_no_parent(other_node);
-                    m_child_orphans.push(other_node);
+                    m_child_orphans.push_back(other_node);
                   }
                 }
               }
@@ -511,7 +677,7 @@ class bk_max_flow {
 
       //if it has no parent, this node can't be active (if its not source or sink)
       if(!has_parent(v) && v != m_source && v != m_sink){
-            m_active_nodes.pop();
+            m_active_nodes.pop_front();
             put(m_in_active_list_map, v, false);
           } else{
             BOOST_ASSERT(get_tree(v) == tColorTraits::black() || get_tree(v) == tColorTraits::white());
@@ -532,7 +698,7 @@ class bk_max_flow {
           return;
         } else{
           put(m_in_active_list_map, v, true);
-          m_active_nodes.push(v);
+          m_active_nodes.push_back(v);
         }
       }
 
@@ -541,7 +707,7 @@ class bk_max_flow {
        */
       inline void finish_node(vertex_descriptor v){
         BOOST_ASSERT(m_active_nodes.front() == v);
-        m_active_nodes.pop();
+        m_active_nodes.pop_front();
         put(m_in_active_list_map, v, false);
         m_last_grow_vertex = graph_traits<Graph>::null_vertex();
       }
@@ -703,7 +869,7 @@ class bk_max_flow {
       std::vector<bool> m_in_active_list_vec;
       iterator_property_map<std::vector<bool>::iterator, IndexMap> m_in_active_list_map;
 
-      std::list<vertex_descriptor> m_orphans;
+      tQueue m_orphans; // used as a stack in the augment phase, see augment()
       tQueue m_child_orphans; // we use a second queuqe for child orphans, as they are FIFO processed
 
       std::vector<bool> m_has_parent_vec;
@@ -712,10 +878,12 @@ class bk_max_flow {
       std::vector<long> m_time_vec; //timestamp of each node, used for sink/source-path calculations
       iterator_property_map<std::vector<long>::iterator, IndexMap> m_time_map;
       tEdgeVal m_flow;
+      tEdgeVal m_offset; //sum of the capacities add_capacity() put on both terminal edges of a vertex
       long m_time;
       vertex_descriptor m_last_grow_vertex;
       out_edge_iterator m_last_grow_edge_it;
       out_edge_iterator m_last_grow_edge_end;
+      bool m_solved; //if flow and search trees are those of a previous max_flow()
 };
 
 } //namespace boost::detail
@@ -867,6 +1035,79 @@ boykov_kolmogorov_max_flow(Graph& g,
   return boykov_kolmogorov_max_flow(g, src, sink, params);
 }
 
+/**
+ * A Boykov-Kolmogorov solver that keeps the residual graph and the search
+ * trees between runs, for sequences of min-cut problems that differ in a
+ * few capacities only. Capacities must be changed through add_capacity(),
+ * which updates the capacity map as well; the next max_flow() then starts
+ * from the previous flow instead of from zero. The maps are owned by the
+ * caller and must stay valid as long as the solver is used.
+ */
+template<class Graph,
+         class CapacityEdgeMap,
+         class ResidualCapacityEdgeMap,
+         class ReverseEdgeMap,
+         class PredecessorMap,
+         class ColorMap,
+         class DistanceMap,
+         class IndexMap>
+class boykov_kolmogorov_max_flow_solver {
+  typedef detail::bk_max_flow<
+    Graph, CapacityEdgeMap, ResidualCapacityEdgeMap, ReverseEdgeMap,
+    PredecessorMap, ColorMap, DistanceMap, IndexMap
+  > tAlgorithm;
+
+  public:
+    typedef typename property_traits<CapacityEdgeMap>::value_type value_type;
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename graph_traits<Graph>::edge_descriptor edge_descriptor;
+
+    boykov_kolmogorov_max_flow_solver(Graph& g,
+                                      CapacityEdgeMap cap,
+                                      ResidualCapacityEdgeMap res_cap,
+                                      ReverseEdgeMap rev_map,
+                                      PredecessorMap pre_map,
+                                      ColorMap color,
+                                      DistanceMap dist,
+                                      IndexMap idx,
+                                      vertex_descriptor src,
+                                      vertex_descriptor sink):
+    m_algo(g, cap, res_cap, rev_map, pre_map, color, dist, idx, src, sink){
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( EdgeListGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<CapacityEdgeMap, edge_descriptor> )); //add_capacity() writes capacities
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<ResidualCapacityEdgeMap, edge_descriptor> ));
+      BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<ReverseEdgeMap, edge_descriptor> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<PredecessorMap, vertex_descriptor> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<ColorMap, vertex_descriptor> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<DistanceMap, vertex_descriptor> ));
+      BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<IndexMap, vertex_descriptor> ));
+      BOOST_ASSERT(num_vertices(g) >= 2 && src != sink);
+    }
+
+    /**
+     * returns the maximum flow for the current capacities; the color map
+     * holds the corresponding minimum cut (black: source side)
+     */
+    value_type max_flow(){ return m_algo.max_flow(); }
+
+    /**
+     * adds delta (which may be negative) to the capacity of e. Changes of
+     * terminal edges (src,v) and (v,sink) are cheap; decreasing any other
+     * edge below its current flow restarts the next max_flow() from zero
+     * flow.
+     */
+    void add_capacity(edge_descriptor e, value_type delta){ m_algo.add_capacity(e, delta); }
+
+  private:
+    // the search trees refer to vectors owned by m_algo
+    boykov_kolmogorov_max_flow_solver(const boykov_kolmogorov_max_flow_solver&);
+    boykov_kolmogorov_max_flow_solver& operator=(const boykov_kolmogorov_max_flow_solver&);
+
+    tAlgorithm m_algo;
+};
+
 } // namespace boost
 
 #endif // BOOST_BOYKOV_KOLMOGOROV_MAX_FLOW_HPP
@@ -0,0 +1,790 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_CANONICAL_LABELING_HPP
+#define BOOST_GRAPH_CANONICAL_LABELING_HPP
+
+// Canonical labeling by partition refinement and individualization, in the
+// manner of nauty and bliss.  The vertices are numbered so that isomorphic
+// graphs get identical numbered copies, the canonical forms, which are
+// returned as graph_certificate objects.  Certificates can be compared or
+// hashed, so isomorphism classes can be found with a hash table instead of
+// pairwise isomorphism tests.
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/concept/assert.hpp>
+
+namespace boost {
+
+  // The canonical form of a graph: the invariant of each vertex and the
+  // edges, with the vertices numbered by their canonical labels.  The edges
+  // are sorted, and those of an undirected graph have their smaller end
+  // first.  Two graphs are isomorphic, by a mapping that preserves the
+  // vertex invariants, if and only if their certificates are equal.
+  class graph_certificate
+  {
+  public:
+    typedef std::pair<std::size_t, std::size_t> edge_type;
+
+    graph_certificate() : m_directed(false) { }
+
+    // Takes the contents of colors and edges.
+    graph_certificate(bool directed, std::vector<std::size_t>& colors,
+                      std::vector<edge_type>& edges)
+      : m_directed(directed)
+    {
+      m_colors.swap(colors);
+      m_edges.swap(edges);
+    }
+
+    bool directed() const { return m_directed; }
+    std::size_t num_vertices() const { return m_colors.size(); }
+    std::size_t num_edges() const { return m_edges.size(); }
+
+    // The invariant of each vertex, by canonical label
+    const std::vector<std::size_t>& colors() const { return m_colors; }
+
+    const std::vector<edge_type>& edges() const { return m_edges; }
+
+    // A 128-bit hash of the certificate, as two 64-bit halves computed
+    // independently.  Unlike the certificate, it does not depend on the
+    // size of std::size_t.
+    std::pair<boost::uint64_t, boost::uint64_t> hash128() const
+    {
+      boost::uint64_t h1 = UINT64_C(0x243f6a8885a308d3);
+      boost::uint64_t h2 = UINT64_C(0x13198a2e03707344);
+      add(h1, h2, m_directed ? 1 : 0);
+      add(h1, h2, m_colors.size());
+      for (std::size_t i = 0; i < m_colors.size(); ++i)
+        add(h1, h2, m_colors[i]);
+      add(h1, h2, m_edges.size());
+      for (std::size_t i = 0; i < m_edges.size(); ++i) {
+        add(h1, h2, m_edges[i].first);
+        add(h1, h2, m_edges[i].second);
+      }
+      return std::make_pair(mix(h1), mix(h2 ^ UINT64_C(0xa4093822299f31d0)));
+    }
+
+    boost::uint64_t hash() const { return hash128().first; }
+
+    friend bool operator==(const graph_certificate& a,
+                           const graph_certificate& b)
+    {
+      return a.m_directed == b.m_directed && a.m_colors == b.m_colors
+        && a.m_edges == b.m_edges;
+    }
+
+    friend bool operator!=(const graph_certificate& a,
+                           const graph_certificate& b)
+    { return !(a == b); }
+
+    // An arbitrary total order, for ordered containers
+    friend bool operator<(const graph_certificate& a,
+                          const graph_certificate& b)
+    {
+      if (a.m_directed != b.m_directed)
+        return b.m_directed;
+      if (a.m_colors != b.m_colors)
+        return a.m_colors < b.m_colors;
+      return a.m_edges < b.m_edges;
+    }
+
+    void swap(graph_certificate& other)
+    {
+      std::swap(m_directed, other.m_directed);
+      m_colors.swap(other.m_colors);
+      m_edges.swap(other.m_edges);
+    }
+
+    // The finalizer of SplitMix64
+    static boost::uint64_t mix(boost::uint64_t x)
+    {
+      x ^= x >> 30;
+      x *= UINT64_C(0xbf58476d1ce4e5b9);
+      x ^= x >> 27;
+      x *= UINT64_C(0x94d049bb133111eb);
+      x ^= x >> 31;
+      return x;
+    }
+
+  private:
+    static void add(boost::uint64_t& h1, boost::uint64_t& h2,
+                    boost::uint64_t x)
+    {
+      h1 = (h1 ^ mix(x)) * UINT64_C(0x9e3779b97f4a7c15);
+      h1 = (h1 << 29) | (h1 >> 35);
+      h2 = (h2 + mix(x ^ UINT64_C(0x452821e638d01377)))
+        * UINT64_C(0xc2b2ae3d27d4eb4f);
+      h2 = (h2 << 31) | (h2 >> 33);
+    }
+
+    bool m_directed;
+    std::vector<std::size_t> m_colors;
+    std::vector<edge_type> m_edges;
+  };
+
+  // For boost::hash, e.g. in boost::unordered_map
+  inline std::size_t hash_value(const graph_certificate& c)
+  {
+    return static_cast<std::size_t>(c.hash());
+  }
+
+  inline void swap(graph_certificate& a, graph_certificate& b)
+  {
+    a.swap(b);
+  }
+
+  namespace detail {
+
+    // The default vertex invariant: all vertices are alike.
+    struct constant_vertex_invariant
+    {
+      typedef std::size_t result_type;
+      template <typename Vertex>
+      std::size_t operator()(const Vertex&) const { return 0; }
+    };
+
+    // The search for the canonical labeling, on vertex indices.  The
+    // ordered partition is kept in elems, with the cells as contiguous
+    // ranges; cell[v] is the start of the cell of v and len[s] the length
+    // of the cell starting at s.  Refinement only splits cells, and the
+    // splits are recorded in a trail so that backtracking can merge them
+    // again.
+    //
+    // The leaves of the search tree are ordered by the sequence of hashes
+    // of the refinements on the path to them, then by their labeled
+    // graphs, and the canonical labeling is that of the smallest leaf.
+    // The hashes only depend on the partitions, so subtrees whose
+    // refinements hash higher than those of the best leaf are pruned, and
+    // leaves that give the same labeled graph as the best one yield
+    // automorphisms.  The search then returns to the node where the
+    // current path leaves the best one, and the orbits of the automorphisms
+    // prune the children of later nodes.
+    class canonical_labeler
+    {
+    public:
+      typedef graph_certificate::edge_type edge_type;
+
+      canonical_labeler(std::size_t n, bool directed,
+                        std::vector<std::size_t>& colors,
+                        std::vector<edge_type>& edges)
+        : m_n(n), m_directed(directed), m_elems(n), m_pos(n), m_cell(n),
+          m_len(n), m_num_cells(0), m_in_queue(n, 0), m_count1(n, 0),
+          m_count2(n, 0), m_on_path(n, 0), m_local(n), m_have_best(false)
+      {
+        m_colors.swap(colors);
+        m_edges.swap(edges);
+        build_adjacency();
+      }
+
+      // Returns the canonical label of each vertex index in labels and the
+      // certificate.
+      void run(std::vector<std::size_t>& labels, graph_certificate& result)
+      {
+        initial_partition();
+        refine();
+        if (m_num_cells == m_n)
+          leaf(true);
+        else
+          search();
+
+        labels = m_best_pos;
+        std::vector<std::size_t> colors(m_n);
+        for (std::size_t v = 0; v < m_n; ++v)
+          colors[m_best_pos[v]] = m_colors[v];
+        graph_certificate(m_directed, colors, m_best_edges).swap(result);
+      }
+
+    private:
+      struct node
+      {
+        std::vector<std::size_t> candidates;
+        std::vector<char> tried;
+        std::size_t chosen, trail_mark;
+        bool active, better;
+      };
+
+      static boost::uint64_t combine(boost::uint64_t h, boost::uint64_t x)
+      {
+        return graph_certificate::mix(h ^ (x + UINT64_C(0x9e3779b97f4a7c15)
+                                           + (h << 6) + (h >> 2)));
+      }
+
+      // CSR adjacency: for undirected graphs only the first one is used,
+      // and it holds both ends of each edge.
+      void build_adjacency()
+      {
+        m_start1.assign(m_n + 1, 0);
+        m_start2.assign(m_n + 1, 0);
+        for (std::size_t i = 0; i < m_edges.size(); ++i) {
+          std::size_t u = m_edges[i].first, v = m_edges[i].second;
+          if (m_directed) {
+            ++m_start1[v];   // u is an in-neighbor of v
+            ++m_start2[u];   // v is an out-neighbor of u
+          } else {
+            ++m_start1[u];
+            if (u != v)
+              ++m_start1[v];
+          }
+        }
+        for (std::size_t v = 0; v < m_n; ++v) {
+          m_start1[v + 1] += m_start1[v];
+          m_start2[v + 1] += m_start2[v];
+        }
+        m_adj1.resize(m_start1[m_n]);
+        m_adj2.resize(m_start2[m_n]);
+        for (std::size_t i = m_edges.size(); i-- > 0; ) {
+          std::size_t u = m_edges[i].first, v = m_edges[i].second;
+          if (m_directed) {
+            m_adj1[--m_start1[v]] = u;
+            m_adj2[--m_start2[u]] = v;
+          } else {
+            m_adj1[--m_start1[u]] = v;
+            if (u != v)
+              m_adj1[--m_start1[v]] = u;
+          }
+        }
+      }
+
+      struct by_color
+      {
+        explicit by_color(const std::vector<std::size_t>& colors)
+          : m_colors(colors) { }
+        bool operator()(std::size_t a, std::size_t b) const
+        { return m_colors[a] < m_colors[b]; }
+        const std::vector<std::size_t>& m_colors;
+      };
+
+      // One cell per vertex invariant, in increasing order, all of them
+      // queued as splitters
+      void initial_partition()
+      {
+        for (std::size_t v = 0; v < m_n; ++v)
+          m_elems[v] = v;
+        std::stable_sort(m_elems.begin(), m_elems.end(), by_color(m_colors));
+        m_num_cells = 0;
+        for (std::size_t i = 0; i < m_n; ) {
+          std::size_t j = i;
+          while (j < m_n && m_colors[m_elems[j]] == m_colors[m_elems[i]]) {
+            m_pos[m_elems[j]] = j;
+            m_cell[m_elems[j]] = i;
+            ++j;
+          }
+          m_len[i] = j - i;
+          ++m_num_cells;
+          enqueue(i);
+          i = j;
+        }
+      }
+
+      void enqueue(std::size_t s)
+      {
+        m_in_queue[s] = 1;
+        m_queue.push_back(s);
+      }
+
+      void move_to(std::size_t v, std::size_t p)
+      {
+        std::size_t u = m_elems[p];
+        m_elems[m_pos[v]] = u;
+        m_pos[u] = m_pos[v];
+        m_elems[p] = v;
+        m_pos[v] = p;
+      }
+
+      void touch(std::size_t u, std::vector<std::size_t>& counts)
+      {
+        if (m_count1[u] == 0 && m_count2[u] == 0)
+          m_touched.push_back(u);
+        ++counts[u];
+      }
+
+      struct by_cell_and_counts
+      {
+        explicit by_cell_and_counts(const canonical_labeler& l) : m_l(l) { }
+        bool operator()(std::size_t a, std::size_t b) const
+        {
+          if (m_l.m_cell[a] != m_l.m_cell[b])
+            return m_l.m_cell[a] < m_l.m_cell[b];
+          if (m_l.m_count1[a] != m_l.m_count1[b])
+            return m_l.m_count1[a] < m_l.m_count1[b];
+          return m_l.m_count2[a] < m_l.m_count2[b];
+        }
+        const canonical_labeler& m_l;
+      };
+
+      bool same_counts(std::size_t a, std::size_t b) const
+      {
+        return m_count1[a] == m_count1[b] && m_count2[a] == m_count2[b];
+      }
+
+      // Makes the partition equitable with respect to the queued cells:
+      // every cell is split by the number of edges from and to the
+      // splitter (Hopcroft's rule decides which pieces are queued).
+      // Returns a hash of the splits, which depends only on the partition.
+      boost::uint64_t refine()
+      {
+        boost::uint64_t trace = m_num_cells;
+        for (std::size_t head = 0; head < m_queue.size(); ++head) {
+          const std::size_t w = m_queue[head];
+          m_in_queue[w] = 0;
+          const std::size_t w_len = m_len[w];
+          for (std::size_t i = w; i < w + w_len; ++i) {
+            const std::size_t v = m_elems[i];
+            for (std::size_t k = m_start1[v]; k < m_start1[v + 1]; ++k)
+              touch(m_adj1[k], m_count1);
+            for (std::size_t k = m_start2[v]; k < m_start2[v + 1]; ++k)
+              touch(m_adj2[k], m_count2);
+          }
+          std::sort(m_touched.begin(), m_touched.end(),
+                    by_cell_and_counts(*this));
+
+          for (std::size_t a = 0; a < m_touched.size(); ) {
+            const std::size_t x = m_cell[m_touched[a]], x_len = m_len[x];
+            std::size_t b = a;
+            while (b < m_touched.size() && m_cell[m_touched[b]] == x)
+              ++b;
+            const std::size_t t = b - a;
+            if (x_len > 1 && (t < x_len || !same_counts(m_touched[a],
+                                                         m_touched[b - 1])))
+              trace = split(trace, x, a, b);
+            a = b;
+          }
+
+          for (std::size_t i = 0; i < m_touched.size(); ++i)
+            m_count1[m_touched[i]] = m_count2[m_touched[i]] = 0;
+          m_touched.clear();
+          trace = combine(trace, w);
+        }
+        m_queue.clear();
+        return trace;
+      }
+
+      // Splits cell x, whose touched vertices are m_touched[a, b) in
+      // increasing order of counts: the untouched vertices stay first.
+      boost::uint64_t split(boost::uint64_t trace, std::size_t x,
+                            std::size_t a, std::size_t b)
+      {
+        const std::size_t x_len = m_len[x], t = b - a;
+        for (std::size_t j = 0; j < t; ++j)
+          move_to(m_touched[a + j], x + x_len - t + j);
+
+        // The pieces, as starts
+        m_pieces.clear();
+        if (t < x_len)
+          m_pieces.push_back(x);
+        for (std::size_t j = 0; j < t; ++j)
+          if (j == 0 || !same_counts(m_touched[a + j - 1], m_touched[a + j]))
+            m_pieces.push_back(x + x_len - t + j);
+        m_pieces.push_back(x + x_len);
+
+        std::size_t largest = 0;
+        for (std::size_t k = 0; k + 1 < m_pieces.size(); ++k)
+          if (m_pieces[k + 1] - m_pieces[k]
+              > m_pieces[largest + 1] - m_pieces[largest])
+            largest = k;
+
+        const bool x_queued = m_in_queue[x] != 0;
+        trace = combine(trace, x);
+        for (std::size_t k = 0; k + 1 < m_pieces.size(); ++k) {
+          const std::size_t p = m_pieces[k], p_len = m_pieces[k + 1] - p;
+          const std::size_t v = m_elems[p];
+          trace = combine(combine(combine(trace, p_len), m_count1[v]),
+                          m_count2[v]);
+          m_len[p] = p_len;
+          if (p != x) {
+            for (std::size_t i = p; i < p + p_len; ++i)
+              m_cell[m_elems[i]] = p;
+            m_trail.push_back(std::make_pair(x, p));
+            ++m_num_cells;
+          }
+          if (x_queued ? p != x : k != largest)
+            enqueue(p);
+        }
+        return trace;
+      }
+
+      // Merges the cells split since the trail had size mark.
+      void undo(std::size_t mark)
+      {
+        while (m_trail.size() > mark) {
+          const std::size_t x = m_trail.back().first, p = m_trail.back().second;
+          m_trail.pop_back();
+          for (std::size_t i = p; i < p + m_len[p]; ++i)
+            m_cell[m_elems[i]] = x;
+          m_len[x] += m_len[p];
+          --m_num_cells;
+        }
+      }
+
+      // Makes v a cell of its own at the start of its cell.
+      void individualize(std::size_t v)
+      {
+        const std::size_t s = m_cell[v], s_len = m_len[s];
+        move_to(v, s);
+        for (std::size_t i = s + 1; i < s + s_len; ++i)
+          m_cell[m_elems[i]] = s + 1;
+        m_len[s] = 1;
+        m_len[s + 1] = s_len - 1;
+        m_trail.push_back(std::make_pair(s, s + 1));
+        ++m_num_cells;
+        enqueue(s);
+      }
+
+      // The cells of the children: the first one that is not a singleton
+      std::size_t target_cell() const
+      {
+        std::size_t s = 0;
+        while (m_len[s] == 1)
+          s += 1;
+        return s;
+      }
+
+      // Labels of the current leaf and its labeled graph, in m_edges_buffer
+      void labeled_graph()
+      {
+        m_edges_buffer.resize(m_edges.size());
+        for (std::size_t i = 0; i < m_edges.size(); ++i) {
+          std::size_t a = m_pos[m_edges[i].first], b = m_pos[m_edges[i].second];
+          if (!m_directed && b < a)
+            std::swap(a, b);
+          m_edges_buffer[i] = std::make_pair(a, b);
+        }
+        std::sort(m_edges_buffer.begin(), m_edges_buffer.end());
+      }
+
+      void make_best()
+      {
+        m_have_best = true;
+        m_best_pos = m_pos;
+        m_best_edges.swap(m_edges_buffer);
+        m_best_trace = m_trace;
+        m_best_path.resize(m_path.size());
+        for (std::size_t k = 0; k < m_path.size(); ++k) {
+          m_path[k].better = false;
+          m_best_path[k] = m_path[k].chosen;
+        }
+      }
+
+      // A leaf that is better than the best one if better is true, and
+      // has the same refinements otherwise
+      void leaf(bool better)
+      {
+        labeled_graph();
+        if (!m_have_best || better || m_trace.size() < m_best_trace.size()) {
+          make_best();
+          return;
+        }
+        if (m_edges_buffer < m_best_edges) {
+          make_best();
+        } else if (m_edges_buffer == m_best_edges) {
+          // An automorphism gamma: v goes to the vertex whose best label is
+          // the label of v.  Only the vertices it moves are kept.
+          m_inverse.resize(m_n);
+          for (std::size_t v = 0; v < m_n; ++v)
+            m_inverse[m_best_pos[v]] = v;
+          m_generators.push_back(generator());
+          for (std::size_t v = 0; v < m_n; ++v)
+            if (m_inverse[m_pos[v]] != v)
+              m_generators.back().push_back(std::make_pair(v, m_inverse[m_pos[v]]));
+
+          // gamma maps the subtree of the current path below the node
+          // where it leaves the path of the best leaf onto the subtree of
+          // the best path, which has been searched: go back to that node.
+          std::size_t k = 0;
+          while (k + 1 < m_path.size() && m_path[k].chosen == m_best_path[k])
+            ++k;
+          m_path.resize(k + 1);
+        }
+      }
+
+      std::size_t find(std::size_t i)
+      {
+        while (m_parent[i] != i)
+          i = m_parent[i] = m_parent[m_parent[i]];
+        return i;
+      }
+
+      // The next child of the node at depth d that is neither tried nor
+      // in the orbit of a tried child under the automorphisms found so
+      // far that fix the individualized vertices above it; returns false
+      // if there is none.
+      bool next_candidate(std::size_t d, std::size_t& chosen)
+      {
+        node& nd = m_path[d];
+        const std::size_t c = nd.candidates.size();
+        m_parent.resize(c);
+        for (std::size_t i = 0; i < c; ++i) {
+          m_parent[i] = i;
+          m_local[nd.candidates[i]] = i;
+        }
+        for (std::size_t k = 0; k < d; ++k)
+          m_on_path[m_path[k].chosen] = 1;
+        for (std::size_t g = 0; g < m_generators.size(); ++g) {
+          const generator& gamma = m_generators[g];
+          bool fixes = true;
+          for (std::size_t k = 0; k < gamma.size() && fixes; ++k)
+            fixes = !m_on_path[gamma[k].first];
+          if (!fixes)
+            continue;
+          // The automorphism preserves the partition, so it maps the
+          // candidates among themselves.
+          for (std::size_t k = 0; k < gamma.size(); ++k) {
+            const std::size_t i = m_local[gamma[k].first];
+            if (i >= c || nd.candidates[i] != gamma[k].first)
+              continue;
+            const std::size_t j = m_local[gamma[k].second];
+            BOOST_ASSERT(j < c && nd.candidates[j] == gamma[k].second);
+            std::size_t a = find(i), b = find(j);
+            if (a != b)
+              m_parent[(std::max)(a, b)] = (std::min)(a, b);
+          }
+        }
+        for (std::size_t k = 0; k < d; ++k)
+          m_on_path[m_path[k].chosen] = 0;
+        m_orbit_tried.assign(c, 0);
+        for (std::size_t i = 0; i < c; ++i)
+          if (nd.tried[i])
+            m_orbit_tried[find(i)] = 1;
+        for (std::size_t i = 0; i < c; ++i)
+          if (!nd.tried[i] && !m_orbit_tried[find(i)]) {
+            nd.tried[i] = 1;
+            chosen = nd.candidates[i];
+            return true;
+          }
+        return false;
+      }
+
+      void open_node(bool better)
+      {
+        m_path.push_back(node());
+        node& nd = m_path.back();
+        const std::size_t s = target_cell();
+        nd.candidates.assign(m_elems.begin() + s, m_elems.begin() + s + m_len[s]);
+        nd.tried.assign(nd.candidates.size(), 0);
+        nd.trail_mark = m_trail.size();
+        nd.active = false;
+        nd.better = better;
+      }
+
+      void search()
+      {
+        open_node(false);
+        while (!m_path.empty()) {
+          const std::size_t d = m_path.size() - 1;
+          if (m_path[d].active) {
+            undo(m_path[d].trail_mark);
+            m_trace.resize(d);
+            m_path[d].active = false;
+          }
+          std::size_t v;
+          if (!next_candidate(d, v)) {
+            m_path.pop_back();
+            continue;
+          }
+          m_path[d].chosen = v;
+          m_path[d].active = true;
+          individualize(v);
+          m_trace.push_back(refine());
+
+          // Compare the refinements with those of the best leaf.
+          bool better = m_path[d].better;
+          if (m_have_best && !better) {
+            if (d >= m_best_trace.size() || m_trace[d] > m_best_trace[d])
+              continue;
+            better = m_trace[d] < m_best_trace[d];
+          }
+          if (m_num_cells == m_n)
+            leaf(better);
+          else
+            open_node(better);
+        }
+      }
+
+      std::size_t m_n;
+      bool m_directed;
+      std::vector<std::size_t> m_colors;
+      std::vector<edge_type> m_edges;
+      std::vector<std::size_t> m_start1, m_adj1, m_start2, m_adj2;
+
+      std::vector<std::size_t> m_elems, m_pos, m_cell, m_len;
+      std::size_t m_num_cells;
+      std::vector<std::pair<std::size_t, std::size_t> > m_trail;
+      std::vector<std::size_t> m_queue;
+      std::vector<char> m_in_queue;
+      std::vector<std::size_t> m_count1, m_count2, m_touched, m_pieces;
+
+      std::vector<node> m_path;
+      std::vector<boost::uint64_t> m_trace, m_best_trace;
+      typedef std::vector<std::pair<std::size_t, std::size_t> > generator;
+      std::vector<generator> m_generators;
+      std::vector<char> m_on_path;
+      std::vector<std::size_t> m_local, m_parent, m_inverse;
+      std::vector<char> m_orbit_tried;
+
+      bool m_have_best;
+      std::vector<std::size_t> m_best_pos, m_best_path;
+      std::vector<edge_type> m_edges_buffer, m_best_edges;
+    };
+
+  } // namespace detail
+
+  // Computes a canonical labeling of g: labeling receives a label in
+  // [0, num_vertices(g)) for each vertex, such that isomorphic graphs
+  // whose isomorphism preserves invariant have the same labeled copy.
+  // Returns that copy, the canonical form, as a certificate.
+  template <typename Graph, typename CanonicalLabelMap,
+            typename VertexIndexMap, typename VertexInvariant>
+  graph_certificate
+  canonical_labeling(const Graph& g, CanonicalLabelMap labeling,
+                     VertexIndexMap index_map, VertexInvariant invariant)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( EdgeListGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_t;
+    BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<VertexIndexMap,
+                           vertex_t> ));
+    BOOST_CONCEPT_ASSERT(( WritablePropertyMapConcept<CanonicalLabelMap,
+                           vertex_t> ));
+
+    const std::size_t n = num_vertices(g);
+    std::vector<std::size_t> colors(n);
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      colors[get(index_map, *vi)] = static_cast<std::size_t>(invariant(*vi));
+    std::vector<graph_certificate::edge_type> edge_list;
+    edge_list.reserve(num_edges(g));
+    typename graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      edge_list.push_back(std::make_pair(get(index_map, source(*ei, g)),
+                                         get(index_map, target(*ei, g))));
+
+    detail::canonical_labeler labeler(n, is_directed(g), colors, edge_list);
+    std::vector<std::size_t> labels;
+    graph_certificate certificate;
+    labeler.run(labels, certificate);
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      put(labeling, *vi, labels[get(index_map, *vi)]);
+    return certificate;
+  }
+
+  template <typename Graph, typename CanonicalLabelMap,
+            typename P, typename T, typename R>
+  graph_certificate
+  canonical_labeling(const Graph& g, CanonicalLabelMap labeling,
+                     const bgl_named_params<P, T, R>& params)
+  {
+    return canonical_labeling
+      (g, labeling,
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       choose_param(get_param(params, vertex_invariant_t()),
+                    detail::constant_vertex_invariant()));
+  }
+
+  template <typename Graph, typename CanonicalLabelMap>
+  graph_certificate
+  canonical_labeling(const Graph& g, CanonicalLabelMap labeling)
+  {
+    return canonical_labeling(g, labeling, get(vertex_index, g),
+                              detail::constant_vertex_invariant());
+  }
+
+  // The canonical form of g, without the labeling
+  template <typename Graph, typename P, typename T, typename R>
+  graph_certificate
+  canonical_certificate(const Graph& g, const bgl_named_params<P, T, R>& params)
+  {
+    return canonical_labeling(g, dummy_property_map(), params);
+  }
+
+  template <typename Graph>
+  graph_certificate canonical_certificate(const Graph& g)
+  {
+    return canonical_labeling(g, dummy_property_map());
+  }
+
+  // Tests whether g1 and g2 are isomorphic by comparing their canonical
+  // forms, and if they are, writes the isomorphism to iso_map.  The vertex
+  // invariants, if given, must be preserved by the isomorphism.  Each
+  // graph is labeled once, so when many graphs are compared it is faster
+  // to keep their certificates and compare those.
+  template <typename Graph1, typename Graph2, typename IsoMap,
+            typename IndexMap1, typename IndexMap2,
+            typename Invariant1, typename Invariant2>
+  bool canonical_isomorphism(const Graph1& g1, const Graph2& g2,
+                             IsoMap iso_map,
+                             IndexMap1 index_map1, IndexMap2 index_map2,
+                             Invariant1 invariant1, Invariant2 invariant2)
+  {
+    typedef typename graph_traits<Graph2>::vertex_descriptor vertex2_t;
+    if (num_vertices(g1) != num_vertices(g2))
+      return false;
+    const std::size_t n = num_vertices(g1);
+    std::vector<std::size_t> labels1(n), labels2(n);
+    typedef typename property_traits<IndexMap1>::value_type index1_t;
+    typedef typename property_traits<IndexMap2>::value_type index2_t;
+    if (canonical_labeling(g1, make_iterator_property_map(labels1.begin(),
+                                                          index_map1,
+                                                          index1_t()),
+                           index_map1, invariant1)
+        != canonical_labeling(g2, make_iterator_property_map(labels2.begin(),
+                                                             index_map2,
+                                                             index2_t()),
+                              index_map2, invariant2))
+      return false;
+
+    std::vector<vertex2_t> by_label(n);
+    typename graph_traits<Graph2>::vertex_iterator vi2, vi2_end;
+    for (boost::tie(vi2, vi2_end) = vertices(g2); vi2 != vi2_end; ++vi2)
+      by_label[labels2[get(index_map2, *vi2)]] = *vi2;
+    typename graph_traits<Graph1>::vertex_iterator vi1, vi1_end;
+    for (boost::tie(vi1, vi1_end) = vertices(g1); vi1 != vi1_end; ++vi1)
+      put(iso_map, *vi1, by_label[labels1[get(index_map1, *vi1)]]);
+    return true;
+  }
+
+  template <typename Graph1, typename Graph2, typename IsoMap,
+            typename P, typename T, typename R>
+  bool canonical_isomorphism(const Graph1& g1, const Graph2& g2,
+                             IsoMap iso_map,
+                             const bgl_named_params<P, T, R>& params)
+  {
+    return canonical_isomorphism
+      (g1, g2, iso_map,
+       choose_const_pmap(get_param(params, vertex_index1), g1, vertex_index),
+       choose_const_pmap(get_param(params, vertex_index2), g2, vertex_index),
+       choose_param(get_param(params, vertex_invariant1_t()),
+                    detail::constant_vertex_invariant()),
+       choose_param(get_param(params, vertex_invariant2_t()),
+                    detail::constant_vertex_invariant()));
+  }
+
+  template <typename Graph1, typename Graph2, typename IsoMap>
+  bool canonical_isomorphism(const Graph1& g1, const Graph2& g2,
+                             IsoMap iso_map)
+  {
+    return canonical_isomorphism(g1, g2, iso_map,
+                                 get(vertex_index, g1), get(vertex_index, g2),
+                                 detail::constant_vertex_invariant(),
+                                 detail::constant_vertex_invariant());
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CANONICAL_LABELING_HPP
@@ -0,0 +1,407 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+//
+// The cost scaling push-relabel method of Goldberg and Tarjan, "Finding
+// minimum-cost circulations by successive approximation", Mathematics of
+// Operations Research 15 (1990), in the form of Goldberg's "An efficient
+// implementation of a scaling minimum-cost flow algorithm", J. Algorithms
+// 22 (1997).
+
+#ifndef BOOST_GRAPH_COST_SCALING_MIN_COST_FLOW_HPP
+#define BOOST_GRAPH_COST_SCALING_MIN_COST_FLOW_HPP
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/find_flow_cost.hpp>
+
+namespace boost {
+
+namespace detail {
+
+// Refines a flow that is epsilon-optimal for the current prices into one
+// that is epsilon/alpha-optimal, until epsilon drops below 1/n.  The costs
+// are multiplied by n + 1 so that all of this can be done in integers.
+// Scaled costs, prices and epsilon can then exceed the weight type, so
+// they are computed in boost::intmax_t.
+template <class Graph, class Weight, class Reversed, class ResidualCapacity,
+          class Price, class VertexIndex>
+class cost_scaling_min_cost_flow_impl
+{
+    typedef graph_traits<Graph> GTraits;
+    typedef typename GTraits::vertex_descriptor vertex_descriptor;
+    typedef typename GTraits::edge_descriptor edge_descriptor;
+    typedef typename GTraits::out_edge_iterator out_edge_iterator;
+    typedef typename GTraits::vertex_iterator vertex_iterator;
+    typedef typename property_traits<ResidualCapacity>::value_type FlowValue;
+    typedef typename property_traits<Weight>::value_type Cost;
+    typedef typename property_traits<Price>::value_type PriceValue;
+    typedef boost::intmax_t price_type;
+
+    BOOST_STATIC_ASSERT(std::numeric_limits<Cost>::is_integer);
+
+    // The factor by which epsilon shrinks in every phase.
+    static const int alpha = 16;
+
+public:
+    cost_scaling_min_cost_flow_impl(const Graph& g, Weight weight,
+                                    Reversed rev,
+                                    ResidualCapacity residual_capacity,
+                                    Price price, VertexIndex index)
+      : m_g(g), m_weight(weight), m_rev(rev), m_res(residual_capacity),
+        m_price(price), m_index(index), m_n(num_vertices(g)),
+        m_scale(price_type(m_n + 1)), m_excess(m_n), m_current(m_n),
+        m_active(m_n), m_head(0), m_size(0), m_queued(m_n, false),
+        m_relabels(0), m_label(m_n), m_scanned(m_n), m_buckets(m_n + 1) { }
+
+    void run()
+    {
+        price_type max_cost = 0;
+        vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+            put(m_price, *vi, PriceValue(0));
+            out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, m_g); ei != ei_end; ++ei) {
+                price_type c = price_type(get(m_weight, *ei));
+                max_cost = (std::max)(max_cost, c < 0 ? price_type(-c) : c);
+            }
+        }
+        if (max_cost == 0)
+            return;
+
+        // The prices stay within about max_cost (n + 1) n, and the reduced
+        // costs within a small multiple of that.  Leave room for a factor
+        // of four, in price_type and in the price map.
+        price_type limit = (std::numeric_limits<price_type>::max)();
+        if (std::numeric_limits<PriceValue>::is_integer
+            && price_type((std::numeric_limits<PriceValue>::max)()) < limit)
+            limit = price_type((std::numeric_limits<PriceValue>::max)());
+        if (max_cost > limit / 4 / m_scale / price_type(m_n))
+            BOOST_THROW_EXCEPTION(std::overflow_error(
+                "cost_scaling_min_cost_flow: the weights times "
+                "(|V| + 1) |V| overflow the price type"));
+
+        // With zero prices every flow is (max_cost * scale)-optimal.
+        price_type epsilon = max_cost * m_scale;
+        do {
+            epsilon = (std::max)(price_type(epsilon / alpha), price_type(1));
+            refine(epsilon);
+        } while (epsilon > 1);
+    }
+
+private:
+    price_type price(vertex_descriptor v) const
+    {
+        return price_type(get(m_price, v));
+    }
+
+    price_type reduced_cost(edge_descriptor e) const
+    {
+        return price_type(get(m_weight, e)) * m_scale + price(source(e, m_g))
+            - price(target(e, m_g));
+    }
+
+    std::size_t idx(vertex_descriptor v) const { return get(m_index, v); }
+
+    void push(edge_descriptor e, FlowValue delta)
+    {
+        put(m_res, e, get(m_res, e) - delta);
+        edge_descriptor r = get(m_rev, e);
+        put(m_res, r, get(m_res, r) + delta);
+        m_excess[idx(source(e, m_g))] -= delta;
+        vertex_descriptor w = target(e, m_g);
+        m_excess[idx(w)] += delta;
+        if (m_excess[idx(w)] > 0)
+            enqueue(w);
+    }
+
+    void enqueue(vertex_descriptor v)
+    {
+        if (m_queued[idx(v)])
+            return;
+        m_queued[idx(v)] = true;
+        std::size_t tail = m_head + m_size++;
+        m_active[tail < m_n ? tail : tail - m_n] = v;
+    }
+
+    vertex_descriptor dequeue()
+    {
+        vertex_descriptor v = m_active[m_head];
+        if (++m_head == m_n)
+            m_head = 0;
+        --m_size;
+        m_queued[idx(v)] = false;
+        return v;
+    }
+
+    void refine(price_type epsilon)
+    {
+        // Saturating every arc of negative reduced cost makes the flow
+        // 0-optimal, at the price of excesses and deficits.
+        vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi)
+            m_excess[idx(*vi)] = 0;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+            out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, m_g); ei != ei_end; ++ei) {
+                FlowValue r = get(m_res, *ei);
+                if (r > 0 && reduced_cost(*ei) < 0)
+                    push(*ei, r);
+            }
+        }
+
+        price_update(epsilon);
+        while (m_size > 0) {
+            if (m_relabels >= m_n)
+                price_update(epsilon);
+            discharge(dequeue(), epsilon);
+        }
+    }
+
+    // The global price update heuristic: lowers the prices by epsilon times
+    // the distance to the nearest deficit, where a residual arc of reduced
+    // cost c is floor(c / epsilon) + 1 long (0 if c < 0).  This is Dial's
+    // algorithm run backwards over the reverse arcs; it stops once every
+    // vertex with excess has its distance, and all vertices not reached by
+    // then get the last distance.  The flow stays epsilon-optimal.
+    void price_update(price_type epsilon)
+    {
+        const std::size_t unreached = (std::numeric_limits<std::size_t>::max)();
+        std::size_t remaining = 0;
+        vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+            std::size_t i = idx(*vi);
+            m_label[i] = unreached;
+            m_scanned[i] = false;
+            if (m_excess[i] < 0) {
+                m_label[i] = 0;
+                m_buckets[0].push_back(*vi);
+            } else if (m_excess[i] > 0) {
+                ++remaining;
+            }
+        }
+
+        std::size_t level = 0;
+        for (; remaining > 0 && level <= m_n; ++level) {
+            std::vector<vertex_descriptor>& bucket = m_buckets[level];
+            // Entries are not removed when a vertex moves to a lower bucket.
+            for (std::size_t k = 0; k < bucket.size() && remaining > 0; ++k) {
+                vertex_descriptor w = bucket[k];
+                std::size_t j = idx(w);
+                if (m_scanned[j] || m_label[j] != level)
+                    continue;
+                m_scanned[j] = true;
+                if (m_excess[j] > 0 && --remaining == 0)
+                    break;
+                out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(w, m_g); ei != ei_end; ++ei) {
+                    edge_descriptor e = get(m_rev, *ei);
+                    vertex_descriptor v = source(e, m_g);
+                    std::size_t i = idx(v);
+                    if (m_scanned[i] || get(m_res, e) <= 0)
+                        continue;
+                    price_type c = reduced_cost(e);
+                    price_type length =
+                        c < 0 ? price_type(0) : price_type(c / epsilon + 1);
+                    if (length > price_type(m_n - level))
+                        continue;
+                    std::size_t l = level + std::size_t(length);
+                    if (l < m_label[i]) {
+                        m_label[i] = l;
+                        m_buckets[l].push_back(v);
+                    }
+                }
+            }
+            if (remaining == 0)
+                break;
+        }
+        for (std::size_t l = 0; l <= m_n; ++l)
+            m_buckets[l].clear();
+
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+            std::size_t i = idx(*vi);
+            std::size_t l = m_scanned[i] ? m_label[i] : level;
+            if (l > 0)
+                put(m_price, *vi, PriceValue(price(*vi) - price_type(l) * epsilon));
+            m_current[i] = out_edges(*vi, m_g).first;
+        }
+        m_relabels = 0;
+    }
+
+    // Pushes the excess of v over admissible arcs, i.e. residual arcs of
+    // negative reduced cost, and lowers the price of v when there are none.
+    void discharge(vertex_descriptor v, price_type epsilon)
+    {
+        out_edge_iterator& current = m_current[idx(v)];
+        out_edge_iterator ei_end = out_edges(v, m_g).second;
+        while (m_excess[idx(v)] > 0) {
+            for (; current != ei_end; ++current) {
+                FlowValue r = get(m_res, *current);
+                if (r > 0 && reduced_cost(*current) < 0) {
+                    // Look ahead: rather than pushing to a vertex that
+                    // would have to be relabeled before passing the flow
+                    // on, relabel it now.
+                    vertex_descriptor w = target(*current, m_g);
+                    if (m_excess[idx(w)] >= 0 && !has_admissible_arc(w)
+                        && relabel(w, epsilon)
+                        && reduced_cost(*current) >= 0)
+                        continue;
+                    push(*current, (std::min)(r, m_excess[idx(v)]));
+                    if (m_excess[idx(v)] == 0)
+                        return;
+                }
+            }
+            // The excess of v arrived over arcs whose reverses are
+            // residual.
+            bool relabeled = relabel(v, epsilon);
+            BOOST_ASSERT(relabeled);
+            ignore_unused_variable_warning(relabeled);
+        }
+    }
+
+    // Advances the current arc of v to its first admissible arc, if any.
+    bool has_admissible_arc(vertex_descriptor v)
+    {
+        out_edge_iterator& current = m_current[idx(v)];
+        out_edge_iterator ei_end = out_edges(v, m_g).second;
+        for (; current != ei_end; ++current)
+            if (get(m_res, *current) > 0 && reduced_cost(*current) < 0)
+                return true;
+        return false;
+    }
+
+    // Makes the cheapest residual arc out of v admissible with reduced cost
+    // -epsilon, which keeps the flow epsilon-optimal.  Returns false if v
+    // has no residual arcs.
+    bool relabel(vertex_descriptor v, price_type epsilon)
+    {
+        bool found = false;
+        price_type best = 0;
+        out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g); ei != ei_end; ++ei)
+            if (get(m_res, *ei) > 0) {
+                price_type p = price(target(*ei, m_g))
+                    - price_type(get(m_weight, *ei)) * m_scale;
+                if (!found || p > best) {
+                    best = p;
+                    found = true;
+                }
+            }
+        if (found) {
+            put(m_price, v, PriceValue(best - epsilon));
+            m_current[idx(v)] = out_edges(v, m_g).first;
+            ++m_relabels;
+        }
+        return found;
+    }
+
+    const Graph& m_g;
+    Weight m_weight;
+    Reversed m_rev;
+    ResidualCapacity m_res;
+    Price m_price;
+    VertexIndex m_index;
+    std::size_t m_n;
+    price_type m_scale;
+    std::vector<FlowValue> m_excess;
+    std::vector<out_edge_iterator> m_current;
+
+    // FIFO of the vertices with positive excess; each is queued at most
+    // once, so a ring of n slots suffices.
+    std::vector<vertex_descriptor> m_active;
+    std::size_t m_head, m_size;
+    std::vector<bool> m_queued;
+
+    std::size_t m_relabels;
+    std::vector<std::size_t> m_label;
+    std::vector<bool> m_scanned;
+    std::vector<std::vector<vertex_descriptor> > m_buckets;
+};
+
+} // namespace detail
+
+
+template <class Graph, class Weight, class Reversed, class ResidualCapacity,
+          class Price, class VertexIndex>
+void cost_scaling_min_cost_flow(const Graph &g, Weight weight, Reversed rev,
+                                ResidualCapacity residual_capacity,
+                                Price price, VertexIndex index) {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    if (num_vertices(g) == 0)
+        return;
+    detail::cost_scaling_min_cost_flow_impl<Graph, Weight, Reversed,
+        ResidualCapacity, Price, VertexIndex>
+        impl(g, weight, rev, residual_capacity, price, index);
+    impl.run();
+}
+
+
+//in this namespace argument dispatching takes place
+namespace detail {
+
+template <class Graph, class Weight, class Reversed, class ResidualCapacity, class Price, class VertexIndex>
+void cost_scaling_min_cost_flow_dispatch(
+        const Graph &g,
+        Weight weight,
+        Reversed rev,
+        ResidualCapacity residual_capacity,
+        VertexIndex index,
+        Price price) {
+    cost_scaling_min_cost_flow(g, weight, rev, residual_capacity, price, index);
+}
+
+//setting default price map
+template <class Graph, class Weight, class Reversed, class ResidualCapacity, class VertexIndex>
+void cost_scaling_min_cost_flow_dispatch(
+        const Graph &g,
+        Weight weight,
+        Reversed rev,
+        ResidualCapacity residual_capacity,
+        VertexIndex index,
+        param_not_found) {
+    std::vector<boost::intmax_t> p_map(num_vertices(g));
+
+    cost_scaling_min_cost_flow(g, weight, rev, residual_capacity,
+                               make_iterator_property_map(p_map.begin(), index), index);
+}
+
+}//detail
+
+template <class Graph, class P, class T, class R>
+void cost_scaling_min_cost_flow(Graph &g,
+        const bgl_named_params<P, T, R>& params) {
+    detail::cost_scaling_min_cost_flow_dispatch(g,
+           choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+           choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+           choose_pmap(get_param(params, edge_residual_capacity),
+                       g, edge_residual_capacity),
+           choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+           get_param(params, vertex_distance));
+}
+
+template <class Graph>
+void cost_scaling_min_cost_flow(Graph &g) {
+    bgl_named_params<int, buffer_param_t> params(0);
+    cost_scaling_min_cost_flow(g, params);
+}
+
+}//boost
+
+#endif /* BOOST_GRAPH_COST_SCALING_MIN_COST_FLOW_HPP */
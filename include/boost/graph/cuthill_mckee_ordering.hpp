@@ -14,7 +14,9 @@
 #include <boost/config.hpp>
 #include <boost/graph/detail/sparse_ordering.hpp>
 #include <boost/graph/graph_utility.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <algorithm>
+#include <vector>
 
 
 /*
@@ -182,6 +184,287 @@ namespace boost {
   inline OutputIterator 
   cuthill_mckee_ordering(const Graph& G, OutputIterator permutation)
   { return cuthill_mckee_ordering(G, permutation, get(vertex_index, G)); }
+
+  namespace detail {
+
+    // Level-synchronous breadth-first search for the parallel
+    // Cuthill-McKee ordering and its starting node.  The level being
+    // expanded occupies order[first, last).  Each unreached vertex
+    // adjacent to the level is claimed by the first vertex of the level
+    // adjacent to it, which then appends its children in the order of its
+    // out-edges, sorted by degree if requested: this is the queue order
+    // of breadth_first_visit() with bfs_rcm_visitor.  owner[v] is one
+    // plus the position of the parent of v, or 0 for a source, so v was
+    // reached before the level iff owner[v] <= first.  Small levels, and
+    // all levels on one thread, are expanded in a single pass instead.
+    template <typename Graph, typename DegreeMap, typename IndexMap>
+    class rcm_level_search
+    {
+    public:
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+
+      rcm_level_search(const Graph& g, DegreeMap degree, IndexMap index,
+                       std::size_t num_threads)
+        : m_g(g), m_degree(degree), m_index(index),
+          m_num_threads(resolve_number_of_threads(num_threads)),
+          m_owner(num_vertices(g)), m_mark(num_vertices(g), 0)
+      {
+        for (std::size_t i = 0; i < num_vertices(g); ++i)
+          m_owner.set(i, unreached());
+      }
+
+      bool reached(Vertex v) const
+      { return m_owner.load(get(m_index, v)) != unreached(); }
+
+      // Appends the vertices reachable from s to order(), level by
+      // level, and returns the number of levels; last_level is where the
+      // last one starts.
+      std::size_t search(Vertex s, bool sort, std::size_t& last_level)
+      {
+        std::size_t first = m_order.size(), levels = 0;
+        m_owner.set(get(m_index, s), 0);
+        m_order.push_back(s);
+        m_sort = sort;
+        while (first != m_order.size()) {
+          ++levels;
+          last_level = m_first = first;
+          const std::size_t last = m_order.size(), size = last - first;
+          m_count.resize(size);
+          if (m_num_threads == 1 || size <= 64) {
+            // the parents claim their children in order
+            m_phase = expand;
+            for (std::size_t i = 0; i < size; ++i)
+              (*this)(i, 0);
+            first = last;
+            continue;
+          }
+          m_phase = claim;
+          parallel_for(size, *this, m_num_threads, 64);
+          m_phase = count;
+          parallel_for(size, *this, m_num_threads, 64);
+          std::size_t total = 0;
+          for (std::size_t i = 0; i < size; ++i) {
+            std::size_t children = m_count[i];
+            m_count[i] = last + total;
+            total += children;
+          }
+          m_order.resize(last + total);
+          m_phase = append;
+          parallel_for(size, *this, m_num_threads, 64);
+          first = last;
+        }
+        return levels;
+      }
+
+      // Forgets the vertices reached, for a search from another source.
+      void clear()
+      {
+        m_phase = reset;
+        parallel_for(m_order.size(), *this, m_num_threads, 1024);
+        m_order.clear();
+      }
+
+      const std::vector<Vertex>& order() const { return m_order; }
+
+      void operator()(std::size_t i, std::size_t)
+      {
+        if (m_phase == reset) {
+          std::size_t v = get(m_index, m_order[i]);
+          m_owner.set(v, unreached());
+          m_mark[v] = 0;
+          return;
+        }
+        const std::size_t parent = m_first + i + 1;
+        if (m_phase == expand)
+          m_count[i] = m_order.size();
+        std::size_t children = 0, position = m_count[i];
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(m_order[m_first + i], m_g);
+             ei != ei_end; ++ei) {
+          Vertex w = target(*ei, m_g);
+          std::size_t v = get(m_index, w);
+          if (m_phase == expand) {
+            if (m_owner.load(v) == unreached()) {
+              m_owner.set(v, parent);
+              m_order.push_back(w);
+            }
+          } else if (m_phase == claim) {
+            std::size_t o = m_owner.load(v);
+            while (o > parent && !m_owner.compare_and_set(v, o, parent))
+              o = m_owner.load(v);
+          } else if (m_owner.load(v) == parent) {
+            // the mark skips parallel edges; only the owner touches it
+            if (m_phase == count && m_mark[v] == 0) {
+              m_mark[v] = 1;
+              ++children;
+            } else if (m_phase == append && m_mark[v] == 1) {
+              m_mark[v] = 2;
+              m_order[position++] = w;
+            }
+          }
+        }
+        if (m_phase == expand)
+          position = m_order.size();
+        if (m_phase == count)
+          m_count[i] = children;
+        else if (m_sort) {
+          typedef typename property_traits<DegreeMap>::value_type ds_type;
+          indirect_cmp<DegreeMap, std::less<ds_type> > comp(m_degree);
+          std::sort(m_order.begin() + m_count[i], m_order.begin() + position,
+                    comp);
+        }
+      }
+
+    private:
+      static std::size_t unreached() { return std::size_t(-1); }
+
+      enum phase { expand, claim, count, append, reset };
+
+      const Graph& m_g;
+      DegreeMap m_degree;
+      IndexMap m_index;
+      std::size_t m_num_threads;
+      parallel_counters m_owner;
+      std::vector<char> m_mark;
+      std::vector<Vertex> m_order;
+      std::vector<std::size_t> m_count;
+      std::size_t m_first;
+      phase m_phase;
+      bool m_sort;
+    };
+
+    // pseudo_peripheral_pair() with a level-synchronous search: the
+    // first vertex of least degree in the last level.
+    template <typename Search, typename Vertex, typename DegreeMap>
+    Vertex rcm_peripheral_pair(Search& search, Vertex u, std::size_t& ecc,
+                               DegreeMap degree)
+    {
+      std::size_t last_level;
+      ecc = search.search(u, false, last_level) - 1;
+      const std::vector<Vertex>& order = search.order();
+      Vertex w = order[last_level];
+      for (std::size_t i = last_level + 1; i < order.size(); ++i)
+        if (get(degree, order[i]) < get(degree, w))
+          w = order[i];
+      search.clear();
+      return w;
+    }
+
+    template <typename Search, typename Vertex, typename DegreeMap>
+    Vertex rcm_starting_node(Search& search, Vertex r, DegreeMap degree)
+    {
+      std::size_t eccen_r, eccen_x;
+      Vertex x = rcm_peripheral_pair(search, r, eccen_r, degree);
+      Vertex y = rcm_peripheral_pair(search, x, eccen_x, degree);
+      while (eccen_x > eccen_r) {
+        r = x;
+        eccen_r = eccen_x;
+        x = y;
+        y = rcm_peripheral_pair(search, x, eccen_x, degree);
+      }
+      return x;
+    }
+
+  } // namespace detail
+
+  // find_starting_node() with the breadth-first searches of each level
+  // run by num_threads threads (0 means one per hardware thread).  The
+  // result is the same.
+  template <class Graph, class Vertex, class DegreeMap, class VertexIndexMap>
+  Vertex find_starting_node_parallel(const Graph& G, Vertex r,
+                                     DegreeMap degree,
+                                     VertexIndexMap index_map,
+                                     std::size_t num_threads)
+  {
+    detail::rcm_level_search<Graph, DegreeMap, VertexIndexMap>
+      search(G, degree, index_map, num_threads);
+    return detail::rcm_starting_node(search, r, degree);
+  }
+
+  // Parallel (reverse) Cuthill-McKee ordering.
+  //
+  // The breadth-first search proceeds one level at a time: the vertices
+  // of a level claim their unreached neighbors, count and append them,
+  // and sort them by degree, with the level divided between num_threads
+  // threads (0 means one per hardware thread).  The vertices are written
+  // to permutation in the same order as by cuthill_mckee_ordering() with
+  // the same starting vertices; a starting vertex that an earlier search
+  // has already reached, which can only happen in a directed graph, is
+  // skipped.
+  template <class Graph, class OutputIterator, class DegreeMap,
+            class VertexIndexMap>
+  OutputIterator
+  cuthill_mckee_ordering_parallel(const Graph& g,
+                                  std::deque< typename
+                                  graph_traits<Graph>::vertex_descriptor >
+                                  vertex_queue,
+                                  OutputIterator permutation,
+                                  DegreeMap degree, VertexIndexMap index_map,
+                                  std::size_t num_threads)
+  {
+    detail::rcm_level_search<Graph, DegreeMap, VertexIndexMap>
+      search(g, degree, index_map, num_threads);
+    std::size_t last_level;
+    for (; !vertex_queue.empty(); vertex_queue.pop_front())
+      if (!search.reached(vertex_queue.front()))
+        search.search(vertex_queue.front(), true, last_level);
+    return std::copy(search.order().begin(), search.order().end(),
+                     permutation);
+  }
+
+  template <class Graph, class OutputIterator, class DegreeMap,
+            class VertexIndexMap>
+  OutputIterator
+  cuthill_mckee_ordering_parallel(const Graph& g,
+                                  typename graph_traits<Graph>::vertex_descriptor s,
+                                  OutputIterator permutation,
+                                  DegreeMap degree, VertexIndexMap index_map,
+                                  std::size_t num_threads)
+  {
+    std::deque< typename graph_traits<Graph>::vertex_descriptor > vertex_queue;
+    vertex_queue.push_front( s );
+    return cuthill_mckee_ordering_parallel(g, vertex_queue, permutation,
+                                           degree, index_map, num_threads);
+  }
+
+  // This is the version which selects its own starting vertices: the
+  // components are found in vertex order, like the depth-first searches
+  // of cuthill_mckee_ordering(), and their starting nodes by
+  // find_starting_node_parallel().
+  template <class Graph, class OutputIterator, class DegreeMap,
+            class VertexIndexMap>
+  OutputIterator
+  cuthill_mckee_ordering_parallel(const Graph& G, OutputIterator permutation,
+                                  DegreeMap degree, VertexIndexMap index_map,
+                                  std::size_t num_threads)
+  {
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+    detail::rcm_level_search<Graph, DegreeMap, VertexIndexMap>
+      components(G, degree, index_map, num_threads),
+      search(G, degree, index_map, num_threads);
+
+    std::deque<Vertex> vertex_queue;
+    std::size_t last_level;
+    BGL_FORALL_VERTICES_T(v, G, Graph) {
+      if (!components.reached(v)) {
+        components.search(v, false, last_level);
+        vertex_queue.push_back(detail::rcm_starting_node(search, v, degree));
+      }
+    }
+    return cuthill_mckee_ordering_parallel(G, vertex_queue, permutation,
+                                           degree, index_map, num_threads);
+  }
+
+  template<typename Graph, typename OutputIterator, typename VertexIndexMap>
+  OutputIterator
+  cuthill_mckee_ordering_parallel(const Graph& G, OutputIterator permutation,
+                                  VertexIndexMap index_map,
+                                  std::size_t num_threads)
+  {
+    return cuthill_mckee_ordering_parallel(G, permutation,
+                                           make_out_degree_map(G), index_map,
+                                           num_threads);
+  }
 } // namespace boost
 
 
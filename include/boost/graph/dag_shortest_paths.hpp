@@ -12,6 +12,7 @@
 
 #include <boost/graph/topological_sort.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 
 // single-source shortest paths for a Directed Acyclic Graph (DAG)
 
@@ -154,6 +155,222 @@ namespace boost {
        params);
   }
   
+  // Level-parallel variant
+  //
+  // Instead of a DFS finish order, the vertices reachable from s are
+  // grouped into the levels of topological_sort_levels().  All
+  // predecessors of a vertex lie on earlier levels, so the vertices of one
+  // level can compute their final distance from their in-edges
+  // concurrently, and no two threads ever write the same label.  As for
+  // dag_shortest_paths(), cycles that cannot be reached from s are
+  // allowed.  With distance_compare(std::greater<D>())
+  // and distance_inf set to the lowest value this computes longest
+  // (critical) paths, exactly like dag_shortest_paths().
+
+  namespace detail {
+
+    template <class Graph, class DistanceMap, class WeightMap,
+              class PredecessorMap, class Compare, class Combine>
+    struct dag_sp_level_body
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+      typedef typename property_traits<DistanceMap>::value_type D;
+
+      dag_sp_level_body(const std::vector<Vertex>& verts,
+                        const std::vector<std::size_t>& order,
+                        std::size_t first,
+                        const std::vector<std::size_t>& in_begin,
+                        const std::vector<std::size_t>& in_source,
+                        const std::vector<Edge>& in_edge,
+                        std::vector<char>& reached, DistanceMap distance,
+                        WeightMap weight, PredecessorMap pred,
+                        Compare compare, Combine combine)
+        : m_verts(verts), m_order(order), m_first(first),
+          m_in_begin(in_begin), m_in_source(in_source), m_in_edge(in_edge),
+          m_reached(reached), m_distance(distance), m_weight(weight),
+          m_pred(pred), m_compare(compare), m_combine(combine) { }
+
+      void operator()(std::size_t i, std::size_t)
+      {
+        std::size_t v = m_order[m_first + i];
+        bool found = false;
+        D best = D();
+        std::size_t best_source = 0;
+        for (std::size_t k = m_in_begin[v]; k < m_in_begin[v + 1]; ++k) {
+          std::size_t u = m_in_source[k];
+          if (!m_reached[u])
+            continue;
+          D candidate = m_combine(get(m_distance, m_verts[u]),
+                                  get(m_weight, m_in_edge[k]));
+          if (!found || m_compare(candidate, best)) {
+            best = candidate;
+            best_source = u;
+            found = true;
+          }
+        }
+        if (found && m_compare(best, get(m_distance, m_verts[v]))) {
+          put(m_distance, m_verts[v], best);
+          put(m_pred, m_verts[v], m_verts[best_source]);
+          m_reached[v] = true;
+        }
+      }
+
+      const std::vector<Vertex>& m_verts;
+      const std::vector<std::size_t>& m_order;
+      std::size_t m_first;
+      const std::vector<std::size_t>& m_in_begin;
+      const std::vector<std::size_t>& m_in_source;
+      const std::vector<Edge>& m_in_edge;
+      std::vector<char>& m_reached;
+      DistanceMap m_distance;
+      WeightMap m_weight;
+      PredecessorMap m_pred;
+      Compare m_compare;
+      Combine m_combine;
+    };
+
+  } // namespace detail
+
+  template <class VertexListGraph, class DistanceMap, class WeightMap,
+            class PredecessorMap, class IndexMap, class Compare,
+            class Combine, class DistInf, class DistZero>
+  void
+  dag_shortest_paths_parallel
+    (const VertexListGraph& g,
+     typename graph_traits<VertexListGraph>::vertex_descriptor s,
+     DistanceMap distance, WeightMap weight, PredecessorMap pred,
+     IndexMap index, Compare compare, Combine combine,
+     DistInf inf, DistZero zero, std::size_t num_threads)
+  {
+    typedef typename graph_traits<VertexListGraph>::vertex_descriptor Vertex;
+    typedef typename graph_traits<VertexListGraph>::edge_descriptor Edge;
+    const std::size_t n = num_vertices(g);
+
+    std::vector<char> reachable(n, false);
+    std::vector<Vertex> stack(1, s);
+    reachable[get(index, s)] = true;
+    typename graph_traits<VertexListGraph>::out_edge_iterator ei, ei_end;
+    while (!stack.empty()) {
+      Vertex u = stack.back();
+      stack.pop_back();
+      for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+        if (!reachable[get(index, target(*ei, g))]) {
+          reachable[get(index, target(*ei, g))] = true;
+          stack.push_back(target(*ei, g));
+        }
+    }
+
+    std::vector<Vertex> verts;
+    std::vector<std::size_t> order, level_begin;
+    detail::topological_levels(g, index, num_threads, verts, order,
+                               level_begin, &reachable);
+
+    // In-edges grouped by target, since each vertex pulls its distance.
+    std::vector<std::size_t> in_begin(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u)
+      for (boost::tie(ei, ei_end) = out_edges(verts[u], g); ei != ei_end;
+           ++ei)
+        ++in_begin[get(index, target(*ei, g)) + 1];
+    for (std::size_t v = 0; v < n; ++v)
+      in_begin[v + 1] += in_begin[v];
+    std::vector<std::size_t> in_source(in_begin[n]),
+      fill(in_begin.begin(), in_begin.end() - 1);
+    std::vector<Edge> in_edge(in_begin[n]);
+    for (std::size_t u = 0; u < n; ++u)
+      for (boost::tie(ei, ei_end) = out_edges(verts[u], g); ei != ei_end;
+           ++ei) {
+        std::size_t k = fill[get(index, target(*ei, g))]++;
+        in_source[k] = u;
+        in_edge[k] = *ei;
+      }
+
+    for (std::size_t v = 0; v < n; ++v) {
+      put(distance, verts[v], inf);
+      put(pred, verts[v], verts[v]);
+    }
+    put(distance, s, zero);
+    std::vector<char> reached(n, false);
+    reached[get(index, s)] = true;
+
+    num_threads = detail::resolve_number_of_threads(num_threads);
+    for (std::size_t k = 0; k + 1 < level_begin.size(); ++k) {
+      detail::dag_sp_level_body<VertexListGraph, DistanceMap, WeightMap,
+        PredecessorMap, Compare, Combine>
+        body(verts, order, level_begin[k], in_begin, in_source, in_edge,
+             reached, distance, weight, pred, compare, combine);
+      detail::parallel_for(level_begin[k + 1] - level_begin[k], body,
+                           num_threads, 64);
+    }
+  }
+
+  namespace detail {
+
+    template <class VertexListGraph, class DistanceMap, class WeightMap,
+              class IndexMap, class Params>
+    inline void
+    dag_sp_parallel_dispatch2
+      (const VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       DistanceMap distance, WeightMap weight, IndexMap id,
+       const Params& params)
+    {
+      typedef typename property_traits<DistanceMap>::value_type D;
+      dummy_property_map p_map;
+      D inf =
+        choose_param(get_param(params, distance_inf_t()),
+                     (std::numeric_limits<D>::max)());
+      dag_shortest_paths_parallel
+        (g, s, distance, weight,
+         choose_param(get_param(params, vertex_predecessor), p_map),
+         id,
+         choose_param(get_param(params, distance_compare_t()), std::less<D>()),
+         choose_param(get_param(params, distance_combine_t()), closed_plus<D>(inf)),
+         inf,
+         choose_param(get_param(params, distance_zero_t()), D()),
+         choose_param(get_param(params, number_of_threads_t()),
+                      std::size_t(1)));
+    }
+
+    template <class VertexListGraph, class DistanceMap, class WeightMap,
+              class IndexMap, class Params>
+    inline void
+    dag_sp_parallel_dispatch1
+      (const VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       DistanceMap distance, WeightMap weight, IndexMap id,
+       const Params& params)
+    {
+      typedef typename property_traits<WeightMap>::value_type T;
+      typename std::vector<T>::size_type n;
+      n = is_default_param(distance) ? num_vertices(g) : 1;
+      std::vector<T> distance_map(n);
+
+      dag_sp_parallel_dispatch2
+        (g, s,
+         choose_param(distance,
+                      make_iterator_property_map(distance_map.begin(), id,
+                                                 distance_map[0])),
+         weight, id, params);
+    }
+
+  } // namespace detail
+
+  template <class VertexListGraph, class Param, class Tag, class Rest>
+  inline void
+  dag_shortest_paths_parallel
+    (const VertexListGraph& g,
+     typename graph_traits<VertexListGraph>::vertex_descriptor s,
+     const bgl_named_params<Param,Tag,Rest>& params)
+  {
+    detail::dag_sp_parallel_dispatch1
+      (g, s,
+       get_param(params, vertex_distance),
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       params);
+  }
+
 } // namespace boost
 
 #endif // BOOST_GRAPH_DAG_SHORTEST_PATHS_HPP
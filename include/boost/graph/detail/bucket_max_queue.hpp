@@ -0,0 +1,159 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+//
+#ifndef BOOST_GRAPH_DETAIL_BUCKET_MAX_QUEUE_HPP
+#define BOOST_GRAPH_DETAIL_BUCKET_MAX_QUEUE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  // Max-priority queue for small non-negative integer keys, kept in a
+  // doubly-linked list per key value.  push, update and contains take
+  // constant time whatever the direction of the change; pop scans down from
+  // the largest key to the next non-empty bucket, so a sequence of
+  // operations whose keys never exceed K costs O(K) in addition to a
+  // constant per operation.  This makes the queue suited to the increase-key
+  // pattern of maximum_adjacency_search, where K is bounded by the total
+  // edge weight.
+  //
+  // - bucket_max_queue is a model of KeyedUpdatableQueue.
+  // - KeyMap must be a ReadWritePropertyMap from Value to an integral type;
+  //   the keys of the queued values must be non-negative.  The bucket array
+  //   grows as larger keys are pushed.
+  // - IndexMap must map each Value to a distinct integer in [0, n).
+  // - Copies are independent, like those of a standard container; the key
+  //   map is shared.
+  //
+  template <typename Value, typename KeyMap, typename IndexMap>
+  class bucket_max_queue {
+    public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits<KeyMap>::value_type key_type;
+    typedef KeyMap key_map;
+
+    bucket_max_queue(size_type n, KeyMap keys, IndexMap index)
+      : m_keys(keys), m_index(index), m_size(0), m_top(0),
+        m_nodes(n) {}
+
+    size_type size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    bool contains(const Value& v) const {
+      return m_nodes[get(m_index, v)].bucket != invalid();
+    }
+
+    void push(const Value& v) {
+      const size_type i = get(m_index, v);
+      BOOST_ASSERT(m_nodes[i].bucket == invalid());
+      m_nodes[i].value = v;
+      link(i, bucket_of(v));
+      ++m_size;
+    }
+
+    Value& top() {
+      BOOST_ASSERT(!empty());
+      return m_nodes[m_head[m_top]].value;
+    }
+
+    const Value& top() const {
+      BOOST_ASSERT(!empty());
+      return m_nodes[m_head[m_top]].value;
+    }
+
+    void pop() {
+      BOOST_ASSERT(!empty());
+      unlink(m_head[m_top]);
+      --m_size;
+      settle();
+    }
+
+    // Moves v to the bucket of its current key.
+    void update(const Value& v) {
+      const size_type i = get(m_index, v);
+      const size_type b = bucket_of(v);
+      if (b == m_nodes[i].bucket)
+        return;
+      unlink(i);
+      link(i, b);
+      settle();
+    }
+
+    key_map keys() const { return m_keys; }
+
+    private:
+    // The links of each value within its bucket, kept together so that an
+    // update touches few cache lines.
+    struct node {
+      node() : next(invalid()), prev(invalid()), bucket(invalid()) {}
+      size_type next, prev, bucket;
+      Value value;
+    };
+
+    static size_type invalid() {
+      return (std::numeric_limits<size_type>::max)();
+    }
+
+    size_type bucket_of(const Value& v) const {
+      const key_type k = get(m_keys, v);
+      BOOST_ASSERT(!(k < key_type(0)));
+      return size_type(k);
+    }
+
+    void link(size_type i, size_type b) {
+      if (b >= m_head.size())
+        m_head.resize((std::max)(b + 1, 2 * m_head.size()), invalid());
+      node& x = m_nodes[i];
+      x.bucket = b;
+      x.prev = invalid();
+      x.next = m_head[b];
+      if (x.next != invalid())
+        m_nodes[x.next].prev = i;
+      m_head[b] = i;
+      if (b > m_top)
+        m_top = b;
+    }
+
+    void unlink(size_type i) {
+      node& x = m_nodes[i];
+      if (x.next != invalid())
+        m_nodes[x.next].prev = x.prev;
+      if (x.prev != invalid())
+        m_nodes[x.prev].next = x.next;
+      else
+        m_head[x.bucket] = x.next;
+      x.bucket = invalid();
+    }
+
+    // Moves m_top down to the largest non-empty bucket.
+    void settle() {
+      if (m_size == 0)
+        m_top = 0;
+      else
+        while (m_head[m_top] == invalid())
+          --m_top;
+    }
+
+    KeyMap m_keys;
+    IndexMap m_index;
+    size_type m_size;
+    size_type m_top;
+    std::vector<size_type> m_head;
+    std::vector<node> m_nodes;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_BUCKET_MAX_QUEUE_HPP
@@ -0,0 +1,249 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
+#define BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
+
+// Minimal fork-join support for the shared-memory parallel variants of the
+// sequential algorithms.  Threads are only used when the standard library
+// provides <thread>, <mutex> and <atomic>; otherwise (or when
+// BOOST_GRAPH_NO_THREADS is defined) every loop runs on the calling thread
+// and the results are the same, so no algorithm has to special-case the
+// single-threaded build.  Nothing here needs a compiled library.
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/scoped_array.hpp>
+
+#if !defined(BOOST_GRAPH_NO_THREADS) \
+  && (defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_HDR_MUTEX) \
+      || defined(BOOST_NO_CXX11_HDR_ATOMIC))
+#  define BOOST_GRAPH_NO_THREADS
+#endif
+
+#ifndef BOOST_GRAPH_NO_THREADS
+#  include <thread>
+#  include <mutex>
+#  include <atomic>
+#  include <exception>
+#endif
+
+namespace boost {
+  namespace detail {
+
+#ifndef BOOST_GRAPH_NO_THREADS
+
+  typedef std::mutex parallel_mutex;
+  typedef std::lock_guard<std::mutex> parallel_lock;
+
+  inline std::size_t hardware_threads()
+  {
+    std::size_t n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+  }
+
+  // Lets the other threads run while this one waits for work.
+  inline void parallel_yield() { std::this_thread::yield(); }
+
+#else
+
+  struct parallel_mutex
+  {
+    void lock() { }
+    void unlock() { }
+  };
+
+  struct parallel_lock
+  {
+    explicit parallel_lock(parallel_mutex&) { }
+  };
+
+  inline std::size_t hardware_threads() { return 1; }
+
+  inline void parallel_yield() { }
+
+#endif // BOOST_GRAPH_NO_THREADS
+
+  // Maps the number_of_threads() parameter to the number of workers that
+  // are actually started: 0 means "one per hardware thread".
+  inline std::size_t resolve_number_of_threads(std::size_t requested)
+  {
+    std::size_t n = requested == 0 ? hardware_threads() : requested;
+#ifdef BOOST_GRAPH_NO_THREADS
+    n = 1;
+#endif
+    return n;
+  }
+
+#ifndef BOOST_GRAPH_NO_THREADS
+
+  template <typename Body>
+  struct parallel_for_worker
+  {
+    parallel_for_worker(std::atomic<std::size_t>& next, std::size_t last,
+                        std::size_t grain, Body& body, std::size_t thread,
+                        std::exception_ptr& error)
+      : m_next(next), m_last(last), m_grain(grain), m_body(body),
+        m_thread(thread), m_error(error) { }
+
+    void operator()() const
+    {
+      try {
+        for (;;) {
+          std::size_t i = m_next.fetch_add(m_grain);
+          if (i >= m_last)
+            break;
+          std::size_t end = (std::min)(i + m_grain, m_last);
+          for (; i != end; ++i)
+            m_body(i, m_thread);
+        }
+      } catch (...) {
+        // Stop handing out work and let the caller rethrow.
+        m_next.store(m_last);
+        m_error = std::current_exception();
+      }
+    }
+
+    std::atomic<std::size_t>& m_next;
+    std::size_t m_last;
+    std::size_t m_grain;
+    Body& m_body;
+    std::size_t m_thread;
+    std::exception_ptr& m_error;
+  };
+
+#endif // BOOST_GRAPH_NO_THREADS
+
+  // Calls body(i, t) for every i in [0, n), where t < num_threads identifies
+  // the worker so that the body can index per-thread workspaces.  Indices
+  // are handed out dynamically in chunks of grain.  The first exception
+  // thrown by the body is rethrown on the calling thread.
+  template <typename Body>
+  void parallel_for(std::size_t n, Body& body, std::size_t num_threads,
+                    std::size_t grain = 1)
+  {
+    if (grain == 0)
+      grain = 1;
+    num_threads = (std::min)(num_threads, (n + grain - 1) / grain);
+#ifndef BOOST_GRAPH_NO_THREADS
+    if (num_threads > 1) {
+      std::atomic<std::size_t> next(0);
+      std::vector<std::exception_ptr> errors(num_threads);
+      std::vector<std::thread> threads;
+      threads.reserve(num_threads - 1);
+      for (std::size_t t = 1; t < num_threads; ++t)
+        threads.push_back(std::thread(parallel_for_worker<Body>
+                                        (next, n, grain, body, t, errors[t])));
+      parallel_for_worker<Body>(next, n, grain, body, 0, errors[0])();
+      for (std::size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+      for (std::size_t t = 0; t < num_threads; ++t)
+        if (errors[t])
+          std::rethrow_exception(errors[t]);
+      return;
+    }
+#endif // BOOST_GRAPH_NO_THREADS
+    for (std::size_t i = 0; i < n; ++i)
+      body(i, 0);
+  }
+
+  // A fixed-size array of counters that several threads may decrement at
+  // the same time, e.g. the remaining in-degrees of a topological sort.
+  class parallel_counters
+  {
+  public:
+    explicit parallel_counters(std::size_t n) : m_values(new value_type[n])
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        set(i, 0);
+    }
+
+    std::size_t load(std::size_t i) const { return m_values[i]; }
+
+    void set(std::size_t i, std::size_t value) { m_values[i] = value; }
+
+    void increment(std::size_t i) { ++m_values[i]; }
+
+    // Returns the value after the decrement.
+    std::size_t decrement(std::size_t i) { return --m_values[i]; }
+
+    // Stores value if the counter still holds expected; returns whether it
+    // did.
+    bool compare_and_set(std::size_t i, std::size_t expected,
+                         std::size_t value)
+    {
+#ifndef BOOST_GRAPH_NO_THREADS
+      return m_values[i].compare_exchange_strong(expected, value);
+#else
+      if (m_values[i] != expected)
+        return false;
+      m_values[i] = value;
+      return true;
+#endif
+    }
+
+  private:
+#ifndef BOOST_GRAPH_NO_THREADS
+    typedef std::atomic<std::size_t> value_type;
+#else
+    typedef std::size_t value_type;
+#endif
+    boost::scoped_array<value_type> m_values;
+  };
+
+  // A fixed-size array of values that several threads may add to at the
+  // same time without locking, e.g. the excess flows of a parallel
+  // push-relabel round.  T can be any arithmetic type; additions use a
+  // compare-and-swap loop so that floating point values work too.  The
+  // accesses are relaxed: parallel_for() provides the ordering between
+  // rounds.
+  template <typename T>
+  class parallel_values
+  {
+  public:
+    explicit parallel_values(std::size_t n) : m_values(new value_type[n])
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        set(i, T());
+    }
+
+#ifndef BOOST_GRAPH_NO_THREADS
+    T load(std::size_t i) const
+      { return m_values[i].load(std::memory_order_relaxed); }
+
+    void set(std::size_t i, T value)
+      { m_values[i].store(value, std::memory_order_relaxed); }
+
+    void add(std::size_t i, T delta)
+    {
+      T old = m_values[i].load(std::memory_order_relaxed);
+      while (!m_values[i].compare_exchange_weak(old, old + delta,
+                                                std::memory_order_relaxed))
+        ;
+    }
+#else
+    T load(std::size_t i) const { return m_values[i]; }
+    void set(std::size_t i, T value) { m_values[i] = value; }
+    void add(std::size_t i, T delta) { m_values[i] += delta; }
+#endif
+
+  private:
+#ifndef BOOST_GRAPH_NO_THREADS
+    typedef std::atomic<T> value_type;
+#else
+    typedef T value_type;
+#endif
+    boost::scoped_array<value_type> m_values;
+  };
+
+  } // namespace detail
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
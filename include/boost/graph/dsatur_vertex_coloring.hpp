@@ -0,0 +1,169 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+#ifndef BOOST_GRAPH_DSATUR_VERTEX_COLORING_HPP
+#define BOOST_GRAPH_DSATUR_VERTEX_COLORING_HPP
+
+#include <vector>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/pending/bucket_sorter.hpp>
+#include <boost/unordered_set.hpp>
+#include <boost/tuple/tuple.hpp>
+
+/* The DSATUR heuristic of Brelaz colors the vertices one at a time,
+   always taking next an uncolored vertex whose colored neighbors use
+   the most distinct colors (its saturation degree), and gives it the
+   smallest color its neighbors do not use.
+
+   Reference:
+
+   Daniel Brelaz, New methods to color the vertices of a graph.
+   Communications of the ACM 22(4):251-256, 1979
+
+   The uncolored vertices are kept in a bucket_sorter with one bucket
+   per saturation degree.  Among the vertices of saturation 0 the one of
+   largest degree comes first, as in Brelaz's rule; in the other buckets
+   the vertex whose saturation rose last comes first, rather than the
+   one of largest uncolored degree, which would need a second priority
+   per bucket.  This keeps the coloring O(V + E) in time, besides the
+   hashing of colors above 63, and rarely costs a color. */
+
+namespace boost {
+
+  namespace detail {
+
+    // The distinct colors of the colored neighbors of each vertex:
+    // colors below 64 as bits of a word per vertex, the others in a
+    // hash set shared by all vertices.
+    template <class Size>
+    class neighbor_color_sets {
+    public:
+      explicit neighbor_color_sets(Size n) : m_low(n, 0) { }
+
+      bool insert(Size i, Size c) {
+        if (c < 64) {
+          boost::uint64_t bit = boost::uint64_t(1) << c;
+          if (m_low[i] & bit)
+            return false;
+          m_low[i] |= bit;
+          return true;
+        }
+        return m_high.insert(std::make_pair(i, c)).second;
+      }
+
+      // The smallest color not in the set of i.
+      Size first_fit(Size i) const {
+        boost::uint64_t free = ~m_low[i];
+        if (free) {
+          Size c = 0;
+          while (!(free & 1)) {
+            free >>= 1;
+            ++c;
+          }
+          return c;
+        }
+        Size c = 64;
+        while (m_high.count(std::make_pair(i, c)))
+          ++c;
+        return c;
+      }
+
+    private:
+      std::vector<boost::uint64_t> m_low;
+      boost::unordered_set<std::pair<Size, Size> > m_high;
+    };
+
+  } // namespace detail
+
+  template <class VertexListGraph, class ColorMap, class VertexIndexMap>
+  typename property_traits<ColorMap>::value_type
+  dsatur_vertex_coloring(const VertexListGraph& G, ColorMap color,
+                         VertexIndexMap index_map)
+  {
+    typedef graph_traits<VertexListGraph> GraphTraits;
+    typedef typename GraphTraits::vertex_descriptor Vertex;
+    typedef typename property_traits<ColorMap>::value_type color_type;
+    typedef std::size_t size_type;
+    typedef iterator_property_map<std::vector<size_type>::iterator,
+                                  VertexIndexMap> SaturationMap;
+    typedef bucket_sorter<size_type, Vertex, SaturationMap,
+                          VertexIndexMap> BucketSorter;
+    typedef typename BucketSorter::stack Stack;
+
+    const size_type n = num_vertices(G);
+    if (n == 0)
+      return 0;
+
+    // Sort the vertices by degree so that the bucket of saturation 0
+    // holds them with the largest degree on top.
+    size_type max_degree = 0;
+    typename GraphTraits::vertex_iterator v, vend;
+    for (boost::tie(v, vend) = vertices(G); v != vend; ++v)
+      if (out_degree(*v, G) > max_degree)
+        max_degree = out_degree(*v, G);
+    std::vector<size_type> start(max_degree + 2, 0);
+    for (boost::tie(v, vend) = vertices(G); v != vend; ++v)
+      ++start[out_degree(*v, G) + 1];
+    for (size_type d = 1; d < start.size(); ++d)
+      start[d] += start[d - 1];
+    std::vector<Vertex> by_degree(n);
+    for (boost::tie(v, vend) = vertices(G); v != vend; ++v)
+      by_degree[start[out_degree(*v, G)]++] = *v;
+
+    std::vector<size_type> saturation_vec(n, 0);
+    SaturationMap saturation(saturation_vec.begin(), index_map);
+    BucketSorter buckets(n, max_degree + 1, saturation, index_map);
+    for (size_type i = 0; i < n; ++i)
+      buckets.push(by_degree[i]);
+
+    std::vector<char> colored(n, false);
+    detail::neighbor_color_sets<size_type> used(n);
+    size_type top = 0;
+    color_type num_colors = 0;
+    for (size_type k = 0; k < n; ++k) {
+      Stack stack = buckets[top];
+      while (stack.empty())
+        stack = buckets[--top];
+      Vertex u = stack.top();
+      stack.pop();
+      size_type i = get(index_map, u);
+      colored[i] = true;
+
+      color_type c = used.first_fit(i);
+      put(color, u, c);
+      if (c + 1 > num_colors)
+        num_colors = c + 1;
+
+      typename GraphTraits::adjacency_iterator a, aend;
+      for (boost::tie(a, aend) = adjacent_vertices(u, G); a != aend; ++a) {
+        size_type j = get(index_map, *a);
+        if (colored[j] || !used.insert(j, c))
+          continue;
+        buckets.remove(*a);
+        if (++saturation_vec[j] > top)
+          top = saturation_vec[j];
+        buckets.push(*a);
+      }
+    }
+    return num_colors;
+  }
+
+  template <class VertexListGraph, class ColorMap>
+  typename property_traits<ColorMap>::value_type
+  dsatur_vertex_coloring(const VertexListGraph& G, ColorMap color)
+  {
+    return dsatur_vertex_coloring(G, color, get(vertex_index, G));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DSATUR_VERTEX_COLORING_HPP
@@ -12,7 +12,9 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/properties.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <vector>
 
@@ -22,6 +24,13 @@
 
    Misra, J., & Gries, D. (1992). A constructive proof of Vizing's
    theorem. In Information Processing Letters.
+
+   edge_coloring_parallel() first colors all the edges at once, each with
+   the smallest color not used at its ends at that moment, and colors
+   again the edges that got the color of an adjacent edge of smaller
+   index, until there are no conflicts.  This greedy coloring uses at
+   most 2 * max degree - 1 colors; the edges with a color above the max
+   degree are then colored again by the algorithm of Misra and Gries.
 */
 
 namespace boost {
@@ -44,59 +53,58 @@ namespace boost {
       return true;
     }
 
-    template<typename Graph, typename ColorMap>
-    std::vector<typename boost::graph_traits<Graph>::vertex_descriptor>
-    maximal_fan(const Graph &g,
-                ColorMap color,
-                typename boost::graph_traits<Graph>::vertex_descriptor x,
-                typename boost::graph_traits<Graph>::vertex_descriptor y)
+    // A set of colors that is emptied in constant time, by giving the
+    // marks of the next set a new stamp.
+    template<typename Color>
+    class color_marks
     {
-      typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_t;
-      std::vector<vertex_t> fan;
-      fan.push_back(y);
-      bool extended;
-      do {
-        extended = false;
-        BGL_FORALL_OUTEDGES_T(x, e, g, Graph) {
-          vertex_t v = target(e, g);
-          if (is_free(g, color, fan.back(), get(color, e)) &&
-              std::find(fan.begin(), fan.end(), v) == fan.end()) {
-            fan.push_back(v);
-            extended = true;
-          }
+    public:
+      color_marks() : stamp(0) {}
+
+      void clear() {
+        if (++stamp == 0) {
+          std::fill(marks.begin(), marks.end(), 0);
+          stamp = 1;
         }
-      } while(extended);
-      return fan;
-    }
-    template<typename Graph, typename ColorMap>
-    typename boost::property_traits<ColorMap>::value_type
-    find_free_color(const Graph &g,
-                    ColorMap color,
-                    typename boost::graph_traits<Graph>::vertex_descriptor u)
-    {
-      typename boost::property_traits<ColorMap>::value_type c = 0;
-      while (!is_free(g, color, u, c)) c++;
-      return c;
-    }
+      }
+      void mark(Color c) {
+        if (std::size_t(c) >= marks.size())
+          marks.resize(std::size_t(c) + 1, 0);
+        marks[c] = stamp;
+      }
+      bool marked(Color c) const {
+        return std::size_t(c) < marks.size() && marks[c] == stamp;
+      }
+      // The smallest color not in the set.
+      Color first_unmarked() const {
+        Color c = 0;
+        while (marked(c)) c++;
+        return c;
+      }
+    private:
+      std::vector<std::size_t> marks;
+      std::size_t stamp;
+    };
 
+    // Sets marks to the colors of the edges of u.
     template<typename Graph, typename ColorMap>
     void
-    invert_cd_path(const Graph &g,
-                   ColorMap color,
-                   typename boost::graph_traits<Graph>::vertex_descriptor x,
-                   typename boost::graph_traits<Graph>::edge_descriptor eold,
-                   typename boost::property_traits<ColorMap>::value_type c,
-                   typename boost::property_traits<ColorMap>::value_type d)
+    mark_colors(const Graph &g,
+                ColorMap color,
+                typename boost::graph_traits<Graph>::vertex_descriptor u,
+                color_marks<typename boost::property_traits<ColorMap>::value_type> &marks)
     {
-      put(color, eold, d);
-      BGL_FORALL_OUTEDGES_T(x, e, g, Graph) {
-        if (get(color, e) == d && e != eold) {
-          invert_cd_path(g, color, target(e, g), e, d, c);
-          return;
-        }
+      typedef typename boost::property_traits<ColorMap>::value_type color_t;
+      marks.clear();
+      BGL_FORALL_OUTEDGES_T(u, e, g, Graph) {
+        color_t c = get(color, e);
+        if (c != (std::numeric_limits<color_t>::max)())
+          marks.mark(c);
       }
     }
 
+    // Swaps the colors c and d on the path of edges colored d and c
+    // that starts at x, where c is free.
     template<typename Graph, typename ColorMap>
     void
     invert_cd_path(const Graph &g,
@@ -104,78 +112,110 @@ namespace boost {
                    typename boost::graph_traits<Graph>::vertex_descriptor x,
                    typename boost::property_traits<ColorMap>::value_type c,
                    typename boost::property_traits<ColorMap>::value_type d)
-    {
-      BGL_FORALL_OUTEDGES_T(x, e, g, Graph) {
-        if (get(color, e) == d) {
-          invert_cd_path(g, color, target(e, g), e, d, c);
-          return;
-        }
-      }
-    }
-    
-    template<typename Graph, typename ColorMap, typename ForwardIterator>
-    void
-    rotate_fan(const Graph &g,
-               ColorMap color,
-               typename boost::graph_traits<Graph>::vertex_descriptor x,
-               ForwardIterator begin,
-               ForwardIterator end)
     {
       typedef typename boost::graph_traits<Graph>::edge_descriptor edge_t;
-      if (begin == end) {
-        return;
-      }
-      edge_t previous = edge(x, *begin, g).first;
-      for (begin++; begin != end; begin++) {
-        edge_t current = edge(x, *begin, g).first;
-        put(color, previous, get(color, current));
-        previous = current;
+      typedef typename boost::graph_traits<Graph>::out_edge_iterator
+        out_edge_iterator;
+      edge_t previous;
+      bool first = true;
+      for (;;) {
+        out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(x, g); ei != ei_end; ++ei)
+          if (get(color, *ei) == d && (first || *ei != previous))
+            break;
+        if (ei == ei_end)
+          return;
+        put(color, *ei, c);
+        previous = *ei;
+        first = false;
+        x = target(*ei, g);
+        std::swap(c, d);
       }
     }
-
-    template<typename Graph, typename ColorMap>
-    class find_free_in_fan
-    {
-    public:
-      find_free_in_fan(const Graph &graph,
-                       const ColorMap color,
-                       typename boost::property_traits<ColorMap>::value_type d)
-        : graph(graph),
-          color(color),
-          d(d) {}
-      bool operator()(const typename boost::graph_traits<Graph>::vertex_descriptor u) const {
-        return is_free(graph, color, u, d);
-      }
-    private:
-      const Graph &graph;
-      const ColorMap color;
-      const typename boost::property_traits<ColorMap>::value_type d;
-    };
   }
 
+  // The scratch space of color_edge(): the fan and the colors of the
+  // edges around a vertex.  Kept from one edge to the next, it stops
+  // allocating once it has grown to the number of colors and the
+  // largest fan.
+  template<typename Graph, typename ColorMap>
+  class edge_coloring_workspace
+  {
+  public:
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_t;
+    typedef typename boost::graph_traits<Graph>::edge_descriptor edge_t;
+    typedef typename boost::property_traits<ColorMap>::value_type color_t;
+
+    std::vector<vertex_t> fan;
+    std::vector<edge_t> fan_edges;
+    detail::color_marks<color_t> used;
+    detail::color_marks<color_t> in_fan;
+  };
+
   template<typename Graph, typename ColorMap>
   typename boost::property_traits<ColorMap>::value_type
   color_edge(const Graph &g,
              ColorMap color,
-             typename boost::graph_traits<Graph>::edge_descriptor e)
+             typename boost::graph_traits<Graph>::edge_descriptor e,
+             edge_coloring_workspace<Graph, ColorMap> &workspace)
   {
     typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_t;
     typedef typename boost::property_traits<ColorMap>::value_type color_t;
-    typedef typename std::vector<vertex_t>::iterator fan_iterator;
     using namespace detail;
+    std::vector<vertex_t> &fan = workspace.fan;
+    std::vector<typename boost::graph_traits<Graph>::edge_descriptor>
+      &fan_edges = workspace.fan_edges;
     vertex_t x = source(e, g), y = target(e, g);
-    std::vector<vertex_t> fan = maximal_fan(g, color, x, y);
-    color_t c = find_free_color(g, color, x);
-    color_t d = find_free_color(g, color, fan.back());
+
+    // The maximal fan of x that starts with y: the edge from x to each
+    // fan vertex but the first has a color free on the one before.  In a
+    // simple graph, each color of an edge of x leads to one vertex.
+    fan.clear();
+    fan_edges.clear();
+    fan.push_back(y);
+    fan_edges.push_back(e);
+    workspace.in_fan.clear();
+    mark_colors(g, color, y, workspace.used);
+    bool extended;
+    do {
+      extended = false;
+      BGL_FORALL_OUTEDGES_T(x, f, g, Graph) {
+        color_t c = get(color, f);
+        if (c != (std::numeric_limits<color_t>::max)() &&
+            !workspace.used.marked(c) && !workspace.in_fan.marked(c)) {
+          fan.push_back(target(f, g));
+          fan_edges.push_back(f);
+          workspace.in_fan.mark(c);
+          mark_colors(g, color, fan.back(), workspace.used);
+          extended = true;
+        }
+      }
+    } while(extended);
+
+    mark_colors(g, color, x, workspace.used);
+    color_t c = workspace.used.first_unmarked();
+    mark_colors(g, color, fan.back(), workspace.used);
+    color_t d = workspace.used.first_unmarked();
     invert_cd_path(g, color, x, c, d);
-    fan_iterator w = std::find_if(fan.begin(),
-                                  fan.end(),
-                                  find_free_in_fan<Graph, ColorMap>(g, color, d));
-    rotate_fan(g, color, x, fan.begin(), w + 1);
-    put(color, edge(x, *w, g).first, d);
+    std::size_t w = 0;
+    while (!is_free(g, color, fan[w], d))
+      w++;
+    for (std::size_t i = 0; i < w; i++)
+      put(color, fan_edges[i], get(color, fan_edges[i + 1]));
+    put(color, fan_edges[w], d);
     return (std::max)(c, d);
   }
 
+  template<typename Graph, typename ColorMap>
+  typename boost::property_traits<ColorMap>::value_type
+  color_edge(const Graph &g,
+             ColorMap color,
+             typename boost::graph_traits<Graph>::edge_descriptor e)
+  {
+    edge_coloring_workspace<Graph, ColorMap> workspace;
+    return color_edge(g, color, e, workspace);
+  }
+
   template<typename Graph, typename ColorMap>
   typename boost::property_traits<ColorMap>::value_type
   edge_coloring(const Graph &g,
@@ -185,12 +225,155 @@ namespace boost {
     BGL_FORALL_EDGES_T(e, g, Graph) {
       put(color, e, (std::numeric_limits<color_t>::max)());
     }
+    edge_coloring_workspace<Graph, ColorMap> workspace;
     color_t colors = 0;
     BGL_FORALL_EDGES_T(e, g, Graph) {
-      colors = (std::max)(colors, color_edge(g, color, e) + 1);
+      colors = (std::max)(colors, color_edge(g, color, e, workspace) + 1);
     }
     return colors;
   }
+
+  namespace detail {
+    // One round of greedy edge coloring over the edges in work: the
+    // assign phase gives each the smallest color free at both its ends,
+    // the check phase collects the ones that share their color with an
+    // adjacent edge of smaller index.
+    template<typename Graph, typename EdgeIndexMap>
+    struct greedy_edge_coloring_body
+    {
+      typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_t;
+      typedef typename boost::graph_traits<Graph>::edge_descriptor edge_t;
+
+      greedy_edge_coloring_body(const Graph &g,
+                                EdgeIndexMap index,
+                                parallel_counters &colors,
+                                const std::vector<edge_t> &work,
+                                std::vector<std::vector<edge_t> > &conflicts,
+                                std::vector<color_marks<std::size_t> > &marks)
+        : g(g), index(index), colors(colors), work(work),
+          conflicts(conflicts), marks(marks), check(false) {}
+
+      static std::size_t uncolored() { return std::size_t(-1); }
+
+      void operator()(std::size_t i, std::size_t t) {
+        edge_t e = work[i];
+        const std::size_t ie = get(index, e);
+        vertex_t ends[2] = { source(e, g), target(e, g) };
+        if (!check) {
+          color_marks<std::size_t> &used = marks[t];
+          used.clear();
+          for (int k = 0; k < 2; k++) {
+            BGL_FORALL_OUTEDGES_T(ends[k], f, g, Graph) {
+              std::size_t c = colors.load(get(index, f));
+              if (c != uncolored() && get(index, f) != ie)
+                used.mark(c);
+            }
+          }
+          colors.set(ie, used.first_unmarked());
+          return;
+        }
+        const std::size_t c = colors.load(ie);
+        for (int k = 0; k < 2; k++) {
+          BGL_FORALL_OUTEDGES_T(ends[k], f, g, Graph) {
+            if (get(index, f) < ie && colors.load(get(index, f)) == c) {
+              conflicts[t].push_back(e);
+              return;
+            }
+          }
+        }
+      }
+
+      const Graph &g;
+      EdgeIndexMap index;
+      parallel_counters &colors;
+      const std::vector<edge_t> &work;
+      std::vector<std::vector<edge_t> > &conflicts;
+      std::vector<color_marks<std::size_t> > &marks;
+      bool check;
+    };
+  }
+
+  // Colors the edges on num_threads threads (0 means one per hardware
+  // thread): a greedy coloring in parallel, then the algorithm of Misra
+  // and Gries for the edges whose color is above the max degree, so that
+  // at most max degree + 1 colors are used.  The edges that the greedy
+  // coloring leaves to Misra and Gries depend on the timing of the
+  // threads.
+  template<typename Graph, typename ColorMap, typename EdgeIndexMap>
+  typename boost::property_traits<ColorMap>::value_type
+  edge_coloring_parallel(const Graph &g,
+                         ColorMap color,
+                         EdgeIndexMap edge_index_map,
+                         std::size_t num_threads)
+  {
+    typedef typename boost::graph_traits<Graph>::edge_descriptor edge_t;
+    typedef typename boost::property_traits<ColorMap>::value_type color_t;
+    typedef detail::greedy_edge_coloring_body<Graph, EdgeIndexMap> body_t;
+    num_threads = detail::resolve_number_of_threads(num_threads);
+
+    // The edges vertex by vertex, so that the edges of one end of each
+    // are at hand when it is colored.
+    std::size_t max_degree = 0;
+    std::vector<edge_t> work;
+    std::vector<char> listed(num_edges(g), false);
+    BGL_FORALL_VERTICES_T(v, g, Graph) {
+      max_degree = (std::max)(max_degree, std::size_t(out_degree(v, g)));
+      BGL_FORALL_OUTEDGES_T(v, e, g, Graph) {
+        if (!listed[get(edge_index_map, e)]) {
+          listed[get(edge_index_map, e)] = true;
+          work.push_back(e);
+        }
+      }
+    }
+    detail::parallel_counters colors(num_edges(g));
+    for (std::size_t i = 0; i < work.size(); i++)
+      colors.set(get(edge_index_map, work[i]), body_t::uncolored());
+    std::vector<std::vector<edge_t> > conflicts(num_threads);
+    std::vector<detail::color_marks<std::size_t> > marks(num_threads);
+    body_t body(g, edge_index_map, colors, work, conflicts, marks);
+
+    while (!work.empty()) {
+      body.check = false;
+      detail::parallel_for(work.size(), body, num_threads, 256);
+      // one thread sees the colors of all the edges colored before
+      if (num_threads == 1)
+        break;
+      body.check = true;
+      detail::parallel_for(work.size(), body, num_threads, 256);
+      work.clear();
+      for (std::size_t t = 0; t < num_threads; t++) {
+        work.insert(work.end(), conflicts[t].begin(), conflicts[t].end());
+        conflicts[t].clear();
+      }
+    }
+
+    work.clear();
+    color_t num_colors = 0;
+    BGL_FORALL_EDGES_T(e, g, Graph) {
+      std::size_t c = colors.load(get(edge_index_map, e));
+      if (c > max_degree) {
+        put(color, e, (std::numeric_limits<color_t>::max)());
+        work.push_back(e);
+      } else {
+        put(color, e, color_t(c));
+        num_colors = (std::max)(num_colors, color_t(c + 1));
+      }
+    }
+    edge_coloring_workspace<Graph, ColorMap> workspace;
+    for (std::size_t i = 0; i < work.size(); i++)
+      num_colors = (std::max)(num_colors,
+                              color_edge(g, color, work[i], workspace) + 1);
+    return num_colors;
+  }
+
+  template<typename Graph, typename ColorMap>
+  typename boost::property_traits<ColorMap>::value_type
+  edge_coloring_parallel(const Graph &g,
+                         ColorMap color,
+                         std::size_t num_threads = 1)
+  {
+    return edge_coloring_parallel(g, color, get(edge_index, g), num_threads);
+  }
 }
 
 #endif
@@ -14,12 +14,14 @@
 #include <boost/graph/named_function_params.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/topology.hpp> // For topology concepts
+#include <boost/graph/detail/parallel_for.hpp>
 #include <vector>
 #include <list>
 #include <algorithm> // for std::min and std::max
 #include <numeric> // for std::accumulate
 #include <cmath> // for std::sqrt and std::fabs
 #include <functional>
+#include <utility>
 
 namespace boost {
 
@@ -174,6 +176,293 @@ make_grid_force_pairs
    const PositionMap& position, const Graph& g)
 { return grid_force_pairs<Topology, PositionMap>(topology, position, g); }
 
+namespace detail {
+  // A cell of the tree of barnes_hut_force_pairs: the vertices
+  // order[first, last), their centroid, the side of the cell and the
+  // nonempty cells [children, children + num_children) it is split into.
+  template<typename Point>
+  struct barnes_hut_cell
+  {
+    barnes_hut_cell(std::size_t first, std::size_t last)
+      : first(first), last(last), children(0), num_children(0), size(0.) { }
+
+    std::size_t first, last;
+    std::size_t children, num_children;
+    Point centroid;
+    double size;
+  };
+
+  // Sums the repulsion on the k-th vertex of the tree order, one vertex
+  // per call, so that the vertices can be spread over threads.  The
+  // pairs too close to be told apart are left in too_close.
+  template<typename Topology, typename Point, typename Graph,
+           typename ApplyForce>
+  struct barnes_hut_body
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename Topology::point_difference_type PointDiff;
+    typedef barnes_hut_cell<Point> cell_type;
+    typedef std::pair<std::size_t, std::size_t> index_pair;
+
+    barnes_hut_body(const Topology& topology, ApplyForce& apply_force,
+                    const std::vector<vertex_descriptor>& verts,
+                    const std::vector<Point>& pos,
+                    const std::vector<std::size_t>& order,
+                    const std::vector<cell_type>& cells, double theta,
+                    std::vector<std::vector<std::size_t> >& stacks,
+                    std::vector<std::vector<index_pair> >& too_close)
+      : topology(topology), apply_force(apply_force), verts(verts),
+        pos(pos), order(order), cells(cells), theta(theta),
+        stacks(stacks), too_close(too_close) { }
+
+    // The cells are boxes in the coordinates of the points, so the
+    // distances are Euclidean; this is faster than topology.distance().
+    static double distance(const Point& a, const Point& b)
+    {
+      double sum = 0.;
+      for (std::size_t d = 0; d < Point::dimensions; ++d)
+        sum += (a[d] - b[d]) * (a[d] - b[d]);
+      return std::sqrt(sum);
+    }
+
+    void operator()(std::size_t k, std::size_t t)
+    {
+      const std::size_t i = order[k];
+      const Point& p = pos[i];
+      const double close = apply_force.too_close_distance();
+      PointDiff disp;
+      std::vector<std::size_t>& stack = stacks[t];
+      stack.assign(1, 0);
+      while (!stack.empty()) {
+        const cell_type& cell = cells[stack.back()];
+        stack.pop_back();
+        // A cell that is small enough seen from the vertex, and does not
+        // hold it, acts as one vertex at its centroid.
+        if (k < cell.first || k >= cell.last) {
+          double dist = distance(cell.centroid, p);
+          if (cell.size < theta * dist && dist >= close) {
+            apply_force.add_repulsion(verts[order[cell.first]],
+                                      cell.centroid,
+                                      double(cell.last - cell.first),
+                                      verts[i], p, dist, disp);
+            continue;
+          }
+        }
+        if (cell.num_children == 0) {
+          for (std::size_t l = cell.first; l != cell.last; ++l) {
+            if (l == k)
+              continue;
+            const std::size_t j = order[l];
+            double dist = distance(pos[j], p);
+            if (dist < close)
+              too_close[t].push_back(index_pair(i, j));
+            else
+              apply_force.add_repulsion(verts[j], pos[j], 1., verts[i], p,
+                                        dist, disp);
+          }
+        } else {
+          for (std::size_t c = cell.children;
+               c != cell.children + cell.num_children; ++c)
+            stack.push_back(c);
+        }
+      }
+      apply_force.displace(verts[i], disp);
+    }
+
+    const Topology& topology;
+    ApplyForce& apply_force;
+    const std::vector<vertex_descriptor>& verts;
+    const std::vector<Point>& pos;
+    const std::vector<std::size_t>& order;
+    const std::vector<cell_type>& cells;
+    double theta;
+    std::vector<std::vector<std::size_t> >& stacks;
+    std::vector<std::vector<index_pair> >& too_close;
+  };
+} // end namespace detail
+
+// Approximates the repulsion among all pairs of vertices in the manner of
+// Barnes and Hut: the vertices are sorted into a tree of cells, halving
+// the cell in every dimension at each level (a quadtree in the plane, an
+// octree in space), and a cell whose side is below theta times its
+// distance to a vertex repulses the vertex as one vertex of its weight at
+// its centroid.  The sums for the vertices are spread over num_threads
+// threads (0 means one per hardware thread), so the repulsive force must
+// allow concurrent calls; the layout does not depend on the number of
+// threads.  Only fruchterman_reingold_force_directed_layout() may call it.
+template<typename Topology, typename PositionMap>
+struct barnes_hut_force_pairs
+{
+  typedef typename property_traits<PositionMap>::value_type Point;
+
+  explicit
+  barnes_hut_force_pairs(const Topology& topology, PositionMap position,
+                         double theta = 0.8, std::size_t num_threads = 1)
+    : topology(topology), position(position), theta(theta),
+      num_threads(num_threads)
+  { }
+
+  template<typename Graph, typename ApplyForce>
+  void operator()(const Graph& g, ApplyForce apply_force)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef detail::barnes_hut_body<Topology, Point, Graph, ApplyForce>
+      body_type;
+    typedef typename body_type::index_pair index_pair;
+
+    std::vector<vertex_descriptor> verts;
+    verts.reserve(num_vertices(g));
+    BGL_FORALL_VERTICES_T(v, g, Graph)
+      verts.push_back(v);
+    if (verts.size() < 2)
+      return;
+    pos.resize(verts.size());
+    for (std::size_t i = 0; i < verts.size(); ++i)
+      pos[i] = get(position, verts[i]);
+    build();
+
+    std::size_t threads = detail::resolve_number_of_threads(num_threads);
+    std::vector<std::vector<std::size_t> > stacks(threads);
+    std::vector<std::vector<index_pair> > too_close(threads);
+    body_type body(topology, apply_force, verts, pos, order, cells, theta,
+                   stacks, too_close);
+    detail::parallel_for(verts.size(), body, threads, 64);
+
+    // The vertices that are too close go through apply_force one pair at
+    // a time, in an order that does not depend on the threads.
+    std::vector<index_pair> pairs;
+    for (std::size_t t = 0; t < threads; ++t)
+      pairs.insert(pairs.end(), too_close[t].begin(), too_close[t].end());
+    std::sort(pairs.begin(), pairs.end());
+    for (std::size_t p = 0; p < pairs.size(); ++p)
+      apply_force(verts[pairs[p].second], verts[pairs[p].first]);
+  }
+
+ private:
+  typedef detail::barnes_hut_cell<Point> cell_type;
+
+  // Cells of at most leaf_size vertices, or max_depth levels down, are
+  // not split.
+  static std::size_t leaf_size() { return 8; }
+  static std::size_t max_depth() { return 32; }
+
+  static std::size_t orthant(const Point& p, const Point& low, double half)
+  {
+    std::size_t o = 0;
+    for (std::size_t d = 0; d < Point::dimensions; ++d)
+      if (p[d] >= low[d] + half)
+        o |= std::size_t(1) << d;
+    return o;
+  }
+
+  // Builds the tree of the positions pos, in the smallest cube around
+  // them.
+  void build()
+  {
+    BOOST_USING_STD_MIN();
+    BOOST_USING_STD_MAX();
+    const std::size_t n = pos.size();
+    Point low = pos[0], high = pos[0];
+    for (std::size_t i = 1; i < n; ++i)
+      for (std::size_t d = 0; d < Point::dimensions; ++d) {
+        low[d] = min BOOST_PREVENT_MACRO_SUBSTITUTION (low[d], pos[i][d]);
+        high[d] = max BOOST_PREVENT_MACRO_SUBSTITUTION (high[d], pos[i][d]);
+      }
+    double size = 0.;
+    for (std::size_t d = 0; d < Point::dimensions; ++d)
+      size = max BOOST_PREVENT_MACRO_SUBSTITUTION (size, high[d] - low[d]);
+
+    order.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+      order[i] = i;
+    scratch.resize(n);
+    codes.resize(n);
+    cells.clear();
+    cells.push_back(cell_type(0, n));
+    split(0, low, size, 0);
+  }
+
+  // Sorts the vertices of cell c, with lowest corner low, into its
+  // orthants and recurses, then sets the centroid of c.
+  void split(std::size_t c, const Point& low, double size, std::size_t depth)
+  {
+    const std::size_t first = cells[c].first, last = cells[c].last;
+    const double half = size / 2;
+    cells[c].size = size;
+    if (last - first > leaf_size() && depth < max_depth() && size > 0.) {
+      const std::size_t orthants = std::size_t(1) << Point::dimensions;
+      counts.assign(orthants + 1, 0);
+      for (std::size_t l = first; l != last; ++l) {
+        codes[l] = orthant(pos[order[l]], low, half);
+        ++counts[codes[l] + 1];
+      }
+      for (std::size_t o = 0; o < orthants; ++o)
+        counts[o + 1] += counts[o];
+      for (std::size_t l = first; l != last; ++l)
+        scratch[first + counts[codes[l]]++] = order[l];
+      std::copy(scratch.begin() + first, scratch.begin() + last,
+                order.begin() + first);
+
+      // counts[o] is now the end of orthant o
+      const std::size_t children = cells.size();
+      for (std::size_t o = 0, start = 0; o < orthants; start = counts[o++])
+        if (counts[o] != start)
+          cells.push_back(cell_type(first + start, first + counts[o]));
+      cells[c].children = children;
+      cells[c].num_children = cells.size() - children;
+
+      for (std::size_t child = children;
+           child != children + cells[c].num_children; ++child) {
+        std::size_t o = orthant(pos[order[cells[child].first]], low, half);
+        Point child_low = low;
+        for (std::size_t d = 0; d < Point::dimensions; ++d)
+          if (o & (std::size_t(1) << d))
+            child_low[d] += half;
+        split(child, child_low, half, depth + 1);
+      }
+    }
+
+    Point centroid;
+    for (std::size_t d = 0; d < Point::dimensions; ++d)
+      centroid[d] = 0.;
+    if (cells[c].num_children == 0) {
+      for (std::size_t l = first; l != last; ++l)
+        for (std::size_t d = 0; d < Point::dimensions; ++d)
+          centroid[d] += pos[order[l]][d];
+    } else {
+      for (std::size_t child = cells[c].children;
+           child != cells[c].children + cells[c].num_children; ++child) {
+        double weight = double(cells[child].last - cells[child].first);
+        for (std::size_t d = 0; d < Point::dimensions; ++d)
+          centroid[d] += weight * cells[child].centroid[d];
+      }
+    }
+    for (std::size_t d = 0; d < Point::dimensions; ++d)
+      centroid[d] /= double(last - first);
+    cells[c].centroid = centroid;
+  }
+
+  const Topology& topology;
+  PositionMap position;
+  double theta;
+  std::size_t num_threads;
+
+  // Kept from one iteration to the next to save allocations.
+  std::vector<Point> pos;
+  std::vector<std::size_t> order, scratch, codes, counts;
+  std::vector<cell_type> cells;
+};
+
+template<typename PositionMap, typename Topology>
+inline barnes_hut_force_pairs<Topology, PositionMap>
+make_barnes_hut_force_pairs
+  (const Topology& topology, const PositionMap& position,
+   double theta = 0.8, std::size_t num_threads = 1)
+{
+  return barnes_hut_force_pairs<Topology, PositionMap>
+    (topology, position, theta, num_threads);
+}
+
 template<typename Graph, typename PositionMap, typename Topology>
 void
 scale_graph(const Graph& g, PositionMap position, const Topology& topology,
@@ -232,7 +521,8 @@ namespace detail {
                    const DisplacementMap& displacement,
                    RepulsiveForce repulsive_force, double k, const Graph& g)
       : topology(topology), position(position), displacement(displacement),
-        repulsive_force(repulsive_force), k(k), g(g)
+        repulsive_force(repulsive_force), k(k), g(g),
+        too_close(topology.norm(topology.extent()) / 10000.)
     { }
 
     void operator()(vertex_descriptor u, vertex_descriptor v)
@@ -257,6 +547,28 @@ namespace detail {
       }
     }
 
+    // The members below are for force pairs that sum the repulsion on a
+    // vertex themselves, possibly on several threads at once, such as
+    // barnes_hut_force_pairs.  Pairs of vertices closer than
+    // too_close_distance() must go through operator() instead, which
+    // moves the vertices apart.
+    double too_close_distance() const { return too_close; }
+
+    // Adds to disp the repulsion on v, at pv, of weight vertices at pu,
+    // dist away, u being one of them.
+    void add_repulsion(vertex_descriptor u, const Point& pu, double weight,
+                       vertex_descriptor v, const Point& pv, double dist,
+                       PointDiff& disp)
+    {
+      double fr = repulsive_force(u, v, k, dist, g);
+      disp += (weight * fr / dist) * topology.difference(pv, pu);
+    }
+
+    void displace(vertex_descriptor v, const PointDiff& disp)
+    {
+      put(displacement, v, get(displacement, v) + disp);
+    }
+
   private:
     const Topology& topology;
     PositionMap position;
@@ -264,6 +576,7 @@ namespace detail {
     RepulsiveForce repulsive_force;
     double k;
     const Graph& g;
+    double too_close;
   };
 
 } // end namespace detail
@@ -0,0 +1,269 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_FRUCHTERMAN_REINGOLD_MULTILEVEL_HPP
+#define BOOST_GRAPH_FRUCHTERMAN_REINGOLD_MULTILEVEL_HPP
+
+#include <boost/graph/fruchterman_reingold.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace boost {
+
+namespace detail {
+
+  typedef adjacency_list<vecS, vecS, undirectedS> fr_multilevel_graph;
+
+  // Levels of at most this many vertices are not coarsened further.
+  inline std::size_t fr_multilevel_coarsest() { return 50; }
+
+  // Splits g into solar systems, as in FM3: suns at least three edges
+  // apart, taken in vertex order until no more fit, the neighbors of each
+  // sun as its planets, and the other vertices, two edges from a sun, as
+  // moons of the sun of a neighbor.  Sets system[get(index, v)] to the
+  // system of v and returns the number of systems.
+  template<typename Graph, typename VertexIndexMap>
+  std::size_t
+  fr_solar_systems(const Graph& g, VertexIndexMap index,
+                   std::vector<std::size_t>& system)
+  {
+    const std::size_t none = std::size_t(-1);
+    system.assign(num_vertices(g), none);
+    std::vector<char> near_sun(num_vertices(g), false);
+    std::size_t systems = 0;
+    BGL_FORALL_VERTICES_T(v, g, Graph) {
+      if (near_sun[get(index, v)])
+        continue;
+      system[get(index, v)] = systems;
+      near_sun[get(index, v)] = true;
+      BGL_FORALL_ADJ_T(v, w, g, Graph) {
+        system[get(index, w)] = systems;
+        near_sun[get(index, w)] = true;
+        BGL_FORALL_ADJ_T(w, x, g, Graph)
+          near_sun[get(index, x)] = true;
+      }
+      ++systems;
+    }
+
+    BGL_FORALL_VERTICES_T(v, g, Graph) {
+      if (system[get(index, v)] != none)
+        continue;
+      BGL_FORALL_ADJ_T(v, w, g, Graph) {
+        if (system[get(index, w)] != none) {
+          system[get(index, v)] = system[get(index, w)];
+          break;
+        }
+      }
+      // only when the graph is directed and v has no way to a sun
+      if (system[get(index, v)] == none)
+        system[get(index, v)] = systems++;
+    }
+    return systems;
+  }
+
+  // Adds to levels the graph of the solar systems of g, and to systems
+  // the map from g to it.  Returns whether the new level should be
+  // coarsened in turn; a level that would not be smaller than g is not
+  // added.
+  template<typename Graph, typename VertexIndexMap>
+  bool
+  fr_coarsen(const Graph& g, VertexIndexMap index,
+             std::vector<std::vector<std::size_t> >& systems,
+             std::list<fr_multilevel_graph>& levels)
+  {
+    typedef std::pair<std::size_t, std::size_t> edge_pair;
+    const std::size_t n = num_vertices(g);
+    systems.push_back(std::vector<std::size_t>());
+    std::vector<std::size_t>& system = systems.back();
+    std::size_t count = fr_solar_systems(g, index, system);
+    if (count == n) {
+      systems.pop_back();
+      return false;
+    }
+
+    std::vector<edge_pair> pairs;
+    BGL_FORALL_EDGES_T(e, g, Graph) {
+      std::size_t a = system[get(index, source(e, g))];
+      std::size_t b = system[get(index, target(e, g))];
+      if (a != b)
+        pairs.push_back(edge_pair((std::min)(a, b), (std::max)(a, b)));
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    fr_multilevel_graph coarse(pairs.begin(), pairs.end(), count);
+    levels.push_back(fr_multilevel_graph());
+    levels.back().swap(coarse);
+    return count > fr_multilevel_coarsest() && 4 * count <= 3 * n;
+  }
+
+  // Places each vertex of g near the position of its solar system,
+  // moved part of the way toward the systems of its neighbors, and a
+  // little further in a random direction to set apart the vertices that
+  // would land on the same point.
+  template<typename Graph, typename PositionMap, typename Topology,
+           typename VertexIndexMap>
+  void
+  fr_multilevel_place(const Graph& g, PositionMap position,
+                      const Topology& topology, VertexIndexMap index,
+                      const std::vector<std::size_t>& system,
+                      const std::vector<typename Topology::point_type>& coarse,
+                      double k)
+  {
+    typedef typename Topology::point_type Point;
+    typedef typename Topology::point_difference_type PointDiff;
+    const double spread = k / topology.norm(topology.extent()) / 4.;
+    BGL_FORALL_VERTICES_T(v, g, Graph) {
+      const std::size_t s = system[get(index, v)];
+      PointDiff toward;
+      std::size_t count = 0;
+      BGL_FORALL_ADJ_T(v, w, g, Graph) {
+        std::size_t t = system[get(index, w)];
+        if (t != s) {
+          toward += topology.difference(coarse[t], coarse[s]);
+          ++count;
+        }
+      }
+      Point p = coarse[s];
+      if (count != 0)
+        p = topology.adjust(p, toward * (0.25 / double(count)));
+      PointDiff offset =
+        topology.difference(topology.random_point(), topology.center());
+      put(position, v, topology.bound(topology.adjust(p, offset * spread)));
+    }
+  }
+
+  // Runs the Barnes-Hut variant of the Fruchterman-Reingold layout on one
+  // level.
+  template<typename Graph, typename PositionMap, typename Topology,
+           typename VertexIndexMap>
+  void
+  fr_multilevel_step(const Graph& g, PositionMap position,
+                     const Topology& topology, VertexIndexMap index,
+                     std::size_t iterations, double temp,
+                     std::size_t num_threads)
+  {
+    typedef typename Topology::point_difference_type PointDiff;
+    std::vector<PointDiff> displacements(num_vertices(g));
+    fruchterman_reingold_force_directed_layout
+      (g, position, topology,
+       square_distance_attractive_force(),
+       square_distance_repulsive_force(),
+       make_barnes_hut_force_pairs(topology, position, 0.8, num_threads),
+       linear_cooling<double>(iterations, temp),
+       make_iterator_property_map(displacements.begin(), index,
+                                  PointDiff()));
+  }
+
+  // The natural spacing of n vertices, as in the layout itself.
+  template<typename Topology>
+  double fr_multilevel_spacing(const Topology& topology, std::size_t n)
+  {
+    return pow(topology.volume(topology.extent()) / n,
+               1. / double(Topology::point_difference_type::dimensions));
+  }
+
+} // end namespace detail
+
+// Lays out g with the Fruchterman-Reingold algorithm over a hierarchy of
+// ever coarser graphs, each collapsing the solar systems of the one
+// below (FM3-style).  The coarsest graph is laid out from random
+// positions, and each finer one starting from the positions of its
+// systems, so that the finest levels only need a few iterations to
+// settle.  Every level uses barnes_hut_force_pairs on num_threads threads
+// (0 means one per hardware thread).  The initial positions are ignored.
+template<typename Graph, typename PositionMap, typename Topology,
+         typename VertexIndexMap>
+void
+fruchterman_reingold_multilevel_layout(const Graph& g,
+                                       PositionMap position,
+                                       const Topology& topology,
+                                       VertexIndexMap index_map,
+                                       std::size_t num_threads)
+{
+  typedef detail::fr_multilevel_graph Coarse;
+  typedef typename Topology::point_type Point;
+  typedef typename property_map<Coarse, vertex_index_t>::const_type
+    CoarseIndexMap;
+
+  // The finer levels start close to their final shape, so they get fewer
+  // iterations, from a temperature of half the spacing of their vertices.
+  const std::size_t coarsest_iterations = 100, iterations = 30;
+  if (num_vertices(g) == 0)
+    return;
+
+  // Level 0 is g and level l > 0 is the (l - 1)-th graph of levels;
+  // systems[l] maps the vertices of level l to those of level l + 1.
+  std::list<Coarse> levels;
+  std::vector<std::vector<std::size_t> > systems;
+  bool more = num_vertices(g) > detail::fr_multilevel_coarsest()
+    && detail::fr_coarsen(g, index_map, systems, levels);
+  while (more)
+    more = detail::fr_coarsen(levels.back(), get(vertex_index, levels.back()),
+                              systems, levels);
+
+  double coarsest_temp = topology.norm(topology.extent()) / 10.;
+  if (levels.empty()) {
+    BGL_FORALL_VERTICES_T(v, g, Graph)
+      put(position, v, topology.random_point());
+    detail::fr_multilevel_step(g, position, topology, index_map,
+                               coarsest_iterations, coarsest_temp,
+                               num_threads);
+    return;
+  }
+
+  std::vector<Point> pos(num_vertices(levels.back()));
+  for (std::size_t i = 0; i < pos.size(); ++i)
+    pos[i] = topology.random_point();
+  std::size_t level = levels.size();
+  typename std::list<Coarse>::reverse_iterator coarse = levels.rbegin();
+  detail::fr_multilevel_step
+    (*coarse, make_iterator_property_map(pos.begin(),
+                                         CoarseIndexMap()),
+     topology, CoarseIndexMap(), coarsest_iterations, coarsest_temp,
+     num_threads);
+
+  for (++coarse, --level; coarse != levels.rend(); ++coarse, --level) {
+    double k = detail::fr_multilevel_spacing(topology, num_vertices(*coarse));
+    std::vector<Point> finer(num_vertices(*coarse));
+    detail::fr_multilevel_place
+      (*coarse, make_iterator_property_map(finer.begin(), CoarseIndexMap()),
+       topology, CoarseIndexMap(), systems[level], pos, k);
+    pos.swap(finer);
+    detail::fr_multilevel_step
+      (*coarse, make_iterator_property_map(pos.begin(), CoarseIndexMap()),
+       topology, CoarseIndexMap(), iterations, k / 2, num_threads);
+  }
+
+  double k = detail::fr_multilevel_spacing(topology, num_vertices(g));
+  detail::fr_multilevel_place(g, position, topology, index_map, systems[0],
+                              pos, k);
+  detail::fr_multilevel_step(g, position, topology, index_map, iterations,
+                             k / 2, num_threads);
+}
+
+template<typename Graph, typename PositionMap, typename Topology>
+void
+fruchterman_reingold_multilevel_layout(const Graph& g,
+                                       PositionMap position,
+                                       const Topology& topology,
+                                       std::size_t num_threads = 1)
+{
+  fruchterman_reingold_multilevel_layout(g, position, topology,
+                                         get(vertex_index, g), num_threads);
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_FRUCHTERMAN_REINGOLD_MULTILEVEL_HPP
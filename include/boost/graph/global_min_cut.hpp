@@ -0,0 +1,815 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_GLOBAL_MIN_CUT_HPP
+#define BOOST_GRAPH_GLOBAL_MIN_CUT_HPP
+
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_01.hpp>
+#include <boost/tuple/tuple.hpp>
+
+// Global minimum cuts of undirected graphs with non-negative edge weights
+// by repeated contraction.  Both algorithms keep an upper bound lambda on
+// the minimum cut, the lightest cut seen so far, and contract edges that
+// no cut lighter than lambda can separate:
+//
+//  - The Padberg-Rinaldi tests ("An efficient algorithm for the minimum
+//    capacity cut problem", 1990): an edge at least as heavy as lambda, an
+//    edge heavier than half the weighted degree of one of its ends, and an
+//    edge that together with its triangles carries lambda.
+//
+//  - The Nagamochi-Ibaraki forest (CAPFOREST): during a maximum adjacency
+//    search, the weight r(y) from the scanned vertices to y bounds the
+//    connectivity between y and the vertex being scanned from below.
+//    Several searches may run at the same time on disjoint parts of the
+//    graph; the bounds remain valid (Henzinger, Noe, Schulz and Strash,
+//    "Practical minimum cut algorithms", 2018).
+//
+// nagamochi_ibaraki_min_cut() alternates the two until the graph is
+// contracted completely and is exact.  karger_stein_min_cut() applies the
+// Padberg-Rinaldi tests and then runs independent Karger-Stein recursive
+// contractions on what is left; it is a Monte Carlo algorithm.
+
+namespace boost {
+
+  namespace detail {
+
+    // Union-find that several threads may update at the same time.  The
+    // larger root is always linked below the smaller one, so that the
+    // parent of a vertex never exceeds it.
+    class concurrent_union_find
+    {
+    public:
+      explicit concurrent_union_find(std::size_t n) : m_parent(n)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          m_parent.set(i, i);
+      }
+
+      std::size_t find(std::size_t x)
+      {
+        for (;;) {
+          std::size_t p = m_parent.load(x);
+          if (p == x)
+            return x;
+          std::size_t q = m_parent.load(p);
+          if (q != p)
+            m_parent.compare_and_set(x, p, q);
+          x = p;
+        }
+      }
+
+      // Returns whether x and y were in different sets.
+      bool unite(std::size_t x, std::size_t y)
+      {
+        for (;;) {
+          x = find(x);
+          y = find(y);
+          if (x == y)
+            return false;
+          if (x < y)
+            std::swap(x, y);
+          if (m_parent.compare_and_set(x, x, y))
+            return true;
+        }
+      }
+
+    private:
+      parallel_counters m_parent;
+    };
+
+
+    // A weighted graph in compressed form with both directions of every
+    // edge, no loops and no parallel edges, and the weighted degrees.
+    template <typename Weight>
+    struct cut_graph
+    {
+      std::vector<std::size_t> first, target;
+      std::vector<Weight> weight, degree;
+
+      std::size_t size() const { return degree.size(); }
+    };
+
+
+    // Contracts g into h: vertex u of g becomes vertex label[u] < k of h.
+    // The loops this creates are dropped and parallel edges are merged.
+    // slot is workspace.
+    template <typename Weight>
+    void contract_cut_graph(const cut_graph<Weight>& g,
+                            const std::vector<std::size_t>& label,
+                            std::size_t k, cut_graph<Weight>& h,
+                            std::vector<std::size_t>& slot)
+    {
+      const std::size_t n = g.first.size() - 1, none = std::size_t(-1);
+      h.first.assign(k + 1, 0);
+      for (std::size_t u = 0; u < n; ++u)
+        h.first[label[u] + 1] += g.first[u + 1] - g.first[u];
+      for (std::size_t a = 0; a < k; ++a)
+        h.first[a + 1] += h.first[a];
+      std::vector<std::size_t> fill(h.first.begin(), h.first.end() - 1);
+      h.target.resize(h.first[k]);
+      h.weight.resize(h.first[k]);
+      for (std::size_t u = 0; u < n; ++u) {
+        std::size_t a = label[u];
+        for (std::size_t e = g.first[u]; e < g.first[u + 1]; ++e) {
+          std::size_t b = label[g.target[e]];
+          if (a != b) {
+            h.target[fill[a]] = b;
+            h.weight[fill[a]++] = g.weight[e];
+          }
+        }
+      }
+
+      // Merge the parallel edges of each vertex in place.
+      slot.assign(k, none);
+      h.degree.assign(k, Weight());
+      std::size_t out = 0;
+      for (std::size_t a = 0; a < k; ++a) {
+        std::size_t begin = h.first[a];
+        h.first[a] = out;
+        for (std::size_t i = begin; i < fill[a]; ++i) {
+          std::size_t b = h.target[i];
+          h.degree[a] += h.weight[i];
+          if (slot[b] != none && slot[b] >= h.first[a])
+            h.weight[slot[b]] += h.weight[i];
+          else {
+            slot[b] = out;
+            h.target[out] = b;
+            h.weight[out++] = h.weight[i];
+          }
+        }
+      }
+      h.first[k] = out;
+      h.target.resize(out);
+      h.weight.resize(out);
+    }
+
+
+    template <typename Weight>
+    class min_cut_solver
+    {
+    public:
+      typedef std::size_t size_type;
+
+      static size_type none() { return size_type(-1); }
+
+      // Takes over the contents of g.
+      min_cut_solver(cut_graph<Weight>& g, size_type num_threads)
+        : m_num_threads(num_threads), m_label(g.size()),
+          m_side(g.size(), 0),
+          m_best((std::numeric_limits<Weight>::max)())
+      {
+        std::swap(m_graph.first, g.first);
+        std::swap(m_graph.target, g.target);
+        std::swap(m_graph.weight, g.weight);
+        std::swap(m_graph.degree, g.degree);
+        for (size_type v = 0; v < m_label.size(); ++v)
+          m_label[v] = v;
+      }
+
+      Weight value() const { return m_best; }
+
+      // The side of the best cut that original vertex v is on.
+      bool side(size_type v) const { return m_side[v] != 0; }
+
+      void solve_exact();
+      void solve_randomized(size_type trials, unsigned int seed);
+
+      struct reduction_body;
+      struct forest_body;
+      struct karger_stein_body;
+
+    private:
+      bool disconnected();
+      bool done();
+      void record(Weight value, const std::vector<char>& side);
+      size_type padberg_rinaldi(concurrent_union_find& uf);
+      size_type capforest(concurrent_union_find& uf);
+      size_type parallel_capforest(concurrent_union_find& uf);
+      void contract(concurrent_union_find& uf);
+
+      size_type m_num_threads;
+      cut_graph<Weight> m_graph;
+      std::vector<size_type> m_label, m_slot;
+      std::vector<char> m_side;
+      Weight m_best;
+    };
+
+
+    // Records a cut of weight zero if the edges of positive weight do not
+    // connect the graph.
+    template <typename Weight>
+    bool min_cut_solver<Weight>::disconnected()
+    {
+      const cut_graph<Weight>& g = m_graph;
+      std::vector<char> reached(g.size(), 0);
+      std::vector<size_type> stack(1, 0);
+      reached[0] = 1;
+      size_type count = 1;
+      while (!stack.empty()) {
+        size_type x = stack.back();
+        stack.pop_back();
+        for (size_type e = g.first[x]; e < g.first[x + 1]; ++e)
+          if (Weight() < g.weight[e] && !reached[g.target[e]]) {
+            reached[g.target[e]] = 1;
+            stack.push_back(g.target[e]);
+            ++count;
+          }
+      }
+      if (count == g.size())
+        return false;
+      record(Weight(), reached);
+      return true;
+    }
+
+
+    // Records the vertex cuts of the current graph and tells whether
+    // nothing is left to find.
+    template <typename Weight>
+    bool min_cut_solver<Weight>::done()
+    {
+      const cut_graph<Weight>& g = m_graph;
+      if (g.size() < 2)
+        return true;
+      size_type best = none();
+      for (size_type x = 0; x < g.size(); ++x)
+        if (g.degree[x] < m_best && (best == none() || g.degree[x] < g.degree[best]))
+          best = x;
+      if (best != none()) {
+        std::vector<char> side(g.size(), 0);
+        side[best] = 1;
+        record(g.degree[best], side);
+      }
+      return m_best == Weight() || g.size() == 2;
+    }
+
+
+    template <typename Weight>
+    void min_cut_solver<Weight>::record(Weight value,
+                                        const std::vector<char>& side)
+    {
+      m_best = value;
+      for (size_type v = 0; v < m_label.size(); ++v)
+        m_side[v] = side[m_label[v]];
+    }
+
+
+    // The Padberg-Rinaldi tests, for each edge from the end with the
+    // longer adjacency list, so that the triangles are found by scanning
+    // the shorter one.
+    template <typename Weight>
+    struct min_cut_solver<Weight>::reduction_body
+    {
+      reduction_body(const cut_graph<Weight>& g, Weight bound,
+                     concurrent_union_find& uf, size_type num_threads)
+        : g(g), bound(bound), uf(uf), mark(num_threads),
+          stamp(num_threads), merged(num_threads, 0) { }
+
+      bool before(size_type v, size_type u) const
+      {
+        size_type dv = g.first[v + 1] - g.first[v],
+          du = g.first[u + 1] - g.first[u];
+        return dv < du || (dv == du && v < u);
+      }
+
+      void operator()(size_type u, size_type t)
+      {
+        std::vector<Weight>& w_u = mark[t];
+        std::vector<size_type>& seen = stamp[t];
+        if (seen.empty()) {
+          w_u.resize(g.size());
+          seen.assign(g.size(), none());
+        }
+        for (size_type e = g.first[u]; e < g.first[u + 1]; ++e) {
+          seen[g.target[e]] = u;
+          w_u[g.target[e]] = g.weight[e];
+        }
+        for (size_type e = g.first[u]; e < g.first[u + 1]; ++e) {
+          size_type v = g.target[e];
+          Weight w = g.weight[e];
+          if (!before(v, u))
+            continue;
+          bool contract = !(w < bound) || g.degree[u] < w + w
+            || g.degree[v] < w + w;
+          if (!contract) {
+            Weight sum = w;
+            for (size_type f = g.first[v]; f < g.first[v + 1] && sum < bound; ++f)
+              if (seen[g.target[f]] == u)
+                sum += (std::min)(w_u[g.target[f]], g.weight[f]);
+            contract = !(sum < bound);
+          }
+          if (contract && uf.unite(u, v))
+            ++merged[t];
+        }
+      }
+
+      const cut_graph<Weight>& g;
+      Weight bound;
+      concurrent_union_find& uf;
+      std::vector<std::vector<Weight> > mark;
+      std::vector<std::vector<size_type> > stamp;
+      std::vector<size_type> merged;
+    };
+
+
+    template <typename Weight>
+    typename min_cut_solver<Weight>::size_type
+    min_cut_solver<Weight>::padberg_rinaldi(concurrent_union_find& uf)
+    {
+      reduction_body body(m_graph, m_best, uf, m_num_threads);
+      parallel_for(m_graph.size(), body, m_num_threads, 256);
+      size_type merged = 0;
+      for (size_type t = 0; t < m_num_threads; ++t)
+        merged += body.merged[t];
+      return merged;
+    }
+
+
+    // A maximum adjacency search that contracts every edge whose bound
+    // reaches the best cut, and records the lightest of the cuts between
+    // the scanned vertices and the rest.
+    template <typename Weight>
+    typename min_cut_solver<Weight>::size_type
+    min_cut_solver<Weight>::capforest(concurrent_union_find& uf)
+    {
+      const cut_graph<Weight>& g = m_graph;
+      const size_type n = g.size();
+      std::vector<Weight> r(n, Weight());
+      std::vector<size_type> order(n), position(n, none());
+      std::priority_queue<std::pair<Weight, size_type> > queue;
+      Weight cut = Weight(), bound = m_best;
+      size_type count = 0, best_count = none(), merged = 0;
+      for (size_type s = 0; s < n; ++s) {
+        if (position[s] != none())
+          continue;
+        queue.push(std::make_pair(Weight(), s));
+        while (!queue.empty()) {
+          size_type x = queue.top().second;
+          Weight key = queue.top().first;
+          queue.pop();
+          if (position[x] != none() || key != r[x])
+            continue;
+          position[x] = count;
+          order[count++] = x;
+          cut = cut + g.degree[x] - r[x] - r[x];
+          if (count < n && cut < bound) {
+            bound = cut;
+            best_count = count;
+          }
+          for (size_type e = g.first[x]; e < g.first[x + 1]; ++e) {
+            size_type y = g.target[e];
+            if (position[y] != none())
+              continue;
+            r[y] += g.weight[e];
+            if (!(r[y] < bound) && uf.unite(x, y))
+              ++merged;
+            queue.push(std::make_pair(r[y], y));
+          }
+        }
+      }
+      if (best_count != none()) {
+        std::vector<char> side(n);
+        for (size_type x = 0; x < n; ++x)
+          side[x] = position[x] < best_count;
+        record(bound, side);
+      }
+      // With floating point weights the last vertex may miss the bound by
+      // rounding; its cut is the cut of the phase and it may be merged
+      // with the vertex before it.
+      if (merged == 0 && uf.unite(order[n - 2], order[n - 1]))
+        ++merged;
+      return merged;
+    }
+
+
+    // Searches from several vertices at the same time.  Each vertex is
+    // scanned by the thread that claims it first, and a search ignores the
+    // vertices claimed by the others: it is a maximum adjacency search of
+    // a subgraph, whose connectivities are lower bounds.
+    template <typename Weight>
+    struct min_cut_solver<Weight>::forest_body
+    {
+      forest_body(const cut_graph<Weight>& g, Weight bound,
+                  concurrent_union_find& uf, size_type num_threads)
+        : g(g), bound(bound), uf(uf), owner(g.size()),
+          num_threads(num_threads), merged(num_threads, 0) { }
+
+      void operator()(size_type t, size_type)
+      {
+        const size_type n = g.size();
+        std::vector<Weight> r(n, Weight());
+        std::priority_queue<std::pair<Weight, size_type> > queue;
+        for (size_type s = t * n / num_threads; s < (t + 1) * n / num_threads; ++s) {
+          if (owner.load(s) != 0)
+            continue;
+          queue.push(std::make_pair(Weight(), s));
+          while (!queue.empty()) {
+            size_type x = queue.top().second;
+            Weight key = queue.top().first;
+            queue.pop();
+            if (key != r[x] || !owner.compare_and_set(x, 0, t + 1))
+              continue;
+            for (size_type e = g.first[x]; e < g.first[x + 1]; ++e) {
+              size_type y = g.target[e];
+              if (owner.load(y) != 0)
+                continue;
+              r[y] += g.weight[e];
+              if (!(r[y] < bound) && uf.unite(x, y))
+                ++merged[t];
+              queue.push(std::make_pair(r[y], y));
+            }
+          }
+        }
+      }
+
+      const cut_graph<Weight>& g;
+      Weight bound;
+      concurrent_union_find& uf;
+      parallel_counters owner;
+      size_type num_threads;
+      std::vector<size_type> merged;
+    };
+
+
+    template <typename Weight>
+    typename min_cut_solver<Weight>::size_type
+    min_cut_solver<Weight>::parallel_capforest(concurrent_union_find& uf)
+    {
+      forest_body body(m_graph, m_best, uf, m_num_threads);
+      parallel_for(m_num_threads, body, m_num_threads);
+      size_type merged = 0;
+      for (size_type t = 0; t < m_num_threads; ++t)
+        merged += body.merged[t];
+      return merged;
+    }
+
+
+    template <typename Weight>
+    void min_cut_solver<Weight>::contract(concurrent_union_find& uf)
+    {
+      const size_type n = m_graph.size();
+      std::vector<size_type> label(n), id(n, none());
+      size_type k = 0;
+      for (size_type x = 0; x < n; ++x) {
+        size_type root = uf.find(x);
+        if (id[root] == none())
+          id[root] = k++;
+        label[x] = id[root];
+      }
+      cut_graph<Weight> h;
+      contract_cut_graph(m_graph, label, k, h, m_slot);
+      std::swap(m_graph, h);
+      for (size_type v = 0; v < m_label.size(); ++v)
+        m_label[v] = label[m_label[v]];
+    }
+
+
+    template <typename Weight>
+    void min_cut_solver<Weight>::solve_exact()
+    {
+      if (disconnected())
+        return;
+      while (!done()) {
+        const size_type n = m_graph.size();
+        concurrent_union_find uf(n);
+        // The Padberg-Rinaldi tests are cheaper; the forest is only built
+        // when they no longer shrink the graph by a tenth.
+        size_type reduced = padberg_rinaldi(uf);
+        if (reduced == 0 || reduced < n / 10) {
+          size_type merged = 0;
+          if (m_num_threads > 1 && n >= 1024 * m_num_threads)
+            merged = parallel_capforest(uf);
+          if (merged == 0)
+            capforest(uf);
+        }
+        contract(uf);
+      }
+    }
+
+
+    // Contracts random edges of g, each with probability proportional to
+    // its weight, until k vertices are left.
+    template <typename Weight, typename Generator>
+    void random_contraction(const cut_graph<Weight>& g, std::size_t k,
+                            Generator& gen, cut_graph<Weight>& h,
+                            std::vector<std::size_t>& label)
+    {
+      const std::size_t n = g.size();
+      std::vector<std::pair<double, std::size_t> > keys;
+      uniform_01<double> random;
+      for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t e = g.first[u]; e < g.first[u + 1]; ++e)
+          if (u < g.target[e] && Weight() < g.weight[e])
+            keys.push_back(std::make_pair(-std::log(1.0 - random(gen))
+                                          / double(g.weight[e]), e));
+      std::sort(keys.begin(), keys.end());
+
+      std::vector<std::size_t> parent(n);
+      for (std::size_t u = 0; u < n; ++u)
+        parent[u] = u;
+      std::vector<std::size_t> source(g.target.size());
+      for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t e = g.first[u]; e < g.first[u + 1]; ++e)
+          source[e] = u;
+      std::size_t count = n;
+      for (std::size_t i = 0; i < keys.size() && count > k; ++i) {
+        std::size_t a = source[keys[i].second], b = g.target[keys[i].second];
+        while (parent[a] != a)
+          a = parent[a] = parent[parent[a]];
+        while (parent[b] != b)
+          b = parent[b] = parent[parent[b]];
+        if (a != b) {
+          parent[(std::max)(a, b)] = (std::min)(a, b);
+          --count;
+        }
+      }
+      label.resize(n);
+      std::size_t next = 0;
+      for (std::size_t u = 0; u < n; ++u) {
+        std::size_t root = u;
+        while (parent[root] != root)
+          root = parent[root];
+        label[u] = root == u ? next++ : label[root];
+      }
+      std::vector<std::size_t> slot;
+      contract_cut_graph(g, label, next, h, slot);
+    }
+
+
+    // The Karger-Stein recursion: two independent contractions to about
+    // 1/sqrt(2) of the vertices, and exhaustive search on six or fewer.
+    template <typename Weight, typename Generator>
+    void karger_stein(const cut_graph<Weight>& g, Generator& gen,
+                      Weight& value, std::vector<char>& side)
+    {
+      const std::size_t n = g.size();
+      value = (std::numeric_limits<Weight>::max)();
+      side.assign(n, 0);
+      if (n < 2)
+        return;
+      if (n <= 6) {
+        // The last vertex stays on side 0.
+        for (std::size_t mask = 1; mask < (std::size_t(1) << (n - 1)); ++mask) {
+          Weight cut = Weight();
+          for (std::size_t u = 0; u < n; ++u)
+            for (std::size_t e = g.first[u]; e < g.first[u + 1]; ++e)
+              if (u < g.target[e] && ((mask >> u) & 1) != ((mask >> g.target[e]) & 1))
+                cut += g.weight[e];
+          if (cut < value) {
+            value = cut;
+            for (std::size_t u = 0; u < n; ++u)
+              side[u] = (mask >> u) & 1;
+          }
+        }
+        return;
+      }
+      std::size_t k = std::size_t(std::ceil(1 + n / std::sqrt(2.0)));
+      for (int repeat = 0; repeat < 2; ++repeat) {
+        cut_graph<Weight> h;
+        std::vector<std::size_t> label;
+        random_contraction(g, k, gen, h, label);
+        Weight cut;
+        std::vector<char> part;
+        karger_stein(h, gen, cut, part);
+        if (cut < value) {
+          value = cut;
+          for (std::size_t u = 0; u < n; ++u)
+            side[u] = part[label[u]];
+        }
+      }
+    }
+
+
+    // Runs the trials; each thread keeps the lightest cut it found, ties
+    // going to the earlier trial, so that the result does not depend on
+    // the number of threads.
+    template <typename Weight>
+    struct min_cut_solver<Weight>::karger_stein_body
+    {
+      karger_stein_body(const cut_graph<Weight>& g, unsigned int seed,
+                        size_type num_threads)
+        : g(g), seed(seed),
+          value(num_threads, (std::numeric_limits<Weight>::max)()),
+          trial(num_threads, none()), side(num_threads) { }
+
+      void operator()(size_type i, size_type t)
+      {
+        mt19937 gen(seed + static_cast<unsigned int>(i));
+        Weight cut;
+        std::vector<char> part;
+        karger_stein(g, gen, cut, part);
+        if (cut < value[t] || (!(value[t] < cut) && i < trial[t])) {
+          value[t] = cut;
+          trial[t] = i;
+          side[t].swap(part);
+        }
+      }
+
+      const cut_graph<Weight>& g;
+      unsigned int seed;
+      std::vector<Weight> value;
+      std::vector<size_type> trial;
+      std::vector<std::vector<char> > side;
+    };
+
+
+    template <typename Weight>
+    void min_cut_solver<Weight>::solve_randomized(size_type trials,
+                                                  unsigned int seed)
+    {
+      // Random contractions never cross the zero cut of a disconnected
+      // graph and could not shrink it.
+      if (disconnected())
+        return;
+      while (!done()) {
+        concurrent_union_find uf(m_graph.size());
+        if (padberg_rinaldi(uf) == 0)
+          break;
+        contract(uf);
+      }
+      if (done())
+        return;
+      if (trials == 0) {
+        double log_n = std::log(double(m_graph.size())) / std::log(2.0);
+        trials = size_type(std::ceil(log_n * log_n));
+      }
+      karger_stein_body body(m_graph, seed, m_num_threads);
+      parallel_for(trials, body, m_num_threads);
+      size_type best = none();
+      for (size_type t = 0; t < m_num_threads; ++t)
+        if (body.trial[t] != none()
+            && (best == none() || body.value[t] < body.value[best]
+                || (!(body.value[best] < body.value[t])
+                    && body.trial[t] < body.trial[best])))
+          best = t;
+      if (best != none() && body.value[best] < m_best)
+        record(body.value[best], body.side[best]);
+    }
+
+
+    template <typename UndirectedGraph, typename WeightMap, typename IndexMap>
+    void make_cut_graph(const UndirectedGraph& g, WeightMap weights,
+                        IndexMap index_map,
+                        cut_graph<typename property_traits<WeightMap>::value_type>& h)
+    {
+      typedef typename property_traits<WeightMap>::value_type weight_type;
+      const std::size_t n = num_vertices(g);
+      cut_graph<weight_type> raw;
+      raw.first.assign(n + 1, 0);
+      typename graph_traits<UndirectedGraph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        raw.first[get(index_map, *vi) + 1] = out_degree(*vi, g);
+      for (std::size_t u = 0; u < n; ++u)
+        raw.first[u + 1] += raw.first[u];
+      raw.target.resize(raw.first[n]);
+      raw.weight.resize(raw.first[n]);
+      typename graph_traits<UndirectedGraph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t i = raw.first[get(index_map, *vi)];
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei, ++i) {
+          raw.target[i] = get(index_map, target(*ei, g));
+          raw.weight[i] = get(weights, *ei);
+        }
+      }
+      std::vector<std::size_t> identity(n), slot;
+      for (std::size_t u = 0; u < n; ++u)
+        identity[u] = u;
+      contract_cut_graph(raw, identity, n, h, slot);
+    }
+
+
+    template <typename UndirectedGraph, typename WeightMap, typename IndexMap>
+    void check_min_cut_input(const UndirectedGraph& g, WeightMap, IndexMap)
+    {
+      BOOST_CONCEPT_ASSERT((IncidenceGraphConcept<UndirectedGraph>));
+      BOOST_CONCEPT_ASSERT((VertexListGraphConcept<UndirectedGraph>));
+      BOOST_CONCEPT_ASSERT((Convertible<typename graph_traits<UndirectedGraph>::directed_category, undirected_tag>));
+      BOOST_CONCEPT_ASSERT((ReadablePropertyMapConcept<WeightMap, typename graph_traits<UndirectedGraph>::edge_descriptor>));
+      if (num_vertices(g) < 2)
+        throw bad_graph("the input graph must have at least two vertices.");
+    }
+
+
+    template <typename UndirectedGraph, typename ParityMap, typename IndexMap,
+              typename Weight>
+    void copy_min_cut_parities(const UndirectedGraph& g, ParityMap parities,
+                               IndexMap index_map,
+                               const min_cut_solver<Weight>& solver)
+    {
+      typedef typename property_traits<ParityMap>::value_type parity_type;
+      typename graph_traits<UndirectedGraph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        put(parities, *vi, parity_type(solver.side(get(index_map, *vi))));
+    }
+
+  } // namespace detail
+
+
+  // Exact global minimum cut.  The parity map receives the two sides of
+  // the cut as in stoer_wagner_min_cut().
+  template <class UndirectedGraph, class WeightMap, class ParityMap,
+            class IndexMap>
+  typename property_traits<WeightMap>::value_type
+  nagamochi_ibaraki_min_cut(const UndirectedGraph& g, WeightMap weights,
+                            ParityMap parities, IndexMap index_map,
+                            std::size_t num_threads = 1)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_type;
+    detail::check_min_cut_input(g, weights, index_map);
+    detail::cut_graph<weight_type> h;
+    detail::make_cut_graph(g, weights, index_map, h);
+    detail::min_cut_solver<weight_type>
+      solver(h, detail::resolve_number_of_threads(num_threads));
+    solver.solve_exact();
+    detail::copy_min_cut_parities(g, parities, index_map, solver);
+    return solver.value();
+  }
+
+  template <class UndirectedGraph, class WeightMap, class P, class T, class R>
+  typename property_traits<WeightMap>::value_type
+  nagamochi_ibaraki_min_cut(const UndirectedGraph& g, WeightMap weights,
+                            const bgl_named_params<P, T, R>& params)
+  {
+    return nagamochi_ibaraki_min_cut
+      (g, weights,
+       choose_param(get_param(params, parity_map_t()), dummy_property_map()),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       choose_param(get_param(params, number_of_threads_t()), std::size_t(1)));
+  }
+
+  template <class UndirectedGraph, class WeightMap>
+  typename property_traits<WeightMap>::value_type
+  nagamochi_ibaraki_min_cut(const UndirectedGraph& g, WeightMap weights)
+  {
+    return nagamochi_ibaraki_min_cut(g, weights, dummy_property_map(),
+                                     get(vertex_index, g));
+  }
+
+
+  // Monte Carlo global minimum cut.  After the Padberg-Rinaldi tests
+  // leave nothing to contract, runs the given number of independent
+  // Karger-Stein trials, by default log2(n)^2 for the n vertices left,
+  // which finds a minimum cut with high probability.  The result only
+  // depends on the seed, not on the number of threads.
+  template <class UndirectedGraph, class WeightMap, class ParityMap,
+            class IndexMap>
+  typename property_traits<WeightMap>::value_type
+  karger_stein_min_cut(const UndirectedGraph& g, WeightMap weights,
+                       ParityMap parities, IndexMap index_map,
+                       std::size_t trials = 0, unsigned int seed = 1,
+                       std::size_t num_threads = 1)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_type;
+    detail::check_min_cut_input(g, weights, index_map);
+    detail::cut_graph<weight_type> h;
+    detail::make_cut_graph(g, weights, index_map, h);
+    detail::min_cut_solver<weight_type>
+      solver(h, detail::resolve_number_of_threads(num_threads));
+    solver.solve_randomized(trials, seed);
+    detail::copy_min_cut_parities(g, parities, index_map, solver);
+    return solver.value();
+  }
+
+  template <class UndirectedGraph, class WeightMap, class P, class T, class R>
+  typename property_traits<WeightMap>::value_type
+  karger_stein_min_cut(const UndirectedGraph& g, WeightMap weights,
+                       const bgl_named_params<P, T, R>& params)
+  {
+    return karger_stein_min_cut
+      (g, weights,
+       choose_param(get_param(params, parity_map_t()), dummy_property_map()),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       0, 1,
+       choose_param(get_param(params, number_of_threads_t()), std::size_t(1)));
+  }
+
+  template <class UndirectedGraph, class WeightMap>
+  typename property_traits<WeightMap>::value_type
+  karger_stein_min_cut(const UndirectedGraph& g, WeightMap weights)
+  {
+    return karger_stein_min_cut(g, weights, dummy_property_map(),
+                                get(vertex_index, g));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_GLOBAL_MIN_CUT_HPP
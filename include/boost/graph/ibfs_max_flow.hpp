@@ -0,0 +1,575 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_IBFS_MAX_FLOW_HPP
+#define BOOST_GRAPH_IBFS_MAX_FLOW_HPP
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/lookup_edge.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/concept/assert.hpp>
+
+// The algorithm implemented here is described in:
+//
+// Goldberg, A. V., Hed, S., Kaplan, H., Tarjan, R. E., Werneck, R. F.
+// "Maximum Flows by Incremental Breadth-First Search", In Proceedings of
+// the 19th European Symposium on Algorithms (ESA), LNCS 6942,
+// pp. 457-468, 2011.
+//
+// Like the Boykov-Kolmogorov algorithm it grows a source and a sink search
+// tree and augments along the paths where they meet, but both trees are
+// kept as breadth-first trees with exact distance labels.  Orphans are
+// adopted in order of increasing label, only by a parent one level closer
+// to the root, and are relabeled when there is none; this bounds the
+// running time by O(V^2 E).
+
+namespace boost {
+
+  namespace detail {
+
+    template <class Graph,
+              class EdgeCapacityMap,
+              class ResidualCapacityEdgeMap,
+              class ReverseEdgeMap,
+              class PredecessorMap,
+              class ColorMap,
+              class DistanceMap,
+              class IndexMap>
+    class ibfs_max_flow
+    {
+      typedef graph_traits<Graph> Traits;
+      typedef typename Traits::vertex_descriptor vertex_descriptor;
+      typedef typename Traits::edge_descriptor edge_descriptor;
+      typedef typename Traits::vertex_iterator vertex_iterator;
+      typedef typename Traits::edge_iterator edge_iterator;
+      typedef typename Traits::out_edge_iterator out_edge_iterator;
+      typedef typename property_traits<EdgeCapacityMap>::value_type FlowValue;
+      typedef typename property_traits<ColorMap>::value_type ColorValue;
+      typedef color_traits<ColorValue> Color;
+      typedef typename property_traits<DistanceMap>::value_type Distance;
+
+      // Index 0 is the source tree, 1 the sink tree.
+      enum { source_tree = 0, sink_tree = 1 };
+
+    public:
+      ibfs_max_flow(Graph& g, EdgeCapacityMap cap,
+                    ResidualCapacityEdgeMap res, ReverseEdgeMap rev,
+                    PredecessorMap pred, ColorMap color, DistanceMap dist,
+                    IndexMap index, vertex_descriptor src,
+                    vertex_descriptor sink)
+        : m_g(g), m_cap(cap), m_res(res), m_rev(rev), m_pred(pred),
+          m_color(color), m_dist(dist), m_index(index), m_source(src),
+          m_sink(sink), m_flow(0),
+          m_has_parent(num_vertices(g), false),
+          m_current(num_vertices(g)),
+          m_vertex(num_vertices(g)),
+          m_orphan_next(num_vertices(g)),
+          m_none((std::numeric_limits<std::size_t>::max)())
+      {
+        vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+          put(m_color, *vi, Color::gray());
+          m_vertex[get(m_index, *vi)] = *vi;
+          m_current[get(m_index, *vi)] = out_edges(*vi, m_g).first;
+        }
+        edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = edges(m_g); ei != ei_end; ++ei) {
+          put(m_res, *ei, get(m_cap, *ei));
+          BOOST_ASSERT(get(m_rev, get(m_rev, *ei)) == *ei);
+        }
+        for (int t = 0; t < 2; ++t) {
+          m_front[t] = 0;
+          m_head[t] = 0;
+          m_queued[t].assign(num_vertices(g), false);
+          m_orphan_first[t].assign(num_vertices(g) + 2, m_none);
+          m_orphan_low[t] = m_none;
+          m_orphan_high[t] = 0;
+        }
+        put(m_color, m_source, Color::black());
+        put(m_color, m_sink, Color::white());
+        put(m_dist, m_source, 0);
+        put(m_dist, m_sink, 0);
+        enqueue(m_source, source_tree);
+        enqueue(m_sink, sink_tree);
+      }
+
+      FlowValue max_flow()
+      {
+        // Grow the tree with the smaller frontier by one level at a time
+        // until one of them cannot grow any more; that tree is then one
+        // side of a minimum cut.
+        augment_direct_paths();
+        int closed;
+        for (;;) {
+          int t = pending(source_tree) <= pending(sink_tree)
+            ? source_tree : sink_tree;
+          if (!grow(t)) {
+            closed = t;
+            break;
+          }
+        }
+        // Everything outside the closed tree is on the other side.
+        vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi)
+          if (get(m_color, *vi) == Color::gray())
+            put(m_color, *vi, closed == source_tree ? Color::white()
+                                                     : Color::black());
+        return m_flow;
+      }
+
+    private:
+      // Vision networks connect most vertices to both terminals, and
+      // saturating source -> v -> sink first takes most of the flow
+      // without growing any tree.
+      void augment_direct_paths()
+      {
+        out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(m_source, m_g); ei != ei_end;
+             ++ei) {
+          vertex_descriptor v = target(*ei, m_g);
+          if (get(m_res, *ei) <= 0)
+            continue;
+          if (v == m_sink) {
+            FlowValue delta = get(m_res, *ei);
+            push(*ei, delta);
+            m_flow += delta;
+            continue;
+          }
+          std::pair<edge_descriptor, bool> to_sink
+            = lookup_edge(v, m_sink, m_g);
+          if (to_sink.second && get(m_res, to_sink.first) > 0) {
+            FlowValue delta = (std::min)(get(m_res, *ei),
+                                         get(m_res, to_sink.first));
+            push(*ei, delta);
+            push(to_sink.first, delta);
+            m_flow += delta;
+          }
+        }
+      }
+
+      ColorValue color_of(int t) const
+        { return t == source_tree ? Color::black() : Color::white(); }
+
+      bool in_tree(vertex_descriptor v, int t) const
+        { return get(m_color, v) == color_of(t); }
+
+      std::size_t pending(int t) const
+        { return m_queue[t].size() - m_head[t]; }
+
+      // The edge that carries residual capacity from v toward the root of
+      // t (t = sink_tree) or from the root of t toward v (source_tree),
+      // given the out-edge e = (v,u).
+      edge_descriptor tree_arc(edge_descriptor e, int t) const
+        { return t == source_tree ? get(m_rev, e) : e; }
+
+      void set_parent(vertex_descriptor v, edge_descriptor arc)
+      {
+        put(m_pred, v, arc);
+        m_has_parent[get(m_index, v)] = true;
+      }
+
+      // Schedules v for scanning in the current pass of its tree, or in
+      // the next one if it is on the next level.
+      void enqueue(vertex_descriptor v, int t)
+      {
+        std::size_t i = get(m_index, v);
+        if (m_queued[t][i])
+          return;
+        m_queued[t][i] = true;
+        if (static_cast<std::size_t>(get(m_dist, v)) <= m_front[t])
+          m_queue[t].push_back(v);
+        else
+          m_next[t].push_back(v);
+      }
+
+      // Scans the current level of tree t and moves on to the next one.
+      // Returns false if the next level is empty, that is, if t contains
+      // every vertex that can reach (or be reached from) its root.
+      bool grow(int t)
+      {
+        while (m_head[t] < m_queue[t].size()) {
+          vertex_descriptor v = m_queue[t][m_head[t]++];
+          m_queued[t][get(m_index, v)] = false;
+          if (!in_tree(v, t))
+            continue;
+          if (static_cast<std::size_t>(get(m_dist, v)) > m_front[t]) {
+            enqueue(v, t);
+            continue;
+          }
+          scan(v, t);
+        }
+        m_queue[t].clear();
+        m_head[t] = 0;
+        ++m_front[t];
+        m_queue[t].swap(m_next[t]);
+        return !m_queue[t].empty();
+      }
+
+      void scan(vertex_descriptor v, int t)
+      {
+        const Distance d = get(m_dist, v);
+        out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g); ei != ei_end; ) {
+          edge_descriptor arc = t == source_tree ? *ei : get(m_rev, *ei);
+          vertex_descriptor w = target(*ei, m_g);
+          if (get(m_res, arc) <= 0) {
+            ++ei;
+            continue;
+          }
+          if (get(m_color, w) == Color::gray()) {
+            put(m_color, w, color_of(t));
+            put(m_dist, w, d + 1);
+            set_parent(w, arc);
+            m_current[get(m_index, w)] = out_edges(w, m_g).first;
+            enqueue(w, t);
+            ++ei;
+          } else if (in_tree(w, t)) {
+            ++ei;
+          } else {
+            augment(arc);
+            // Keep scanning v (the same edge first) unless it moved.
+            if (!in_tree(v, t) || get(m_dist, v) != d) {
+              if (in_tree(v, t))
+                enqueue(v, t);
+              return;
+            }
+          }
+        }
+      }
+
+      // Pushes the bottleneck along source -> ... -> source(e) -> target(e)
+      // -> ... -> sink and adopts the orphans.
+      void augment(edge_descriptor e)
+      {
+        FlowValue delta = get(m_res, e);
+        for (vertex_descriptor v = source(e, m_g); v != m_source; ) {
+          edge_descriptor a = get(m_pred, v);
+          delta = (std::min)(delta, get(m_res, a));
+          v = source(a, m_g);
+        }
+        for (vertex_descriptor v = target(e, m_g); v != m_sink; ) {
+          edge_descriptor a = get(m_pred, v);
+          delta = (std::min)(delta, get(m_res, a));
+          v = target(a, m_g);
+        }
+        BOOST_ASSERT(delta > 0);
+
+        push(e, delta);
+        for (vertex_descriptor v = source(e, m_g); v != m_source; ) {
+          edge_descriptor a = get(m_pred, v);
+          vertex_descriptor u = source(a, m_g);
+          if (push(a, delta))
+            make_orphan(v, source_tree);
+          v = u;
+        }
+        for (vertex_descriptor v = target(e, m_g); v != m_sink; ) {
+          edge_descriptor a = get(m_pred, v);
+          vertex_descriptor u = target(a, m_g);
+          if (push(a, delta))
+            make_orphan(v, sink_tree);
+          v = u;
+        }
+        m_flow += delta;
+
+        adopt(source_tree);
+        adopt(sink_tree);
+        // Vertices that left one tree may be reachable from the other.
+        for (std::size_t i = 0; i < m_free.size(); ++i)
+          if (get(m_color, m_free[i]) == Color::gray()
+              && !join(m_free[i], source_tree))
+            join(m_free[i], sink_tree);
+        m_free.clear();
+      }
+
+      // Returns true if a was saturated.
+      bool push(edge_descriptor a, FlowValue delta)
+      {
+        put(m_res, a, get(m_res, a) - delta);
+        edge_descriptor r = get(m_rev, a);
+        put(m_res, r, get(m_res, r) + delta);
+        return get(m_res, a) <= 0;
+      }
+
+      void make_orphan(vertex_descriptor v, int t)
+      {
+        std::size_t i = get(m_index, v);
+        std::size_t d = get(m_dist, v);
+        m_has_parent[i] = false;
+        m_orphan_next[i] = m_orphan_first[t][d];
+        m_orphan_first[t][d] = i;
+        m_orphan_low[t] = (std::min)(m_orphan_low[t], d);
+        m_orphan_high[t] = (std::max)(m_orphan_high[t], d);
+      }
+
+      // Finds new parents for the orphans of tree t, level by level.
+      void adopt(int t)
+      {
+        // Orphaned children are one level down, so a single sweep over the
+        // levels suffices.
+        for (std::size_t d = m_orphan_low[t];
+             d != m_none && d <= m_orphan_high[t]; ++d) {
+          while (m_orphan_first[t][d] != m_none) {
+            std::size_t i = m_orphan_first[t][d];
+            m_orphan_first[t][d] = m_orphan_next[i];
+            adopt_vertex(m_vertex[i], t);
+          }
+        }
+        m_orphan_low[t] = m_none;
+        m_orphan_high[t] = 0;
+      }
+
+      void adopt_vertex(vertex_descriptor v, int t)
+      {
+        const std::size_t i = get(m_index, v);
+        const Distance d = get(m_dist, v);
+        out_edge_iterator ei, ei_end;
+
+        // A parent one level up keeps the labels exact.
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g), ei = m_current[i];
+             ei != ei_end; ++ei) {
+          vertex_descriptor u = target(*ei, m_g);
+          edge_descriptor arc = tree_arc(*ei, t);
+          if (in_tree(u, t) && get(m_dist, u) + 1 == d
+              && get(m_res, arc) > 0) {
+            set_parent(v, arc);
+            m_current[i] = ei;
+            return;
+          }
+        }
+
+        // Otherwise relabel to one more than the nearest neighbor.
+        Distance best = (std::numeric_limits<Distance>::max)();
+        out_edge_iterator best_edge;
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g); ei != ei_end; ++ei) {
+          vertex_descriptor u = target(*ei, m_g);
+          if (in_tree(u, t) && get(m_res, tree_arc(*ei, t)) > 0
+              && get(m_dist, u) < best) {
+            best = get(m_dist, u);
+            best_edge = ei;
+          }
+        }
+        const bool found = best != (std::numeric_limits<Distance>::max)();
+        if (found && best + 1 == d) {
+          set_parent(v, tree_arc(*best_edge, t));
+          m_current[i] = best_edge;
+          return;
+        }
+
+        orphan_children(v, t);
+        if (!found || static_cast<std::size_t>(best) + 1 > m_front[t] + 1) {
+          // Nobody in t can take v before the next level is scanned.
+          put(m_color, v, Color::gray());
+          m_free.push_back(v);
+        } else {
+          put(m_dist, v, best + 1);
+          set_parent(v, tree_arc(*best_edge, t));
+          m_current[i] = best_edge;
+          enqueue(v, t);
+        }
+      }
+
+      void orphan_children(vertex_descriptor v, int t)
+      {
+        out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g); ei != ei_end; ++ei) {
+          vertex_descriptor c = target(*ei, m_g);
+          if (in_tree(c, t) && m_has_parent[get(m_index, c)]
+              && get(m_pred, c) == (t == source_tree ? *ei : get(m_rev, *ei)))
+            make_orphan(c, t);
+        }
+      }
+
+      // Adds the free vertex v to tree t below its nearest neighbor there,
+      // if that does not skip a level.
+      bool join(vertex_descriptor v, int t)
+      {
+        Distance best = (std::numeric_limits<Distance>::max)();
+        out_edge_iterator ei, ei_end, best_edge;
+        for (boost::tie(ei, ei_end) = out_edges(v, m_g); ei != ei_end; ++ei) {
+          vertex_descriptor u = target(*ei, m_g);
+          if (in_tree(u, t) && get(m_res, tree_arc(*ei, t)) > 0
+              && get(m_dist, u) < best) {
+            best = get(m_dist, u);
+            best_edge = ei;
+          }
+        }
+        if (best == (std::numeric_limits<Distance>::max)()
+            || static_cast<std::size_t>(best) + 1 > m_front[t] + 1)
+          return false;
+        put(m_color, v, color_of(t));
+        put(m_dist, v, best + 1);
+        set_parent(v, tree_arc(*best_edge, t));
+        m_current[get(m_index, v)] = best_edge;
+        enqueue(v, t);
+        return true;
+      }
+
+      Graph& m_g;
+      EdgeCapacityMap m_cap;
+      ResidualCapacityEdgeMap m_res;
+      ReverseEdgeMap m_rev;
+      PredecessorMap m_pred;   // tree edge toward the root, in flow direction
+      ColorMap m_color;        // black: source tree, white: sink tree
+      DistanceMap m_dist;      // distance label within the tree
+      IndexMap m_index;
+      vertex_descriptor m_source, m_sink;
+      FlowValue m_flow;
+
+      std::vector<bool> m_has_parent;
+      std::vector<out_edge_iterator> m_current;  // adoption resumes here
+      std::vector<vertex_descriptor> m_vertex;   // by index
+
+      // Per tree: the level being scanned, the vertices to scan on it and
+      // on the next one, and the orphans bucketed by label.
+      std::size_t m_front[2];
+      std::size_t m_head[2];
+      std::vector<bool> m_queued[2];
+      std::vector<vertex_descriptor> m_queue[2], m_next[2];
+      std::vector<std::size_t> m_orphan_first[2];
+      std::size_t m_orphan_low[2], m_orphan_high[2];
+      std::vector<std::size_t> m_orphan_next;
+      std::vector<vertex_descriptor> m_free;
+      const std::size_t m_none;
+    };
+
+  } // namespace detail
+
+  template <class Graph,
+            class CapacityEdgeMap,
+            class ResidualCapacityEdgeMap,
+            class ReverseEdgeMap,
+            class PredecessorMap,
+            class ColorMap,
+            class DistanceMap,
+            class IndexMap>
+  typename property_traits<CapacityEdgeMap>::value_type
+  ibfs_max_flow(Graph& g,
+                CapacityEdgeMap cap,
+                ResidualCapacityEdgeMap res_cap,
+                ReverseEdgeMap rev_map,
+                PredecessorMap pre_map,
+                ColorMap color,
+                DistanceMap dist,
+                IndexMap idx,
+                typename graph_traits<Graph>::vertex_descriptor src,
+                typename graph_traits<Graph>::vertex_descriptor sink)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename graph_traits<Graph>::edge_descriptor edge_descriptor;
+
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( EdgeListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<CapacityEdgeMap, edge_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<ResidualCapacityEdgeMap, edge_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<ReverseEdgeMap, edge_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<PredecessorMap, vertex_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<ColorMap, vertex_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<DistanceMap, vertex_descriptor> ));
+    BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<IndexMap, vertex_descriptor> ));
+    BOOST_ASSERT(num_vertices(g) >= 2 && src != sink);
+
+    detail::ibfs_max_flow<
+      Graph, CapacityEdgeMap, ResidualCapacityEdgeMap, ReverseEdgeMap,
+      PredecessorMap, ColorMap, DistanceMap, IndexMap
+    > algo(g, cap, res_cap, rev_map, pre_map, color, dist, idx, src, sink);
+    return algo.max_flow();
+  }
+
+  template <class Graph,
+            class CapacityEdgeMap,
+            class ResidualCapacityEdgeMap,
+            class ReverseEdgeMap,
+            class IndexMap>
+  typename property_traits<CapacityEdgeMap>::value_type
+  ibfs_max_flow(Graph& g,
+                CapacityEdgeMap cap,
+                ResidualCapacityEdgeMap res_cap,
+                ReverseEdgeMap rev,
+                IndexMap idx,
+                typename graph_traits<Graph>::vertex_descriptor src,
+                typename graph_traits<Graph>::vertex_descriptor sink)
+  {
+    typename graph_traits<Graph>::vertices_size_type n = num_vertices(g);
+    std::vector<typename graph_traits<Graph>::edge_descriptor> pred(n);
+    std::vector<default_color_type> color(n);
+    std::vector<typename graph_traits<Graph>::vertices_size_type> dist(n);
+    return ibfs_max_flow(g, cap, res_cap, rev,
+                         make_iterator_property_map(pred.begin(), idx),
+                         make_iterator_property_map(color.begin(), idx),
+                         make_iterator_property_map(dist.begin(), idx),
+                         idx, src, sink);
+  }
+
+  // Use this one for the minimum cut: it is returned in the color map.
+  template <class Graph,
+            class CapacityEdgeMap,
+            class ResidualCapacityEdgeMap,
+            class ReverseEdgeMap,
+            class ColorMap,
+            class IndexMap>
+  typename property_traits<CapacityEdgeMap>::value_type
+  ibfs_max_flow(Graph& g,
+                CapacityEdgeMap cap,
+                ResidualCapacityEdgeMap res_cap,
+                ReverseEdgeMap rev,
+                ColorMap color,
+                IndexMap idx,
+                typename graph_traits<Graph>::vertex_descriptor src,
+                typename graph_traits<Graph>::vertex_descriptor sink)
+  {
+    typename graph_traits<Graph>::vertices_size_type n = num_vertices(g);
+    std::vector<typename graph_traits<Graph>::edge_descriptor> pred(n);
+    std::vector<typename graph_traits<Graph>::vertices_size_type> dist(n);
+    return ibfs_max_flow(g, cap, res_cap, rev,
+                         make_iterator_property_map(pred.begin(), idx),
+                         color,
+                         make_iterator_property_map(dist.begin(), idx),
+                         idx, src, sink);
+  }
+
+  template <class Graph, class P, class T, class R>
+  typename property_traits<typename property_map<Graph, edge_capacity_t>::const_type>::value_type
+  ibfs_max_flow(Graph& g,
+                typename graph_traits<Graph>::vertex_descriptor src,
+                typename graph_traits<Graph>::vertex_descriptor sink,
+                const bgl_named_params<P, T, R>& params)
+  {
+    return ibfs_max_flow(
+      g,
+      choose_const_pmap(get_param(params, edge_capacity), g, edge_capacity),
+      choose_pmap(get_param(params, edge_residual_capacity), g, edge_residual_capacity),
+      choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+      choose_pmap(get_param(params, vertex_predecessor), g, vertex_predecessor),
+      choose_pmap(get_param(params, vertex_color), g, vertex_color),
+      choose_pmap(get_param(params, vertex_distance), g, vertex_distance),
+      choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+      src, sink);
+  }
+
+  template <class Graph>
+  typename property_traits<typename property_map<Graph, edge_capacity_t>::const_type>::value_type
+  ibfs_max_flow(Graph& g,
+                typename graph_traits<Graph>::vertex_descriptor src,
+                typename graph_traits<Graph>::vertex_descriptor sink)
+  {
+    bgl_named_params<int, buffer_param_t> params(0); // bogus empty param
+    return ibfs_max_flow(g, src, sink, params);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_IBFS_MAX_FLOW_HPP
@@ -0,0 +1,343 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_INCREMENTAL_TOPOLOGICAL_ORDER_HPP
+#define BOOST_GRAPH_INCREMENTAL_TOPOLOGICAL_ORDER_HPP
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/topological_sort.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/mpl/bool.hpp>
+
+namespace boost {
+
+  // Incremental topological ordering
+  //
+  // Keeps a topological order of a directed acyclic graph up to date while
+  // edges are inserted, using the algorithm of Pearce and Kelly, "A Dynamic
+  // Topological Sort Algorithm for Directed Acyclic Graphs", ACM JEA 11
+  // (2006).  Inserting (u,v) with u already before v costs O(1).
+  // Otherwise only the vertices whose position lies between v and u are
+  // searched: those reachable from v and those reaching u are moved, and
+  // they reuse their own positions, so the rest of the order is not
+  // touched.  An insertion that would close a cycle is refused and leaves
+  // the graph unchanged.
+  //
+  // The graph must be modified through this object (add_edge, remove_edge
+  // and add_vertex) for the order to stay valid.  Backward searches use
+  // in_edges() when the graph is bidirectional; otherwise the in-edges are
+  // kept here.
+
+  template <typename Graph,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class incremental_topological_order
+  {
+    typedef graph_traits<Graph> Traits;
+  public:
+    typedef typename Traits::vertex_descriptor vertex_descriptor;
+    typedef typename Traits::edge_descriptor edge_descriptor;
+    typedef typename std::vector<vertex_descriptor>::size_type size_type;
+    typedef typename std::vector<vertex_descriptor>::const_iterator
+      const_iterator;
+
+    // Throws not_a_dag if g has a cycle.
+    explicit incremental_topological_order(Graph& g)
+      : m_g(g), m_index(get(vertex_index, static_cast<const Graph&>(g)))
+      { init(); }
+
+    incremental_topological_order(Graph& g, VertexIndexMap index)
+      : m_g(g), m_index(index) { init(); }
+
+    // Adds (u,v) unless it would create a cycle, in which case the graph
+    // is not modified and the second member of the result is false.
+    std::pair<edge_descriptor, bool>
+    add_edge(vertex_descriptor u, vertex_descriptor v)
+    {
+      if (!make_room(u, v))
+        return std::make_pair(edge_descriptor(), false);
+      std::pair<edge_descriptor, bool> r = boost::add_edge(u, v, m_g);
+      if (r.second)
+        record_in_edge(u, v, is_bidirectional());
+      return r;
+    }
+
+    template <typename EdgeProperty>
+    std::pair<edge_descriptor, bool>
+    add_edge(vertex_descriptor u, vertex_descriptor v, const EdgeProperty& p)
+    {
+      if (!make_room(u, v))
+        return std::make_pair(edge_descriptor(), false);
+      std::pair<edge_descriptor, bool> r = boost::add_edge(u, v, p, m_g);
+      if (r.second)
+        record_in_edge(u, v, is_bidirectional());
+      return r;
+    }
+
+    // True if adding (u,v) would close a cycle.  Does not reorder.
+    bool creates_cycle(vertex_descriptor u, vertex_descriptor v)
+    {
+      if (u == v)
+        return true;
+      if (m_ord[get(m_index, u)] < m_ord[get(m_index, v)])
+        return false;
+      bool cycle = !search_forward(v, m_ord[get(m_index, u)]);
+      clear_marks(m_forward);
+      return cycle;
+    }
+
+    // Removing an edge never invalidates the order.
+    void remove_edge(edge_descriptor e)
+    {
+      erase_in_edge(source(e, m_g), target(e, m_g), is_bidirectional());
+      boost::remove_edge(e, m_g);
+    }
+
+    // The new vertex goes last.  Its index must be the previous number of
+    // vertices, as with vecS vertex storage.
+    vertex_descriptor add_vertex()
+    {
+      vertex_descriptor v = boost::add_vertex(m_g);
+      append(v);
+      return v;
+    }
+
+    template <typename VertexProperty>
+    vertex_descriptor add_vertex(const VertexProperty& p)
+    {
+      vertex_descriptor v = boost::add_vertex(p, m_g);
+      append(v);
+      return v;
+    }
+
+    // Position of v in the current order.
+    size_type position(vertex_descriptor v) const
+      { return m_ord[get(m_index, v)]; }
+
+    vertex_descriptor vertex_at(size_type pos) const { return m_order[pos]; }
+
+    bool precedes(vertex_descriptor u, vertex_descriptor v) const
+      { return position(u) < position(v); }
+
+    // The vertices in topological order.
+    const_iterator begin() const { return m_order.begin(); }
+    const_iterator end() const { return m_order.end(); }
+    size_type size() const { return m_order.size(); }
+
+    const Graph& graph() const { return m_g; }
+
+  private:
+    typedef typename is_convertible<
+      typename Traits::traversal_category,
+      bidirectional_graph_tag>::type is_bidirectional;
+
+    struct position_less
+    {
+      explicit position_less(const incremental_topological_order& t)
+        : t(t) { }
+      bool operator()(vertex_descriptor a, vertex_descriptor b) const
+        { return t.position(a) < t.position(b); }
+      const incremental_topological_order& t;
+    };
+
+    void init()
+    {
+      const size_type n = num_vertices(m_g);
+      m_order.reserve(n);
+      topological_sort(m_g, std::back_inserter(m_order),
+                       vertex_index_map(m_index));
+      std::reverse(m_order.begin(), m_order.end());
+      m_ord.resize(n);
+      m_mark.assign(n, false);
+      for (size_type i = 0; i < n; ++i)
+        m_ord[get(m_index, m_order[i])] = i;
+      init_in_edges(is_bidirectional());
+    }
+
+    void append(vertex_descriptor v)
+    {
+      m_ord.push_back(m_order.size());
+      m_order.push_back(v);
+      m_mark.push_back(false);
+      if (!is_bidirectional::value)
+        m_in.resize(m_ord.size());
+    }
+
+    // Reorders the affected region so that u precedes v.  Returns false,
+    // leaving the order as it was, if v already reaches u.
+    bool make_room(vertex_descriptor u, vertex_descriptor v)
+    {
+      if (u == v)
+        return false;
+      size_type lb = position(v), ub = position(u);
+      if (ub < lb)
+        return true;
+      if (!search_forward(v, ub)) {
+        clear_marks(m_forward);
+        return false;
+      }
+      search_backward(u, lb, is_bidirectional());
+      reorder();
+      return true;
+    }
+
+    // Collects the vertices reachable from v whose position is below ub.
+    // Returns false if the vertex at ub is reached.
+    bool search_forward(vertex_descriptor v, size_type ub)
+    {
+      m_forward.clear();
+      m_stack.clear();
+      visit(v, m_forward);
+      while (!m_stack.empty()) {
+        vertex_descriptor w = m_stack.back();
+        m_stack.pop_back();
+        typename Traits::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(w, m_g); ei != ei_end; ++ei) {
+          vertex_descriptor x = target(*ei, m_g);
+          size_type p = position(x);
+          if (p == ub)
+            return false;
+          if (p < ub && !m_mark[get(m_index, x)])
+            visit(x, m_forward);
+        }
+      }
+      return true;
+    }
+
+    // Collects the vertices reaching u whose position is above lb.
+    void search_backward(vertex_descriptor u, size_type lb, mpl::true_)
+    {
+      m_backward.clear();
+      m_stack.clear();
+      visit(u, m_backward);
+      while (!m_stack.empty()) {
+        vertex_descriptor w = m_stack.back();
+        m_stack.pop_back();
+        typename Traits::in_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = in_edges(w, m_g); ei != ei_end; ++ei) {
+          vertex_descriptor x = source(*ei, m_g);
+          if (position(x) > lb && !m_mark[get(m_index, x)])
+            visit(x, m_backward);
+        }
+      }
+    }
+
+    void search_backward(vertex_descriptor u, size_type lb, mpl::false_)
+    {
+      m_backward.clear();
+      m_stack.clear();
+      visit(u, m_backward);
+      while (!m_stack.empty()) {
+        const std::vector<vertex_descriptor>& in
+          = m_in[get(m_index, m_stack.back())];
+        m_stack.pop_back();
+        for (size_type i = 0; i < in.size(); ++i) {
+          vertex_descriptor x = in[i];
+          if (position(x) > lb && !m_mark[get(m_index, x)])
+            visit(x, m_backward);
+        }
+      }
+    }
+
+    void visit(vertex_descriptor v, std::vector<vertex_descriptor>& found)
+    {
+      m_mark[get(m_index, v)] = true;
+      found.push_back(v);
+      m_stack.push_back(v);
+    }
+
+    void clear_marks(const std::vector<vertex_descriptor>& found)
+    {
+      for (size_type i = 0; i < found.size(); ++i)
+        m_mark[get(m_index, found[i])] = false;
+    }
+
+    // Everything reaching u goes before everything reachable from v; both
+    // groups keep their relative order and share their old positions.
+    void reorder()
+    {
+      position_less less(*this);
+      std::sort(m_backward.begin(), m_backward.end(), less);
+      std::sort(m_forward.begin(), m_forward.end(), less);
+
+      m_slots.clear();
+      for (size_type i = 0; i < m_backward.size(); ++i)
+        m_slots.push_back(position(m_backward[i]));
+      for (size_type i = 0; i < m_forward.size(); ++i)
+        m_slots.push_back(position(m_forward[i]));
+      std::inplace_merge(m_slots.begin(),
+                         m_slots.begin() + m_backward.size(), m_slots.end());
+
+      size_type k = 0;
+      for (size_type i = 0; i < m_backward.size(); ++i)
+        place(m_backward[i], m_slots[k++]);
+      for (size_type i = 0; i < m_forward.size(); ++i)
+        place(m_forward[i], m_slots[k++]);
+      clear_marks(m_backward);
+      clear_marks(m_forward);
+    }
+
+    void place(vertex_descriptor v, size_type pos)
+    {
+      m_ord[get(m_index, v)] = pos;
+      m_order[pos] = v;
+    }
+
+    void init_in_edges(mpl::true_) { }
+
+    void init_in_edges(mpl::false_)
+    {
+      m_in.resize(m_ord.size());
+      typename Traits::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi) {
+        typename Traits::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(*vi, m_g); ei != ei_end; ++ei)
+          m_in[get(m_index, target(*ei, m_g))].push_back(*vi);
+      }
+    }
+
+    void record_in_edge(vertex_descriptor, vertex_descriptor, mpl::true_) { }
+
+    void record_in_edge(vertex_descriptor u, vertex_descriptor v, mpl::false_)
+      { m_in[get(m_index, v)].push_back(u); }
+
+    void erase_in_edge(vertex_descriptor, vertex_descriptor, mpl::true_) { }
+
+    void erase_in_edge(vertex_descriptor u, vertex_descriptor v, mpl::false_)
+    {
+      std::vector<vertex_descriptor>& in = m_in[get(m_index, v)];
+      typename std::vector<vertex_descriptor>::iterator i
+        = std::find(in.begin(), in.end(), u);
+      if (i != in.end()) {
+        *i = in.back();
+        in.pop_back();
+      }
+    }
+
+    Graph& m_g;
+    VertexIndexMap m_index;
+    std::vector<vertex_descriptor> m_order;  // position -> vertex
+    std::vector<size_type> m_ord;            // vertex index -> position
+    std::vector<bool> m_mark;
+    std::vector<std::vector<vertex_descriptor> > m_in;
+
+    // Scratch space reused by every insertion.
+    std::vector<vertex_descriptor> m_forward, m_backward, m_stack;
+    std::vector<size_type> m_slots;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_INCREMENTAL_TOPOLOGICAL_ORDER_HPP
@@ -17,36 +17,176 @@
     (VertexAndEdgeListGraph& g, 
      DistanceMatrix& D,
      const bgl_named_params<P, T, R>& params)
+
+  and its streaming counterpart
+
+  template <class VertexAndEdgeListGraph, class RowSink,
+            class P, class T, class R>
+  bool
+  johnson_all_pairs_shortest_paths_rows
+    (VertexAndEdgeListGraph& g,
+     RowSink sink,
+     const bgl_named_params<P, T, R>& params)
+
+  The per-source Dijkstra phase of both runs on number_of_threads(n)
+  worker threads.
  */
 
 #ifndef BOOST_GRAPH_JOHNSON_HPP
 #define BOOST_GRAPH_JOHNSON_HPP
 
+#include <vector>
+#include <algorithm>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/property_map/shared_array_property_map.hpp>
 #include <boost/graph/bellman_ford_shortest_paths.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/type_traits/same_traits.hpp>
 #include <boost/concept/assert.hpp>
 
 namespace boost {
 
-  template <class VertexAndEdgeListGraph, class DistanceMatrix,
+  namespace detail {
+
+    // Per-thread state for the Dijkstra phase.  It is reused for every
+    // source the thread handles, so once the heap has grown to its working
+    // size no further allocation takes place.
+    template <typename Graph2, typename DT, typename Compare>
+    struct johnson_workspace
+    {
+      typedef typename graph_traits<Graph2>::vertex_descriptor Vertex;
+      typedef typename property_map<Graph2, vertex_index_t>::const_type
+        VertexID2;
+      typedef iterator_property_map<typename std::vector<DT>::iterator,
+                                    VertexID2> DistanceMap;
+      typedef iterator_property_map<
+        typename std::vector<default_color_type>::iterator, VertexID2>
+        ColorMap;
+      typedef iterator_property_map<
+        typename std::vector<std::size_t>::iterator, VertexID2>
+        IndexInHeapMap;
+      typedef d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, DistanceMap,
+                                  Compare> Queue;
+
+      johnson_workspace(std::size_t n2, VertexID2 id2, const Compare& compare)
+        : distance(n2), color(n2), index_in_heap(n2), row(n2 - 1),
+          Q(DistanceMap(distance.begin(), id2),
+            IndexInHeapMap(index_in_heap.begin(), id2), compare) { }
+
+      std::vector<DT> distance;
+      std::vector<default_color_type> color;
+      std::vector<std::size_t> index_in_heap;
+      std::vector<DT> row;
+      Queue Q;
+    };
+
+    // Computes the row of the i-th original vertex (vertex i + 1 of g2) and
+    // hands it to the sink.  Called concurrently for distinct i.
+    template <typename Graph1, typename Graph2, typename RowSink,
+              typename Potential, typename DT, typename Compare,
+              typename Combine>
+    struct johnson_row_body
+    {
+      typedef johnson_workspace<Graph2, DT, Compare> Workspace;
+      typedef typename graph_traits<Graph1>::vertex_descriptor Vertex1;
+      typedef typename graph_traits<Graph2>::vertex_descriptor Vertex2;
+      typedef typename property_map<Graph2, edge_weight2_t>::const_type
+        WeightHat;
+
+      johnson_row_body(const Graph2& g2, const std::vector<Vertex1>& verts1,
+                       Potential h, std::vector<Workspace*>& ws,
+                       RowSink& sink, parallel_mutex& m,
+                       const Compare& compare, const Combine& combine,
+                       const DT& inf, const DT& zero)
+        : m_g2(g2), m_verts1(verts1), m_h(h), m_ws(ws), m_sink(sink),
+          m_mutex(m), m_compare(compare), m_combine(combine), m_inf(inf),
+          m_zero(zero) { }
+
+      void operator()(std::size_t i, std::size_t t)
+      {
+        typedef color_traits<default_color_type> Color;
+        Workspace& ws = *m_ws[t];
+        const std::size_t n2 = ws.distance.size();
+        std::fill(ws.distance.begin(), ws.distance.end(), m_inf);
+        std::fill(ws.color.begin(), ws.color.end(), Color::white());
+
+        typename Workspace::VertexID2 id2 = get(vertex_index, m_g2);
+        typename Workspace::DistanceMap d(ws.distance.begin(), id2);
+        Vertex2 s = vertex(i + 1, m_g2);
+        put(d, s, m_zero);
+
+        dummy_property_map pred;
+        dijkstra_bfs_visitor<dijkstra_visitor<>, typename Workspace::Queue,
+          WeightHat, dummy_property_map, typename Workspace::DistanceMap,
+          Combine, Compare>
+          bfs_vis(dijkstra_visitor<>(), ws.Q, get(edge_weight2, m_g2),
+                  pred, d, m_combine, m_compare, m_zero);
+        breadth_first_visit(m_g2, &s, &s + 1, ws.Q, bfs_vis,
+          typename Workspace::ColorMap(ws.color.begin(), id2));
+
+        for (std::size_t j = 1; j < n2; ++j)
+          ws.row[j - 1] = m_combine((get(m_h, vertex(j, m_g2))
+                                     - get(m_h, s)), ws.distance[j]);
+
+        parallel_lock lock(m_mutex);
+        m_sink(m_verts1[i + 1], ws.row.begin(), ws.row.end());
+      }
+
+      const Graph2& m_g2;
+      const std::vector<Vertex1>& m_verts1;
+      Potential m_h;
+      std::vector<Workspace*>& m_ws;
+      RowSink& m_sink;
+      parallel_mutex& m_mutex;
+      Compare m_compare;
+      Combine m_combine;
+      DT m_inf;
+      DT m_zero;
+    };
+
+    // Row sink that stores each row in a DistanceMatrix.
+    template <class DistanceMatrix, class VertexID>
+    struct johnson_matrix_sink
+    {
+      johnson_matrix_sink(DistanceMatrix& D, VertexID id)
+        : m_D(D), m_id(id) { }
+
+      template <class Vertex, class RowIterator>
+      void operator()(Vertex u, RowIterator first, RowIterator last)
+      {
+        typename property_traits<VertexID>::value_type i = get(m_id, u), j = 0;
+        for (; first != last; ++first, ++j)
+          m_D[i][j] = *first;
+      }
+
+      DistanceMatrix& m_D;
+      VertexID m_id;
+    };
+
+  } // namespace detail
+
+  // Streaming variant: rather than filling a V x V matrix, calls
+  // sink(u, first, last) once for every vertex u, where [first, last)
+  // holds the distances from u to all vertices in vertex index order.
+  // Only O(V) extra storage per thread is used.  Calls to the sink are
+  // serialized, but with more than one thread the rows arrive in no
+  // particular order.
+  template <class VertexAndEdgeListGraph, class RowSink,
             class VertexID, class Weight, typename BinaryPredicate, 
             typename BinaryFunction, typename Infinity, class DistanceZero>
   bool
-  johnson_all_pairs_shortest_paths(VertexAndEdgeListGraph& g1, 
-               DistanceMatrix& D,
+  johnson_all_pairs_shortest_paths_rows(VertexAndEdgeListGraph& g1,
+               RowSink sink,
                VertexID id1, Weight w1, const BinaryPredicate& compare, 
                const BinaryFunction& combine, const Infinity& inf,
-               DistanceZero zero)
+               DistanceZero zero, std::size_t num_threads = 1)
   {
     typedef graph_traits<VertexAndEdgeListGraph> Traits1;
     typedef typename property_traits<Weight>::value_type DT;
-    BOOST_CONCEPT_ASSERT(( BasicMatrixConcept<DistanceMatrix,
-      typename Traits1::vertices_size_type, DT> ));
 
     typedef typename Traits1::directed_category DirCat;
     bool is_undirected = is_same<DirCat, undirected_tag>::value;
@@ -74,12 +214,11 @@ namespace boost {
     typename Traits2::vertex_descriptor s = *vertices(g2).first;
     {
       typename Traits1::vertex_iterator v, v_end;
-      int i = 1;
-      for (boost::tie(v, v_end) = vertices(g1); v != v_end; ++v, ++i) {
+      for (boost::tie(v, v_end) = vertices(g1); v != v_end; ++v) {
         typename Traits2::edge_descriptor e; bool z;
         boost::tie(e, z) = add_edge(s, get(id1, *v) + 1, g2);
         put(w, e, zero);
-        verts1[i] = *v;
+        verts1[get(id1, *v) + 1] = *v;
       }
       typename Traits1::edge_iterator e, e_end;
       for (boost::tie(e, e_end) = edges(g1); e != e_end; ++e) {
@@ -94,7 +233,7 @@ namespace boost {
         }
       }
     }
-    typename Traits2::vertex_iterator v, v_end, u, u_end;
+    typename Traits2::vertex_iterator v, v_end;
     typename Traits2::edge_iterator e, e_end;
     shared_array_property_map<DT,VertexID2> h(num_vertices(g2), id2);
 
@@ -115,21 +254,57 @@ namespace boost {
           b = target(*e, g2);
         put(w_hat, *e, combine((get(h, a) - get(h, b)), get(w, *e)));
       }
-      for (boost::tie(u, u_end) = vertices(g2); u != u_end; ++u) {
-        dijkstra_visitor<> dvis;
-        dijkstra_shortest_paths
-          (g2, *u, pred, d, w_hat, id2, compare, combine, inf, zero,dvis);
-        for (boost::tie(v, v_end) = vertices(g2); v != v_end; ++v) {
-          if (*u != s && *v != s) {
-            D[get(id2, *u)-1][get(id2, *v)-1] = combine((get(h, *v) - get(h, *u)), get(d, *v));
-          }
-        }
+
+      typedef detail::johnson_row_body<VertexAndEdgeListGraph, Graph2,
+        RowSink, shared_array_property_map<DT,VertexID2>, DT,
+        BinaryPredicate, BinaryFunction> Body;
+      typedef typename Body::Workspace Workspace;
+
+      const std::size_t n = num_vertices(g1);
+      if (n == 0)
+        return true;
+      num_threads = (std::min)(n,
+        detail::resolve_number_of_threads(num_threads));
+      const Graph2& cg2 = g2;
+      std::vector<Workspace*> ws(num_threads, static_cast<Workspace*>(0));
+      try {
+        for (std::size_t t = 0; t < num_threads; ++t)
+          ws[t] = new Workspace(n + 1, get(vertex_index, cg2), compare);
+        detail::parallel_mutex m;
+        Body body(cg2, verts1, h, ws, sink, m, compare, combine, inf, zero);
+        detail::parallel_for(n, body, num_threads);
+      } catch (...) {
+        for (std::size_t t = 0; t < num_threads; ++t)
+          delete ws[t];
+        throw;
       }
+      for (std::size_t t = 0; t < num_threads; ++t)
+        delete ws[t];
       return true;
     } else
       return false;
   }
 
+  template <class VertexAndEdgeListGraph, class DistanceMatrix,
+            class VertexID, class Weight, typename BinaryPredicate,
+            typename BinaryFunction, typename Infinity, class DistanceZero>
+  bool
+  johnson_all_pairs_shortest_paths(VertexAndEdgeListGraph& g1,
+               DistanceMatrix& D,
+               VertexID id1, Weight w1, const BinaryPredicate& compare,
+               const BinaryFunction& combine, const Infinity& inf,
+               DistanceZero zero, std::size_t num_threads = 1)
+  {
+    typedef graph_traits<VertexAndEdgeListGraph> Traits1;
+    typedef typename property_traits<Weight>::value_type DT;
+    BOOST_CONCEPT_ASSERT(( BasicMatrixConcept<DistanceMatrix,
+      typename Traits1::vertices_size_type, DT> ));
+
+    return johnson_all_pairs_shortest_paths_rows
+      (g1, detail::johnson_matrix_sink<DistanceMatrix, VertexID>(D, id1),
+       id1, w1, compare, combine, inf, zero, num_threads);
+  }
+
   template <class VertexAndEdgeListGraph, class DistanceMatrix,
             class VertexID, class Weight, class DistanceZero>
   bool
@@ -166,7 +341,33 @@ namespace boost {
           closed_plus<WT>()),
         choose_param(get_param(params, distance_inf_t()), 
           std::numeric_limits<WT>::max BOOST_PREVENT_MACRO_SUBSTITUTION()),
-         choose_param(get_param(params, distance_zero_t()), WT()) );
+         choose_param(get_param(params, distance_zero_t()), WT()),
+         choose_param(get_param(params, number_of_threads_t()),
+          std::size_t(1)) );
+    }
+
+    template <class VertexAndEdgeListGraph, class RowSink,
+              class P, class T, class R, class Weight,
+              class VertexID>
+    bool
+    johnson_rows_dispatch(VertexAndEdgeListGraph& g,
+                          RowSink sink,
+                          const bgl_named_params<P, T, R>& params,
+                          Weight w, VertexID id)
+    {
+      typedef typename property_traits<Weight>::value_type WT;
+
+      return johnson_all_pairs_shortest_paths_rows
+        (g, sink, id, w,
+        choose_param(get_param(params, distance_compare_t()),
+          std::less<WT>()),
+        choose_param(get_param(params, distance_combine_t()),
+          closed_plus<WT>()),
+        choose_param(get_param(params, distance_inf_t()),
+          std::numeric_limits<WT>::max BOOST_PREVENT_MACRO_SUBSTITUTION()),
+         choose_param(get_param(params, distance_zero_t()), WT()),
+         choose_param(get_param(params, number_of_threads_t()),
+          std::size_t(1)) );
     }
 
   } // namespace detail
@@ -196,6 +397,31 @@ namespace boost {
       (g, D, params, get(edge_weight, g), get(vertex_index, g));
   }
 
+  template <class VertexAndEdgeListGraph, class RowSink,
+            class P, class T, class R>
+  bool
+  johnson_all_pairs_shortest_paths_rows
+    (VertexAndEdgeListGraph& g,
+     RowSink sink,
+     const bgl_named_params<P, T, R>& params)
+  {
+    return detail::johnson_rows_dispatch
+      (g, sink, params,
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index)
+       );
+  }
+
+  template <class VertexAndEdgeListGraph, class RowSink>
+  bool
+  johnson_all_pairs_shortest_paths_rows
+    (VertexAndEdgeListGraph& g, RowSink sink)
+  {
+    bgl_named_params<int,int> params(1);
+    return detail::johnson_rows_dispatch
+      (g, sink, params, get(edge_weight, g), get(vertex_index, g));
+  }
+
 } // namespace boost
 
 #endif // BOOST_GRAPH_JOHNSON_HPP
@@ -21,6 +21,8 @@
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/pending/disjoint_sets.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/assert.hpp>
 
 
@@ -648,6 +650,196 @@ namespace boost
   };
 
 
+  namespace detail
+  {
+    // Shared state of karp_sipser_matching.  Mates and degrees are kept by
+    // vertex index in atomic counters; a vertex is matched by claiming its
+    // mate slot and then its partner's, and the first claim is undone if
+    // the second fails, so concurrent threads never build inconsistent
+    // pairs.  A degree counts the edges to unmatched neighbors.
+    template <typename Graph, typename VertexIndexMap>
+    class karp_sipser_matcher
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor_t;
+      typedef typename graph_traits<Graph>::vertex_iterator vertex_iterator_t;
+      typedef typename graph_traits<Graph>::out_edge_iterator out_edge_iterator_t;
+
+    public:
+      karp_sipser_matcher(const Graph& g, VertexIndexMap vm)
+        : m_g(g), m_vm(vm), m_n(num_vertices(g)), m_vertex(m_n),
+          m_mate(m_n), m_degree(m_n), m_races(1)
+      {
+        vertex_iterator_t vi, vi_end;
+        for(boost::tie(vi,vi_end) = vertices(g); vi != vi_end; ++vi)
+          m_vertex[get(vm, *vi)] = *vi;
+      }
+
+      void run(std::size_t num_threads)
+      {
+        phase p0(*this, count_degrees), p1(*this, degree_one),
+          p2(*this, match_any);
+        parallel_for(m_n, p0, num_threads, 1024);
+        // First the vertices whose only neighbor is forced, then the
+        // rest.  A vertex that lost a race may have been left unmatched
+        // next to an unmatched neighbor, so the second pass is repeated
+        // until no race occurs, after a few rounds on a single thread.
+        parallel_for(m_n, p1, num_threads, 1024);
+        for(int round = 0; ; ++round)
+          {
+            m_races.set(0, 0);
+            parallel_for(m_n, p2, round < 3 ? num_threads : 1, 1024);
+            if (m_races.load(0) == 0)
+              break;
+          }
+      }
+
+      std::size_t mate(std::size_t i) const { return m_mate.load(i); }
+      std::size_t none() const { return m_n; }
+      vertex_descriptor_t vertex(std::size_t i) const { return m_vertex[i]; }
+
+    private:
+      enum phase_kind { count_degrees, degree_one, match_any };
+
+      struct phase
+      {
+        phase(karp_sipser_matcher& m, phase_kind kind)
+          : m_matcher(m), m_kind(kind) {}
+        void operator()(std::size_t i, std::size_t) const
+        { m_matcher.visit(i, m_kind); }
+        karp_sipser_matcher& m_matcher;
+        phase_kind m_kind;
+      };
+
+      void visit(std::size_t i, phase_kind kind)
+      {
+        if (kind == count_degrees)
+          {
+            m_mate.set(i, m_n);
+            std::size_t d = 0;
+            out_edge_iterator_t ei, ei_end;
+            for(boost::tie(ei,ei_end) = out_edges(m_vertex[i], m_g); ei != ei_end; ++ei)
+              if (get(m_vm, target(*ei, m_g)) != i)
+                ++d;
+            m_degree.set(i, d);
+            return;
+          }
+        if (m_mate.load(i) != m_n)
+          return;
+        if (kind == degree_one && m_degree.load(i) != 1)
+          return;
+        std::vector<std::size_t> stack(1, i);
+        while (!stack.empty())
+          {
+            std::size_t v = stack.back();
+            stack.pop_back();
+            std::size_t u = free_neighbor(v);
+            if (u != m_n && try_match(v, u))
+              {
+                release_neighbors(v, stack);
+                release_neighbors(u, stack);
+              }
+          }
+      }
+
+      std::size_t free_neighbor(std::size_t v) const
+      {
+        if (m_mate.load(v) != m_n)
+          return m_n;
+        out_edge_iterator_t ei, ei_end;
+        for(boost::tie(ei,ei_end) = out_edges(m_vertex[v], m_g); ei != ei_end; ++ei)
+          {
+            std::size_t u = get(m_vm, target(*ei, m_g));
+            if (u != v && m_mate.load(u) == m_n)
+              return u;
+          }
+        return m_n;
+      }
+
+      bool try_match(std::size_t v, std::size_t u)
+      {
+        if (m_mate.compare_and_set(v, m_n, u))
+          {
+            if (m_mate.compare_and_set(u, m_n, v))
+              return true;
+            m_mate.set(v, m_n);
+          }
+        m_races.increment(0);
+        return false;
+      }
+
+      // The unmatched neighbors of a newly matched vertex lose an edge;
+      // those left with one are matched next (the degree-one rule).
+      void release_neighbors(std::size_t v, std::vector<std::size_t>& stack)
+      {
+        out_edge_iterator_t ei, ei_end;
+        for(boost::tie(ei,ei_end) = out_edges(m_vertex[v], m_g); ei != ei_end; ++ei)
+          {
+            std::size_t w = get(m_vm, target(*ei, m_g));
+            if (w != v && m_mate.load(w) == m_n && m_degree.decrement(w) == 1)
+              stack.push_back(w);
+          }
+      }
+
+      const Graph& m_g;
+      VertexIndexMap m_vm;
+      std::size_t m_n;
+      std::vector<vertex_descriptor_t> m_vertex;
+      parallel_counters m_mate;
+      parallel_counters m_degree;
+      parallel_counters m_races;
+    };
+  } // namespace detail
+
+
+  template <typename Graph, typename MateMap>
+  struct karp_sipser_matching
+  {
+    // The Karp-Sipser heuristic: as long as some unmatched vertex has a
+    // single unmatched neighbor, match the two, since some maximum
+    // matching does; otherwise match an arbitrary edge.  Vertices are
+    // taken in index order, and with more than one thread they are
+    // distributed over the threads, which match vertices concurrently.
+    // This takes time O(m + n) and typically leaves far fewer unmatched
+    // vertices than greedy_matching.
+
+    typedef typename graph_traits< Graph >::vertex_iterator vertex_iterator_t;
+
+    static void find_matching(const Graph& g, MateMap mate)
+    {
+      find_matching(g, mate, get(vertex_index, g), 1);
+    }
+
+    template <typename VertexIndexMap>
+    static void find_matching(const Graph& g, MateMap mate, VertexIndexMap vm,
+                              std::size_t num_threads)
+    {
+      detail::karp_sipser_matcher<Graph, VertexIndexMap> matcher(g, vm);
+      matcher.run(detail::resolve_number_of_threads(num_threads));
+      vertex_iterator_t vi, vi_end;
+      for(boost::tie(vi,vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+          std::size_t m = matcher.mate(get(vm, *vi));
+          put(mate, *vi, m == matcher.none()
+              ? graph_traits<Graph>::null_vertex() : matcher.vertex(m));
+        }
+    }
+  };
+
+
+
+
+  template <typename Graph, typename MateMap>
+  struct parallel_karp_sipser_matching
+  {
+    // karp_sipser_matching on one thread per hardware thread.
+    static void find_matching(const Graph& g, MateMap mate)
+    {
+      karp_sipser_matching<Graph, MateMap>::find_matching
+        (g, mate, get(vertex_index, g), 0);
+    }
+  };
+
+
   
 
   template <typename Graph, typename MateMap>
@@ -894,6 +1086,238 @@ namespace boost
     edmonds_maximum_cardinality_matching(g, mate, get(vertex_index,g));
   }
 
+
+
+
+  //***************************************************************************
+  //***************************************************************************
+  //               Bipartite Graphs
+  //***************************************************************************
+  //***************************************************************************
+
+  namespace detail
+  {
+    // The algorithm of Hopcroft and Karp.  Each phase finds the length of
+    // the shortest augmenting paths with a breadth-first search from the
+    // free vertices on the white side, then augments along a maximal set
+    // of shortest paths with depth-first searches that only follow edges
+    // into the next layer.  There are O(sqrt(n)) phases of O(m) each.
+    // The depth-first search keeps its own stack, so long paths do not
+    // exhaust the call stack.
+    template <typename Graph, typename VertexIndexMap, typename PartitionMap>
+    class hopcroft_karp_matcher
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor_t;
+      typedef typename graph_traits<Graph>::vertex_iterator vertex_iterator_t;
+      typedef typename graph_traits<Graph>::out_edge_iterator out_edge_iterator_t;
+      typedef typename property_traits<PartitionMap>::value_type partition_t;
+
+    public:
+      hopcroft_karp_matcher(const Graph& g, VertexIndexMap vm,
+                            PartitionMap partition)
+        : m_g(g), m_vm(vm), m_partition(partition), m_n(num_vertices(g)),
+          m_infinity(m_n + 1), m_vertex(m_n), m_mate(m_n, m_n),
+          m_white(m_n), m_dist(m_n), m_current(m_n)
+      {
+        vertex_iterator_t vi, vi_end;
+        for(boost::tie(vi,vi_end) = vertices(g); vi != vi_end; ++vi)
+          {
+            std::size_t i = get(vm, *vi);
+            m_vertex[i] = *vi;
+            m_white[i] = get(partition, *vi) == color_traits<partition_t>::white();
+            if (m_white[i])
+              m_left.push_back(i);
+          }
+      }
+
+      template <typename MateMap>
+      void run(MateMap mate)
+      {
+        // Keep the pairs of the initial matching that cross the partition.
+        for(std::size_t i = 0; i < m_n; ++i)
+          {
+            vertex_descriptor_t m = get(mate, m_vertex[i]);
+            if (m != graph_traits<Graph>::null_vertex())
+              {
+                std::size_t j = get(m_vm, m);
+                if (m_white[i] != m_white[j] && get(mate, m) == m_vertex[i])
+                  m_mate[i] = j;
+              }
+          }
+
+        while (search_layers())
+          for(std::size_t k = 0; k < m_left.size(); ++k)
+            if (m_mate[m_left[k]] == m_n)
+              augment_from(m_left[k]);
+
+        for(std::size_t i = 0; i < m_n; ++i)
+          put(mate, m_vertex[i], m_mate[i] == m_n
+              ? graph_traits<Graph>::null_vertex() : m_vertex[m_mate[i]]);
+      }
+
+    private:
+      // Only edges between the two sides count.
+      bool crosses(std::size_t u, std::size_t v) const
+      { return m_white[u] != m_white[v]; }
+
+      // Layers the white vertices by their distance from a free white
+      // vertex in the alternating graph, and records the length of the
+      // shortest augmenting path; returns false if there is none.
+      bool search_layers()
+      {
+        std::vector<std::size_t> queue;
+        queue.reserve(m_left.size());
+        for(std::size_t k = 0; k < m_left.size(); ++k)
+          {
+            std::size_t u = m_left[k];
+            if (m_mate[u] == m_n)
+              {
+                m_dist[u] = 0;
+                queue.push_back(u);
+              }
+            else
+              m_dist[u] = m_infinity;
+          }
+
+        m_limit = m_infinity;
+        for(std::size_t head = 0; head < queue.size(); ++head)
+          {
+            std::size_t u = queue[head];
+            if (m_dist[u] + 1 >= m_limit)
+              continue;
+            out_edge_iterator_t ei, ei_end;
+            for(boost::tie(ei,ei_end) = out_edges(m_vertex[u], m_g); ei != ei_end; ++ei)
+              {
+                std::size_t v = get(m_vm, target(*ei, m_g));
+                if (!crosses(u, v))
+                  continue;
+                std::size_t w = m_mate[v];
+                if (w == m_n)
+                  m_limit = m_dist[u] + 1;
+                else if (m_dist[w] == m_infinity)
+                  {
+                    m_dist[w] = m_dist[u] + 1;
+                    queue.push_back(w);
+                  }
+              }
+          }
+
+        for(std::size_t k = 0; k < m_left.size(); ++k)
+          m_current[m_left[k]] = out_edges(m_vertex[m_left[k]], m_g).first;
+        return m_limit != m_infinity;
+      }
+
+      void augment_from(std::size_t root)
+      {
+        // m_path holds the white vertices of the current path and
+        // m_through the black vertex by which each was entered.
+        m_path.assign(1, root);
+        m_through.assign(1, m_n);
+        while (!m_path.empty())
+          {
+            std::size_t u = m_path.back();
+            out_edge_iterator_t& ei = m_current[u];
+            out_edge_iterator_t ei_end = out_edges(m_vertex[u], m_g).second;
+            bool advanced = false;
+            for(; ei != ei_end; ++ei)
+              {
+                std::size_t v = get(m_vm, target(*ei, m_g));
+                if (!crosses(u, v))
+                  continue;
+                std::size_t w = m_mate[v];
+                if (w == m_n)
+                  {
+                    if (m_dist[u] + 1 == m_limit)
+                      {
+                        flip(v);
+                        return;
+                      }
+                  }
+                else if (m_dist[w] == m_dist[u] + 1)
+                  {
+                    ++ei;
+                    m_path.push_back(w);
+                    m_through.push_back(v);
+                    advanced = true;
+                    break;
+                  }
+              }
+            if (!advanced)
+              {
+                // No augmenting path through u in this phase.
+                m_dist[u] = m_infinity;
+                m_path.pop_back();
+                m_through.pop_back();
+              }
+          }
+      }
+
+      // Augments along m_path, ending at the free black vertex v.
+      void flip(std::size_t v)
+      {
+        for(std::size_t k = m_path.size(); k-- > 0; )
+          {
+            std::size_t u = m_path[k];
+            m_mate[u] = v;
+            m_mate[v] = u;
+            v = m_through[k];
+          }
+      }
+
+      const Graph& m_g;
+      VertexIndexMap m_vm;
+      PartitionMap m_partition;
+      std::size_t m_n, m_infinity, m_limit;
+      std::vector<vertex_descriptor_t> m_vertex;
+      std::vector<std::size_t> m_mate;
+      std::vector<bool> m_white;
+      std::vector<std::size_t> m_left;
+      std::vector<std::size_t> m_dist;
+      std::vector<out_edge_iterator_t> m_current;
+      std::vector<std::size_t> m_path, m_through;
+    };
+  } // namespace detail
+
+
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename PartitionMap>
+  void hopcroft_karp_maximum_cardinality_matching
+    (const Graph& g, MateMap mate, VertexIndexMap vm, PartitionMap partition,
+     std::size_t num_threads = 1)
+  {
+    karp_sipser_matching<Graph, MateMap>::find_matching(g, mate, vm, num_threads);
+    detail::hopcroft_karp_matcher<Graph, VertexIndexMap, PartitionMap>
+      matcher(g, vm, partition);
+    matcher.run(mate);
+  }
+
+
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename PartitionMap>
+  inline bool checked_edmonds_maximum_cardinality_matching
+    (const Graph& g, MateMap mate, VertexIndexMap vm, PartitionMap partition)
+  {
+    hopcroft_karp_maximum_cardinality_matching(g, mate, vm, partition);
+    return maximum_cardinality_matching_verifier<Graph,MateMap,VertexIndexMap>
+      ::verify_matching(g, mate, vm);
+  }
+
+
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename PartitionMap>
+  inline void edmonds_maximum_cardinality_matching
+    (const Graph& g, MateMap mate, VertexIndexMap vm, PartitionMap partition)
+  {
+    // With a bipartition at hand there are no blossoms to shrink.
+    hopcroft_karp_maximum_cardinality_matching(g, mate, vm, partition);
+  }
+
 }//namespace boost
 
 #endif //BOOST_GRAPH_MAXIMUM_CARDINALITY_MATCHING_HPP
@@ -39,12 +39,16 @@
 #include <boost/concept_check.hpp>
 #include <boost/concept/assert.hpp>
 #include <boost/graph/buffer_concepts.hpp>
+#include <boost/graph/detail/bucket_max_queue.hpp>
 #include <boost/graph/exception.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/named_function_params.hpp>
 #include <boost/graph/visitors.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <boost/type_traits/is_integral.hpp>
 
 #include <set>
 
@@ -212,8 +216,116 @@ maximum_adjacency_search(const Graph& g, WeightMap weights, MASVisitor vis, cons
                                             assignments, pq);
   }
 
+  namespace detail {
+    // Whether the keys of a maximum adjacency search stay small enough for
+    // a bucket_max_queue.  Every key is bounded by the number of vertices
+    // plus the total weight, which must not exceed a few times the size of
+    // the graph; negative weights rule out buckets altogether.
+    template <class Graph, class WeightMap>
+    bool
+    mas_keys_fit_buckets(const Graph& g, WeightMap weights) {
+      typedef typename boost::property_traits<WeightMap>::value_type weight_type;
+
+      boost::uintmax_t limit = num_vertices(g), total = 0;
+      BGL_FORALL_VERTICES_T(u, g, Graph) {
+        limit += out_degree(u, g);
+      }
+      limit *= 4;
+
+      BGL_FORALL_VERTICES_T(u, g, Graph) {
+        BGL_FORALL_OUTEDGES_T(u, e, g, Graph) {
+          const weight_type w = get(weights, e);
+          if (w < weight_type(0) || boost::uintmax_t(w) > limit - total)
+            return false;
+          total += boost::uintmax_t(w);
+        }
+      }
+      return true;
+    }
+  } // end namespace detail
+
   namespace graph {
     namespace detail {
+      // Calls f with the max-priority queue given in the arguments or, if
+      // there is none, with a 4-ary heap.
+      template <typename Graph, typename WeightMap, typename ArgPack, typename Function>
+      void
+      with_mas_queue(const Graph& g, WeightMap, const ArgPack& params, Function f, mpl::false_) {
+        typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+        typedef typename boost::property_traits<WeightMap>::value_type weight_type;
+
+        typedef boost::detail::make_priority_queue_from_arg_pack_gen<boost::graph::keywords::tag::max_priority_queue, weight_type, vertex_descriptor, std::greater<weight_type> > default_pq_gen_type;
+
+        default_pq_gen_type pq_gen(choose_param(get_param(params, boost::distance_zero_t()), weight_type(0)));
+
+        typename boost::result_of<default_pq_gen_type(const Graph&, const ArgPack&)>::type pq = pq_gen(g, params);
+
+        f(pq);
+      }
+
+      // Without a queue in the arguments, integral weights whose keys stay
+      // small get a bucket_max_queue, with which each search takes
+      // O(V + E) time.
+      template <typename Graph, typename WeightMap, typename ArgPack, typename Function>
+      void
+      with_mas_queue(const Graph& g, WeightMap w, const ArgPack& params, Function f, mpl::true_) {
+        using namespace boost::graph::keywords;
+        typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+        typedef typename boost::property_traits<WeightMap>::value_type weight_type;
+
+        if (!boost::detail::mas_keys_fit_buckets(g, w)) {
+          with_mas_queue(g, w, params, f, mpl::false_());
+          return;
+        }
+
+        typedef boost::detail::map_maker<Graph, ArgPack, tag::distance_map, weight_type> key_map_maker;
+        typedef typename boost::detail::override_const_property_result<ArgPack, tag::vertex_index_map, vertex_index_t, Graph>::type index_map;
+
+        boost::bucket_max_queue<vertex_descriptor, typename key_map_maker::map_type, index_map>
+          pq(num_vertices(g),
+             key_map_maker::make_map(g, params, weight_type(0)),
+             boost::detail::override_const_property(params, _vertex_index_map, g, vertex_index));
+
+        f(pq);
+      }
+
+      template <typename Graph, typename WeightMap, typename ArgPack, typename Function>
+      void
+      with_mas_queue(const Graph& g, WeightMap w, const ArgPack& params, Function f) {
+        typedef typename boost::property_traits<WeightMap>::value_type weight_type;
+        typedef mpl::bool_<
+          boost::is_integral<weight_type>::value
+          && !boost::detail::parameter_exists<ArgPack, boost::graph::keywords::tag::max_priority_queue>::value
+        > use_buckets;
+
+        with_mas_queue(g, w, params, f, use_buckets());
+      }
+
+      template <typename Graph, typename WeightMap, typename MASVisitor, typename VertexAssignmentMap>
+      struct mas_with_queue {
+        typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+
+        mas_with_queue(const Graph& g, WeightMap w, MASVisitor vis, vertex_descriptor start, VertexAssignmentMap assignments)
+          : g(g), w(w), vis(vis), start(start), assignments(assignments) {}
+
+        template <typename KeyedUpdatablePriorityQueue>
+        void operator()(KeyedUpdatablePriorityQueue& pq) const {
+          boost::maximum_adjacency_search(g, w, vis, start, assignments, pq);
+        }
+
+        const Graph& g;
+        WeightMap w;
+        MASVisitor vis;
+        vertex_descriptor start;
+        VertexAssignmentMap assignments;
+      };
+
+      template <typename Graph, typename WeightMap, typename MASVisitor, typename VertexAssignmentMap>
+      mas_with_queue<Graph, WeightMap, MASVisitor, VertexAssignmentMap>
+      make_mas_with_queue(const Graph& g, WeightMap w, MASVisitor vis, typename boost::graph_traits<Graph>::vertex_descriptor start, VertexAssignmentMap assignments) {
+        return mas_with_queue<Graph, WeightMap, MASVisitor, VertexAssignmentMap>(g, w, vis, start, assignments);
+      }
+
       template <typename WeightMap>
       struct mas_dispatch {
         typedef void result_type;
@@ -225,22 +337,15 @@ maximum_adjacency_search(const Graph& g, WeightMap weights, MASVisitor vis, cons
 
           using namespace boost::graph::keywords;
           typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
-          typedef typename WeightMap::value_type weight_type;
-
-          typedef boost::detail::make_priority_queue_from_arg_pack_gen<boost::graph::keywords::tag::max_priority_queue, weight_type, vertex_descriptor, std::greater<weight_type> > default_pq_gen_type;
-
-          default_pq_gen_type pq_gen(choose_param(get_param(params, boost::distance_zero_t()), weight_type(0)));
 
-          typename boost::result_of<default_pq_gen_type(const Graph&, const ArgPack&)>::type pq = pq_gen(g, params);
-
-          boost::maximum_adjacency_search
+          with_mas_queue(g, w, params,
+               make_mas_with_queue
                (g,
                 w,
                 params [ _visitor | make_mas_visitor(null_visitor())],
                 params [ _root_vertex | *vertices(g).first],
-                params [ _vertex_assignment_map | boost::detail::make_property_map_from_arg_pack_gen<boost::graph::keywords::tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, params)],
-                pq
-                );
+                params [ _vertex_assignment_map | boost::detail::make_property_map_from_arg_pack_gen<boost::graph::keywords::tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, params)]
+                ));
         }
       };
 
@@ -257,23 +362,17 @@ maximum_adjacency_search(const Graph& g, WeightMap weights, MASVisitor vis, cons
           typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
 
           // get edge_weight_t as the weight type
-          typedef typename boost::property_map<Graph, edge_weight_t> WeightMap;
-          typedef typename WeightMap::value_type weight_type;
-
-          typedef boost::detail::make_priority_queue_from_arg_pack_gen<boost::graph::keywords::tag::max_priority_queue, weight_type, vertex_descriptor, std::greater<weight_type> > default_pq_gen_type;
-
-          default_pq_gen_type pq_gen(choose_param(get_param(params, boost::distance_zero_t()), weight_type(0)));
+          typedef typename boost::property_map<Graph, edge_weight_t>::const_type WeightMap;
+          WeightMap w = get(edge_weight, g);
 
-          typename boost::result_of<default_pq_gen_type(const Graph&, const ArgPack&)>::type pq = pq_gen(g, params);
-
-          boost::maximum_adjacency_search
+          with_mas_queue(g, w, params,
+               make_mas_with_queue
                (g,
-                get(edge_weight, g),
+                w,
                 params [ _visitor | make_mas_visitor(null_visitor())],
                 params [ _root_vertex | *vertices(g).first],
-                params [ _vertex_assignment_map | boost::detail::make_property_map_from_arg_pack_gen<boost::graph::keywords::tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, params)],
-                pq
-                );
+                params [ _vertex_assignment_map | boost::detail::make_property_map_from_arg_pack_gen<boost::graph::keywords::tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, params)]
+                ));
         }
       };
     } // end namespace detail
@@ -0,0 +1,1033 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_MAXIMUM_WEIGHTED_MATCHING_HPP
+#define BOOST_GRAPH_MAXIMUM_WEIGHTED_MATCHING_HPP
+
+#include <vector>
+#include <queue>
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/assert.hpp>
+
+// Weighted matching on general graphs by Edmonds' primal-dual blossom
+// algorithm.  The stages and the blossom bookkeeping follow the
+// formulation of Galil ("Efficient algorithms for finding maximum matching
+// in graphs", 1986).  As in Gabow's O(VE log V) version and in Blossom V,
+// the dual adjustment is driven by priority queues instead of scans over
+// all vertices and blossoms: every candidate edge and every odd blossom is
+// entered into a heap under a key that stays valid while its labels do not
+// change, and the duals themselves are updated lazily.
+
+namespace boost
+{
+
+  namespace detail {
+
+    // The solver works on a copy of the graph as an edge list with the
+    // vertices numbered 0 .. n-1 and the blossoms n .. 2n-1.  Edge k has
+    // the endpoints 2k and 2k+1; the remote endpoint of a matched vertex is
+    // kept in m_mate, so that p ^ 1 is the other end of the same edge.
+    //
+    // The weights are doubled internally, and the vertex duals are kept
+    // at twice their value, so that all duals and slacks stay integral
+    // for integral weights.
+    template <typename Weight>
+    class weighted_matching_solver
+    {
+    public:
+      typedef std::size_t size_type;
+
+      static size_type none() { return size_type(-1); }
+
+      // With perfect set, the solver returns a maximum-cardinality matching
+      // of maximum weight (a maximum-weight perfect matching if there is
+      // one); otherwise a maximum-weight matching.
+      weighted_matching_solver(size_type n, bool perfect)
+        : m_n(n), m_perfect(perfect)
+      { }
+
+      void add_edge(size_type u, size_type v, Weight w)
+      {
+        if (u == v)
+          return;
+        m_endpoint.push_back(u);
+        m_endpoint.push_back(v);
+        m_weight.push_back(w + w);
+      }
+
+      // Asks for the pair (u, v) to be matched if that does not cost any
+      // extra work.  Only used for perfect matchings, whose duals need not
+      // be equal at the free vertices.
+      void suggest_pair(size_type u, size_type v)
+      {
+        m_suggested.push_back(std::make_pair(u, v));
+      }
+
+      void solve();
+
+      size_type mate(size_type v) const
+      {
+        return m_mate[v] == none() ? none() : m_endpoint[m_mate[v]];
+      }
+
+    private:
+      enum { unlabeled = 0, s_label = 1, t_label = 2, breadcrumb = 4 };
+
+      struct heap_entry
+      {
+        Weight key;
+        size_type item, stamp;
+        heap_entry(Weight k, size_type i, size_type s)
+          : key(k), item(i), stamp(s) { }
+        bool operator>(const heap_entry& x) const { return key > x.key; }
+      };
+      typedef std::priority_queue<heap_entry, std::vector<heap_entry>,
+                                  std::greater<heap_entry> > heap_type;
+
+      size_type edge_of(size_type p) const { return p / 2; }
+      size_type top(size_type v) const { return m_inblossom[v]; }
+
+      // Current duals.  S vertices lose and T vertices gain delta at every
+      // dual adjustment of this stage since they got their label;
+      // top-level blossoms do the opposite.
+      Weight vertex_dual(size_type v) const
+      {
+        if (m_class[v] == s_label) return m_dual[v] - (m_delta - m_since[v]);
+        if (m_class[v] == t_label) return m_dual[v] + (m_delta - m_since[v]);
+        return m_dual[v];
+      }
+
+      Weight blossom_dual(size_type b) const
+      {
+        if (m_class[b] == s_label) return m_dual[b] + (m_delta - m_since[b]);
+        if (m_class[b] == t_label) return m_dual[b] - (m_delta - m_since[b]);
+        return m_dual[b];
+      }
+
+      // Changes whenever one of the endpoints of edge k changes its class,
+      // since the counters only grow.
+      size_type edge_stamp(size_type k) const
+      {
+        return m_stamp[m_endpoint[2 * k]] + m_stamp[m_endpoint[2 * k + 1]];
+      }
+
+      Weight slack(size_type k) const
+      {
+        return vertex_dual(m_endpoint[2 * k]) + vertex_dual(m_endpoint[2 * k + 1])
+          - 2 * m_weight[k];
+      }
+
+      void set_vertex_class(size_type v, int c)
+      {
+        if (m_class[v] == c)
+          return;
+        m_dual[v] = vertex_dual(v);
+        m_since[v] = m_delta;
+        m_class[v] = c;
+        ++m_stamp[v];
+      }
+
+      void set_blossom_class(size_type b, int c)
+      {
+        if (b < m_n) {
+          set_vertex_class(b, c);
+          return;
+        }
+        if (m_class[b] != c) {
+          m_dual[b] = blossom_dual(b);
+          m_since[b] = m_delta;
+          m_class[b] = c;
+          ++m_stamp[b];
+          if (c == t_label)
+            m_odd_blossoms.push(heap_entry(m_dual[b] + m_delta, b, m_stamp[b]));
+        }
+        leaves(b, m_scratch);
+        for (size_type i = 0; i < m_scratch.size(); ++i)
+          set_vertex_class(m_scratch[i], c);
+      }
+
+      void leaves(size_type b, std::vector<size_type>& out) const
+      {
+        out.clear();
+        std::vector<size_type> stack(1, b);
+        while (!stack.empty()) {
+          size_type t = stack.back();
+          stack.pop_back();
+          if (t < m_n)
+            out.push_back(t);
+          else
+            stack.insert(stack.end(), m_children[t].begin(), m_children[t].end());
+        }
+      }
+
+      // Index into a blossom's cyclic child list, Python style.
+      static size_type cyclic(std::ptrdiff_t j, std::size_t len)
+      {
+        std::ptrdiff_t l = std::ptrdiff_t(len);
+        return size_type(((j % l) + l) % l);
+      }
+
+      void greedy_start();
+      void assign_label(size_type w, int t, size_type p);
+      size_type scan_blossom(size_type v, size_type w);
+      void add_blossom(size_type base, size_type k);
+      void expand_blossom(size_type b);
+      void augment_blossom(size_type b, size_type v);
+      void augment_matching(size_type k);
+      bool consider(size_type v, size_type p);
+      void push_to_unlabeled(size_type k);
+      void remove_tree(size_type root);
+
+      size_type m_n;
+      bool m_perfect;
+      std::vector<size_type> m_endpoint;
+      std::vector<Weight> m_weight;
+      std::vector<std::pair<size_type, size_type> > m_suggested;
+
+      std::vector<size_type> m_first, m_neighbend;
+      std::vector<size_type> m_mate;
+      std::vector<int> m_label;
+      std::vector<size_type> m_labelend, m_inblossom, m_parent, m_base;
+      std::vector<std::vector<size_type> > m_children, m_endps;
+      std::vector<size_type> m_unused;
+      std::vector<char> m_allowed;
+      std::vector<size_type> m_queue, m_scratch;
+
+      // The root of the tree each labeled vertex belongs to, and the
+      // vertices labeled in each tree (possibly stale or repeated).
+      std::vector<size_type> m_tree;
+      std::vector<std::vector<size_type> > m_members;
+
+      // Lazy duals: the dual at the time m_since of the last label change,
+      // the class (label) it was taken under, and a change counter that
+      // invalidates heap entries.
+      std::vector<Weight> m_dual, m_since;
+      std::vector<int> m_class;
+      std::vector<size_type> m_stamp;
+      Weight m_delta;
+
+      // Edges from an S vertex to an unlabeled one, keyed by slack + delta;
+      // edges between two S blossoms, keyed by slack + 2 delta; T blossoms,
+      // keyed by dual + delta.
+      heap_type m_to_unlabeled, m_between_s, m_odd_blossoms;
+    };
+
+
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::solve()
+    {
+      const size_type n = m_n, m = m_weight.size();
+
+      m_first.assign(n + 1, 0);
+      for (size_type p = 0; p < 2 * m; ++p)
+        ++m_first[m_endpoint[p] + 1];
+      for (size_type v = 0; v < n; ++v)
+        m_first[v + 1] += m_first[v];
+      m_neighbend.resize(2 * m);
+      {
+        std::vector<size_type> pos(m_first.begin(), m_first.end() - 1);
+        for (size_type p = 0; p < 2 * m; ++p)
+          m_neighbend[pos[m_endpoint[p]]++] = p ^ 1;
+      }
+
+      Weight max_weight = Weight();
+      for (size_type k = 0; k < m; ++k)
+        max_weight = (std::max)(max_weight, m_weight[k]);
+
+      m_mate.assign(n, none());
+      m_label.assign(2 * n, unlabeled);
+      m_labelend.assign(2 * n, none());
+      m_inblossom.resize(n);
+      m_parent.assign(2 * n, none());
+      m_base.assign(2 * n, none());
+      m_children.assign(2 * n, std::vector<size_type>());
+      m_endps.assign(2 * n, std::vector<size_type>());
+      m_unused.clear();
+      for (size_type v = 0; v < n; ++v) {
+        m_inblossom[v] = v;
+        m_base[v] = v;
+        m_unused.push_back(2 * n - 1 - v);
+      }
+      m_dual.assign(2 * n, Weight());
+      std::fill(m_dual.begin(), m_dual.begin() + n, max_weight);
+      m_since.assign(2 * n, Weight());
+      m_class.assign(2 * n, unlabeled);
+      m_stamp.assign(2 * n, 0);
+      m_allowed.assign(m, 0);
+      m_delta = Weight();
+
+      if (m_perfect)
+        greedy_start();
+
+      // Grow alternating trees from all free vertices at once.  After an
+      // augmentation only the two trees involved are dissolved; the others
+      // keep their labels.
+      m_tree.assign(n, none());
+      m_members.assign(n, std::vector<size_type>());
+      m_queue.clear();
+      Weight free_dual = Weight();
+      for (size_type v = 0; v < n; ++v)
+        if (m_mate[v] == none()) {
+          assign_label(v, s_label, none());
+          free_dual = m_dual[v];
+        }
+
+      for (;;) {
+        while (!m_queue.empty()) {
+          size_type v = m_queue.back();
+          m_queue.pop_back();
+          if (m_label[top(v)] != s_label)
+            continue; // its tree was dissolved
+          for (size_type i = m_first[v]; i < m_first[v + 1]; ++i)
+            if (consider(v, m_neighbend[i]))
+              break;
+        }
+
+        // Find the dual adjustment.  Without a perfect matching to find,
+        // all free vertices have the smallest dual, and the search ends
+        // when it reaches zero.
+        int type = 0;
+        Weight delta = Weight();
+        if (!m_perfect) {
+          type = 1;
+          delta = free_dual - m_delta;
+        }
+        while (!m_to_unlabeled.empty()) {
+          const heap_entry& e = m_to_unlabeled.top();
+          size_type a = m_endpoint[2 * e.item], b = m_endpoint[2 * e.item + 1];
+          if (m_label[top(a)] != s_label)
+            std::swap(a, b);
+          if (m_label[top(a)] == s_label && m_label[top(b)] == unlabeled
+              && edge_stamp(e.item) == e.stamp)
+            break;
+          m_to_unlabeled.pop();
+        }
+        size_type delta_edge = none(), delta_blossom = none();
+        if (!m_to_unlabeled.empty()) {
+          Weight d = m_to_unlabeled.top().key - m_delta;
+          if (type == 0 || d < delta) {
+            type = 2;
+            delta = d;
+            delta_edge = m_to_unlabeled.top().item;
+          }
+        }
+        while (!m_between_s.empty()) {
+          size_type k = m_between_s.top().item;
+          size_type a = m_endpoint[2 * k], b = m_endpoint[2 * k + 1];
+          if (top(a) != top(b) && m_label[top(a)] == s_label
+              && m_label[top(b)] == s_label
+              && edge_stamp(k) == m_between_s.top().stamp)
+            break;
+          m_between_s.pop();
+        }
+        if (!m_between_s.empty()) {
+          Weight d = (m_between_s.top().key - 2 * m_delta) / 2;
+          if (type == 0 || d < delta) {
+            type = 3;
+            delta = d;
+            delta_edge = m_between_s.top().item;
+          }
+        }
+        while (!m_odd_blossoms.empty()) {
+          const heap_entry& e = m_odd_blossoms.top();
+          if (m_class[e.item] == t_label && m_stamp[e.item] == e.stamp)
+            break;
+          m_odd_blossoms.pop();
+        }
+        if (!m_odd_blossoms.empty()) {
+          Weight d = m_odd_blossoms.top().key - m_delta;
+          if (type == 0 || d < delta) {
+            type = 4;
+            delta = d;
+            delta_blossom = m_odd_blossoms.top().item;
+          }
+        }
+
+        if (type == 0 || type == 1)
+          break; // no augmenting path left, or free vertices at zero
+        if (delta < Weight())
+          delta = Weight(); // rounding with floating point weights
+        m_delta += delta;
+
+        if (type == 4) {
+          m_odd_blossoms.pop();
+          expand_blossom(delta_blossom);
+          continue;
+        }
+        m_allowed[delta_edge] = 1;
+        size_type p = 2 * delta_edge + 1;
+        if (m_label[top(m_endpoint[p ^ 1])] != s_label)
+          p ^= 1;
+        consider(m_endpoint[p ^ 1], p);
+      }
+    }
+
+
+    // Lower the duals vertex by vertex to make an edge tight, preferring the
+    // suggested pairs, and match along tight edges between free vertices.
+    // The steps are multiples of two because all slacks are even, so the
+    // free vertices keep duals of equal parity.
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::greedy_start()
+    {
+      for (size_type i = 0; i < m_suggested.size(); ++i) {
+        size_type u = m_suggested[i].first, v = m_suggested[i].second;
+        if (u >= m_n || v >= m_n || m_mate[u] != none() || m_mate[v] != none())
+          continue;
+        size_type pair = none();
+        for (size_type j = m_first[u]; j < m_first[u + 1]; ++j) {
+          size_type p = m_neighbend[j];
+          if (m_endpoint[p] == v
+              && (pair == none() || slack(edge_of(p)) < slack(edge_of(pair))))
+            pair = p;
+        }
+        if (pair == none())
+          continue;
+        for (int side = 0; side < 2 && slack(edge_of(pair)) > Weight(); ++side) {
+          size_type x = side == 0 ? u : v;
+          Weight lower = slack(edge_of(pair));
+          for (size_type j = m_first[x]; j < m_first[x + 1]; ++j)
+            lower = (std::min)(lower, slack(edge_of(m_neighbend[j])));
+          m_dual[x] -= lower;
+        }
+        if (!(slack(edge_of(pair)) > Weight())) {
+          m_mate[u] = pair;
+          m_mate[v] = pair ^ 1;
+        }
+      }
+
+      for (size_type v = 0; v < m_n; ++v) {
+        if (m_mate[v] != none() || m_first[v] == m_first[v + 1])
+          continue;
+        Weight lower = slack(edge_of(m_neighbend[m_first[v]]));
+        for (size_type j = m_first[v]; j < m_first[v + 1]; ++j)
+          lower = (std::min)(lower, slack(edge_of(m_neighbend[j])));
+        m_dual[v] -= lower;
+        for (size_type j = m_first[v]; j < m_first[v + 1]; ++j) {
+          size_type p = m_neighbend[j];
+          if (m_mate[m_endpoint[p]] == none() && !(slack(edge_of(p)) > Weight())) {
+            m_mate[v] = p;
+            m_mate[m_endpoint[p]] = p ^ 1;
+            break;
+          }
+        }
+      }
+    }
+
+
+    // Look at the edge from S vertex v to the endpoint p.  Returns true
+    // if the matching was augmented.
+    template <typename Weight>
+    bool weighted_matching_solver<Weight>::consider(size_type v, size_type p)
+    {
+      size_type k = edge_of(p), w = m_endpoint[p];
+      size_type bw = top(w);
+      if (top(v) == bw)
+        return false;
+      if (!m_allowed[k]) {
+        Weight s = slack(k);
+        if (s > Weight()) {
+          if (m_label[bw] == s_label)
+            m_between_s.push(heap_entry(s + 2 * m_delta, k, edge_stamp(k)));
+          else if (m_label[bw] == unlabeled)
+            m_to_unlabeled.push(heap_entry(s + m_delta, k, edge_stamp(k)));
+          // Edges into T blossoms keep their slack until the blossom is
+          // expanded, which reinserts them.
+          return false;
+        }
+        m_allowed[k] = 1;
+      }
+      if (m_label[bw] == unlabeled)
+        assign_label(w, t_label, p ^ 1);
+      else if (m_label[bw] == s_label) {
+        size_type base = scan_blossom(v, w);
+        if (base != none())
+          add_blossom(base, k);
+        else {
+          size_type r1 = m_tree[v], r2 = m_tree[w];
+          augment_matching(k);
+          remove_tree(r1);
+          remove_tree(r2);
+          return true;
+        }
+      } else if (m_label[w] == unlabeled) {
+        // w is inside a T blossom; remember how to reach it in case the
+        // blossom is expanded.
+        m_label[w] = t_label;
+        m_labelend[w] = p ^ 1;
+      }
+      return false;
+    }
+
+
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::assign_label
+      (size_type w, int t, size_type p)
+    {
+      size_type b = top(w);
+      BOOST_ASSERT(m_label[w] == unlabeled && m_label[b] == unlabeled);
+      size_type root = p == none() ? w : m_tree[m_endpoint[p]];
+      set_blossom_class(b, t);
+      leaves(b, m_scratch);
+      for (size_type i = 0; i < m_scratch.size(); ++i) {
+        m_label[m_scratch[i]] = unlabeled;
+        m_tree[m_scratch[i]] = root;
+      }
+      m_members[root].insert(m_members[root].end(), m_scratch.begin(), m_scratch.end());
+      m_label[w] = m_label[b] = t;
+      m_labelend[w] = m_labelend[b] = p;
+      if (t == s_label)
+        m_queue.insert(m_queue.end(), m_scratch.begin(), m_scratch.end());
+      else {
+        size_type base = m_base[b];
+        BOOST_ASSERT(m_mate[base] != none());
+        assign_label(m_endpoint[m_mate[base]], s_label, m_mate[base] ^ 1);
+      }
+    }
+
+
+    // Trace back from v and w to the roots of their trees.  Returns the
+    // base of the new blossom, or none() if the trees are different and
+    // there is an augmenting path.
+    template <typename Weight>
+    typename weighted_matching_solver<Weight>::size_type
+    weighted_matching_solver<Weight>::scan_blossom(size_type v, size_type w)
+    {
+      std::vector<size_type> path;
+      size_type base = none();
+      while (v != none() || w != none()) {
+        size_type b = top(v);
+        if (m_label[b] & breadcrumb) {
+          base = m_base[b];
+          break;
+        }
+        BOOST_ASSERT(m_label[b] == s_label);
+        path.push_back(b);
+        m_label[b] = s_label | breadcrumb;
+        if (m_labelend[b] == none())
+          v = none();
+        else {
+          v = m_endpoint[m_labelend[b]];
+          b = top(v);
+          BOOST_ASSERT(m_label[b] == t_label);
+          v = m_endpoint[m_labelend[b]];
+        }
+        if (w != none())
+          std::swap(v, w);
+      }
+      for (size_type i = 0; i < path.size(); ++i)
+        m_label[path[i]] = s_label;
+      return base;
+    }
+
+
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::add_blossom(size_type base, size_type k)
+    {
+      size_type v = m_endpoint[2 * k], w = m_endpoint[2 * k + 1];
+      size_type bb = top(base), bv = top(v), bw = top(w);
+      size_type b = m_unused.back();
+      m_unused.pop_back();
+      m_base[b] = base;
+      m_parent[b] = none();
+      m_parent[bb] = b;
+      std::vector<size_type>& path = m_children[b];
+      std::vector<size_type>& endps = m_endps[b];
+      path.clear();
+      endps.clear();
+      while (bv != bb) {
+        m_parent[bv] = b;
+        path.push_back(bv);
+        endps.push_back(m_labelend[bv]);
+        v = m_endpoint[m_labelend[bv]];
+        bv = top(v);
+      }
+      path.push_back(bb);
+      std::reverse(path.begin(), path.end());
+      std::reverse(endps.begin(), endps.end());
+      endps.push_back(2 * k);
+      while (bw != bb) {
+        m_parent[bw] = b;
+        path.push_back(bw);
+        endps.push_back(m_labelend[bw] ^ 1);
+        w = m_endpoint[m_labelend[bw]];
+        bw = top(w);
+      }
+      m_label[b] = s_label;
+      m_labelend[b] = m_labelend[bb];
+
+      // The children stop changing their duals; the former T vertices
+      // become S and are scanned.
+      for (size_type i = 0; i < path.size(); ++i)
+        if (path[i] >= m_n && m_class[path[i]] != unlabeled) {
+          m_dual[path[i]] = blossom_dual(path[i]);
+          m_class[path[i]] = unlabeled;
+          ++m_stamp[path[i]];
+        }
+      m_dual[b] = Weight();
+      m_since[b] = m_delta;
+      m_class[b] = s_label;
+      ++m_stamp[b];
+      leaves(b, m_scratch);
+      for (size_type i = 0; i < m_scratch.size(); ++i) {
+        size_type x = m_scratch[i];
+        if (m_label[top(x)] == t_label)
+          m_queue.push_back(x);
+        m_inblossom[x] = b;
+        set_vertex_class(x, s_label);
+      }
+      for (size_type i = 0; i < path.size(); ++i)
+        if (path[i] >= m_n)
+          m_label[path[i]] = unlabeled;
+    }
+
+
+    // Reinsert the edge k, now from an S vertex to an unlabeled one.
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::push_to_unlabeled(size_type k)
+    {
+      Weight s = slack(k);
+      if (m_allowed[k] || !(s > Weight()))
+        m_allowed[k] = 1;
+      m_to_unlabeled.push(heap_entry(s + m_delta, k, edge_stamp(k)));
+    }
+
+
+    // Unlabel the vertices of the tree rooted at root after an
+    // augmentation.  Edges from the other trees into it become candidates
+    // for the next dual adjustment, and what those trees remembered about
+    // its vertices is dropped.
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::remove_tree(size_type root)
+    {
+      std::vector<size_type> members;
+      members.swap(m_members[root]);
+      size_type kept = 0;
+      for (size_type i = 0; i < members.size(); ++i) {
+        size_type x = members[i], b = top(x);
+        if (m_tree[x] != root)
+          continue;
+        m_tree[x] = none();
+        members[kept++] = x;
+        if (m_label[b] != unlabeled) {
+          m_label[b] = unlabeled;
+          m_labelend[b] = none();
+          if (b >= m_n && m_class[b] != unlabeled) {
+            m_dual[b] = blossom_dual(b);
+            m_class[b] = unlabeled;
+            ++m_stamp[b];
+          }
+        }
+        m_label[x] = unlabeled;
+        m_labelend[x] = none();
+        set_vertex_class(x, unlabeled);
+      }
+      for (size_type i = 0; i < kept; ++i) {
+        size_type x = members[i];
+        for (size_type e = m_first[x]; e < m_first[x + 1]; ++e) {
+          // Edges inside a blossom are cleared as well: the blossom may
+          // be expanded once its duals have moved on.
+          size_type q = m_neighbend[e], y = m_endpoint[q];
+          m_allowed[edge_of(q)] = 0;
+          if (top(y) == top(x))
+            continue;
+          if (m_label[top(y)] == s_label)
+            push_to_unlabeled(edge_of(q));
+          else if (m_label[top(y)] == t_label && m_label[y] == t_label
+                   && m_labelend[y] == (q ^ 1))
+            m_label[y] = unlabeled;
+        }
+      }
+    }
+
+
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::expand_blossom(size_type b)
+    {
+      std::vector<size_type> children;
+      children.swap(m_children[b]);
+      for (size_type i = 0; i < children.size(); ++i) {
+        size_type s = children[i];
+        m_parent[s] = none();
+        if (s < m_n)
+          m_inblossom[s] = s;
+        else {
+          leaves(s, m_scratch);
+          for (size_type j = 0; j < m_scratch.size(); ++j)
+            m_inblossom[m_scratch[j]] = s;
+        }
+      }
+
+      {
+        // The vertices lose their T label; the children along the even
+        // path from the entry child to the base get relabeled.
+        for (size_type i = 0; i < children.size(); ++i) {
+          leaves(children[i], m_scratch);
+          for (size_type j = 0; j < m_scratch.size(); ++j)
+            set_vertex_class(m_scratch[j], unlabeled);
+        }
+        const std::vector<size_type>& endps = m_endps[b];
+        const std::size_t len = children.size();
+        size_type entrychild = top(m_endpoint[m_labelend[b] ^ 1]);
+        std::ptrdiff_t j = std::find(children.begin(), children.end(), entrychild)
+          - children.begin();
+        std::ptrdiff_t jstep;
+        size_type endptrick;
+        if (j & 1) {
+          j -= std::ptrdiff_t(len);
+          jstep = 1;
+          endptrick = 0;
+        } else {
+          jstep = -1;
+          endptrick = 1;
+        }
+        size_type p = m_labelend[b];
+        while (j != 0) {
+          m_label[m_endpoint[p ^ 1]] = unlabeled;
+          m_label[m_endpoint[endps[cyclic(j - std::ptrdiff_t(endptrick), len)]
+                             ^ endptrick ^ 1]] = unlabeled;
+          assign_label(m_endpoint[p ^ 1], t_label, p);
+          m_allowed[edge_of(endps[cyclic(j - std::ptrdiff_t(endptrick), len)])] = 1;
+          j += jstep;
+          p = endps[cyclic(j - std::ptrdiff_t(endptrick), len)] ^ endptrick;
+          m_allowed[edge_of(p)] = 1;
+          j += jstep;
+        }
+        size_type bv = children[cyclic(j, len)];
+        m_label[m_endpoint[p ^ 1]] = m_label[bv] = t_label;
+        m_labelend[m_endpoint[p ^ 1]] = m_labelend[bv] = p;
+        set_blossom_class(bv, t_label);
+        j += jstep;
+        while (children[cyclic(j, len)] != entrychild) {
+          bv = children[cyclic(j, len)];
+          if (m_label[bv] == s_label) {
+            j += jstep;
+            continue;
+          }
+          leaves(bv, m_scratch);
+          size_type reached = none();
+          for (size_type i = 0; i < m_scratch.size(); ++i)
+            if (m_label[m_scratch[i]] != unlabeled) {
+              reached = m_scratch[i];
+              break;
+            }
+          if (reached != none()) {
+            BOOST_ASSERT(m_label[reached] == t_label && top(reached) == bv);
+            m_label[reached] = unlabeled;
+            m_label[m_endpoint[m_mate[m_base[bv]]]] = unlabeled;
+            assign_label(reached, t_label, m_labelend[reached]);
+          }
+          j += jstep;
+        }
+
+        // Edges from S vertices into the children left unlabeled compete
+        // for the next dual adjustment again.
+        for (size_type i = 0; i < children.size(); ++i) {
+          if (m_label[children[i]] != unlabeled)
+            continue;
+          std::vector<size_type> inside;
+          leaves(children[i], inside);
+          for (size_type l = 0; l < inside.size(); ++l) {
+            size_type x = inside[l];
+            m_tree[x] = none();
+            for (size_type e = m_first[x]; e < m_first[x + 1]; ++e) {
+              size_type q = m_neighbend[e];
+              if (m_label[top(m_endpoint[q])] == s_label)
+                push_to_unlabeled(edge_of(q));
+            }
+          }
+        }
+      }
+
+      m_label[b] = unlabeled;
+      m_labelend[b] = none();
+      m_endps[b].clear();
+      m_base[b] = none();
+      m_class[b] = unlabeled;
+      m_dual[b] = Weight();
+      ++m_stamp[b];
+      m_unused.push_back(b);
+    }
+
+
+    // Swap matched and unmatched edges on the even path from vertex v to
+    // the base of blossom b, which then becomes v.
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::augment_blossom(size_type b, size_type v)
+    {
+      size_type t = v;
+      while (m_parent[t] != b)
+        t = m_parent[t];
+      if (t >= m_n)
+        augment_blossom(t, v);
+      std::vector<size_type>& children = m_children[b];
+      std::vector<size_type>& endps = m_endps[b];
+      const std::size_t len = children.size();
+      std::ptrdiff_t i = std::find(children.begin(), children.end(), t)
+        - children.begin();
+      std::ptrdiff_t j = i, jstep;
+      size_type endptrick;
+      if (i & 1) {
+        j -= std::ptrdiff_t(len);
+        jstep = 1;
+        endptrick = 0;
+      } else {
+        jstep = -1;
+        endptrick = 1;
+      }
+      while (j != 0) {
+        j += jstep;
+        t = children[cyclic(j, len)];
+        size_type p = endps[cyclic(j - std::ptrdiff_t(endptrick), len)] ^ endptrick;
+        if (t >= m_n)
+          augment_blossom(t, m_endpoint[p]);
+        j += jstep;
+        t = children[cyclic(j, len)];
+        if (t >= m_n)
+          augment_blossom(t, m_endpoint[p ^ 1]);
+        m_mate[m_endpoint[p]] = p ^ 1;
+        m_mate[m_endpoint[p ^ 1]] = p;
+      }
+      std::rotate(children.begin(), children.begin() + i, children.end());
+      std::rotate(endps.begin(), endps.begin() + i, endps.end());
+      m_base[b] = m_base[children[0]];
+      BOOST_ASSERT(m_base[b] == v);
+    }
+
+
+    // Swap matched and unmatched edges along the augmenting path through
+    // the edge k between two S vertices of different trees.
+    template <typename Weight>
+    void weighted_matching_solver<Weight>::augment_matching(size_type k)
+    {
+      for (int side = 0; side < 2; ++side) {
+        size_type s = m_endpoint[2 * k + side], p = 2 * k + 1 - side;
+        for (;;) {
+          size_type bs = top(s);
+          BOOST_ASSERT(m_label[bs] == s_label);
+          if (bs >= m_n)
+            augment_blossom(bs, s);
+          m_mate[s] = p;
+          if (m_labelend[bs] == none())
+            break;
+          size_type t = m_endpoint[m_labelend[bs]];
+          size_type bt = top(t);
+          BOOST_ASSERT(m_label[bt] == t_label);
+          s = m_endpoint[m_labelend[bt]];
+          size_type j = m_endpoint[m_labelend[bt] ^ 1];
+          BOOST_ASSERT(m_base[bt] == t);
+          if (bt >= m_n)
+            augment_blossom(bt, j);
+          m_mate[j] = m_labelend[bt];
+          p = m_labelend[bt] ^ 1;
+        }
+      }
+    }
+
+
+    template <typename Graph, typename MateMap, typename VertexIndexMap,
+              typename Solver>
+    void copy_weighted_matching(const Graph& g, MateMap mate, VertexIndexMap vm,
+                                const Solver& solver)
+    {
+      typedef typename graph_traits<Graph>::vertex_iterator vertex_iterator_t;
+      std::vector<typename graph_traits<Graph>::vertex_descriptor>
+        vertex_of(num_vertices(g));
+      vertex_iterator_t vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        vertex_of[get(vm, *vi)] = *vi;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t m = solver.mate(get(vm, *vi));
+        put(mate, *vi, m < vertex_of.size() ? vertex_of[m]
+            : graph_traits<Graph>::null_vertex());
+      }
+    }
+
+  } // namespace detail
+
+
+
+
+  // The total weight of the matched edges.  With parallel edges the
+  // heaviest one between two mates counts.
+  template <typename Graph, typename WeightMap, typename MateMap,
+            typename VertexIndexMap>
+  typename property_traits<WeightMap>::value_type
+  matching_weight_sum(const Graph& g, WeightMap weight, MateMap mate,
+                      VertexIndexMap vm)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_t;
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    weight_t sum = weight_t();
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+      typename graph_traits<Graph>::vertex_descriptor u = *vi, v = get(mate, u);
+      if (v == graph_traits<Graph>::null_vertex() || get(vm, v) < get(vm, u))
+        continue;
+      bool found = false;
+      weight_t best = weight_t();
+      for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+        if (target(*ei, g) == v && (!found || get(weight, *ei) > best)) {
+          best = get(weight, *ei);
+          found = true;
+        }
+      sum += best;
+    }
+    return sum;
+  }
+
+
+  template <typename Graph, typename WeightMap, typename MateMap>
+  inline typename property_traits<WeightMap>::value_type
+  matching_weight_sum(const Graph& g, WeightMap weight, MateMap mate)
+  {
+    return matching_weight_sum(g, weight, mate, get(vertex_index, g));
+  }
+
+
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename WeightMap>
+  void maximum_weighted_matching(const Graph& g, MateMap mate,
+                                 VertexIndexMap vm, WeightMap weight)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_t;
+    detail::weighted_matching_solver<weight_t> solver(num_vertices(g), false);
+    typename graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      if (get(weight, *ei) > weight_t())
+        solver.add_edge(get(vm, source(*ei, g)), get(vm, target(*ei, g)),
+                        get(weight, *ei));
+    solver.solve();
+    detail::copy_weighted_matching(g, mate, vm, solver);
+  }
+
+
+  // Warm start from the matching in initial_mate, which may be the same
+  // map as mate.  The graph is doubled so that every vertex can be matched
+  // to its own copy at weight zero; a maximum-weight perfect matching of
+  // the double graph contains a maximum-weight matching of g, and the
+  // initial matching together with the copy edges is a perfect matching
+  // to start from.
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename WeightMap, typename InitialMateMap>
+  void maximum_weighted_matching(const Graph& g, MateMap mate,
+                                 VertexIndexMap vm, WeightMap weight,
+                                 InitialMateMap initial_mate)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_t;
+    const std::size_t n = num_vertices(g);
+    detail::weighted_matching_solver<weight_t> solver(2 * n, true);
+    typename graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      if (get(weight, *ei) > weight_t()) {
+        std::size_t u = get(vm, source(*ei, g)), v = get(vm, target(*ei, g));
+        solver.add_edge(u, v, get(weight, *ei));
+        solver.add_edge(n + u, n + v, get(weight, *ei));
+      }
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+      std::size_t u = get(vm, *vi);
+      solver.add_edge(u, n + u, weight_t());
+      typename graph_traits<Graph>::vertex_descriptor m = get(initial_mate, *vi);
+      if (m == graph_traits<Graph>::null_vertex())
+        solver.suggest_pair(u, n + u);
+      else if (u < std::size_t(get(vm, m))) {
+        solver.suggest_pair(u, get(vm, m));
+        solver.suggest_pair(n + u, n + get(vm, m));
+      }
+    }
+    solver.solve();
+    detail::copy_weighted_matching(g, mate, vm, solver);
+  }
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap>
+  inline void maximum_weighted_matching(const Graph& g, MateMap mate,
+                                        VertexIndexMap vm)
+  {
+    maximum_weighted_matching(g, mate, vm, get(edge_weight, g));
+  }
+
+
+  template <typename Graph, typename MateMap>
+  inline void maximum_weighted_matching(const Graph& g, MateMap mate)
+  {
+    maximum_weighted_matching(g, mate, get(vertex_index, g));
+  }
+
+
+
+
+  // Returns false if g has no perfect matching; mate then holds a
+  // maximum-cardinality matching of minimum weight.
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename WeightMap, typename InitialMateMap>
+  bool minimum_weight_perfect_matching(const Graph& g, MateMap mate,
+                                       VertexIndexMap vm, WeightMap weight,
+                                       InitialMateMap initial_mate)
+  {
+    typedef typename property_traits<WeightMap>::value_type weight_t;
+    detail::weighted_matching_solver<weight_t> solver(num_vertices(g), true);
+    typename graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      solver.add_edge(get(vm, source(*ei, g)), get(vm, target(*ei, g)),
+                      -get(weight, *ei));
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+      typename graph_traits<Graph>::vertex_descriptor m = get(initial_mate, *vi);
+      if (m != graph_traits<Graph>::null_vertex()
+          && std::size_t(get(vm, *vi)) < std::size_t(get(vm, m)))
+        solver.suggest_pair(get(vm, *vi), get(vm, m));
+    }
+    solver.solve();
+    detail::copy_weighted_matching(g, mate, vm, solver);
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      if (get(mate, *vi) == graph_traits<Graph>::null_vertex())
+        return false;
+    return true;
+  }
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap,
+            typename WeightMap>
+  inline bool minimum_weight_perfect_matching(const Graph& g, MateMap mate,
+                                              VertexIndexMap vm, WeightMap weight)
+  {
+    return minimum_weight_perfect_matching
+      (g, mate, vm, weight,
+       make_constant_property<typename graph_traits<Graph>::vertex_descriptor>
+       (graph_traits<Graph>::null_vertex()));
+  }
+
+
+  template <typename Graph, typename MateMap, typename VertexIndexMap>
+  inline bool minimum_weight_perfect_matching(const Graph& g, MateMap mate,
+                                              VertexIndexMap vm)
+  {
+    return minimum_weight_perfect_matching(g, mate, vm, get(edge_weight, g));
+  }
+
+
+  template <typename Graph, typename MateMap>
+  inline bool minimum_weight_perfect_matching(const Graph& g, MateMap mate)
+  {
+    return minimum_weight_perfect_matching(g, mate, get(vertex_index, g));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_MAXIMUM_WEIGHTED_MATCHING_HPP
@@ -59,6 +59,7 @@ namespace boost {
   struct edges_equivalent_t { };
   struct index_in_heap_map_t { };
   struct max_priority_queue_t { };
+  struct number_of_threads_t { };
 
 #define BOOST_BGL_DECLARE_NAMED_PARAMS \
     BOOST_BGL_ONE_PARAM_CREF(weight_map, edge_weight) \
@@ -111,7 +112,8 @@ namespace boost {
     BOOST_BGL_ONE_PARAM_CREF(vertices_equivalent, vertices_equivalent) \
     BOOST_BGL_ONE_PARAM_CREF(edges_equivalent, edges_equivalent) \
     BOOST_BGL_ONE_PARAM_CREF(index_in_heap_map, index_in_heap_map) \
-    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue)
+    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue) \
+    BOOST_BGL_ONE_PARAM_CREF(number_of_threads, number_of_threads)
 
   template <typename T, typename Tag, typename Base = no_property>
   struct bgl_named_params
@@ -0,0 +1,603 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+//
+#ifndef BOOST_GRAPH_NESTED_DISSECTION_ORDERING_HPP
+#define BOOST_GRAPH_NESTED_DISSECTION_ORDERING_HPP
+
+#include <vector>
+#include <deque>
+#include <queue>
+#include <utility>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/approximate_minimum_degree_ordering.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/random/linear_congruential.hpp>
+
+/*
+  Multilevel nested dissection for matrix reordering
+*/
+
+namespace boost {
+
+  namespace detail {
+
+    typedef amd_impl::index_t nd_index;
+
+    // The sides of a vertex separator
+    enum { nd_left = 0, nd_right = 1, nd_separator = 2 };
+
+    // An undirected graph with vertex and edge weights in compressed
+    // form: the neighbours of v are adjacency[first[v]] to
+    // adjacency[first[v + 1] - 1], joined by edges of weight
+    // edge_weight[p].  label maps the vertices of a subgraph to the
+    // indices of the input graph.
+    struct nd_graph
+    {
+      std::vector<nd_index> first, adjacency, edge_weight, vertex_weight,
+        label;
+
+      nd_index num_vertices() const { return nd_index(first.size()) - 1; }
+
+      void swap(nd_graph& other)
+      {
+        first.swap(other.first);
+        adjacency.swap(other.adjacency);
+        edge_weight.swap(other.edge_weight);
+        vertex_weight.swap(other.vertex_weight);
+        label.swap(other.label);
+      }
+    };
+
+    // A random number in [0, n)
+    inline nd_index nd_random(minstd_rand& gen, nd_index n)
+    {
+      return nd_index(gen() % static_cast<unsigned long>(n));
+    }
+
+    // Heavy-edge matching: visits the vertices in random order and
+    // matches each unmatched vertex with the unmatched neighbour across
+    // its heaviest edge, then contracts the matched pairs.  map receives
+    // the coarse vertex of each vertex of g.  Returns false when the
+    // matching would shrink g by less than a tenth.
+    inline bool nd_coarsen(const nd_graph& g, nd_graph& coarse,
+                           std::vector<nd_index>& map, minstd_rand& gen)
+    {
+      const nd_index n = g.num_vertices();
+      std::vector<nd_index> order(n), mate(n, -1);
+      for (nd_index i = 0; i < n; ++i)
+        order[i] = i;
+      for (nd_index i = n; i > 1; --i)
+        std::swap(order[i - 1], order[nd_random(gen, i)]);
+
+      std::vector<nd_index> members;
+      members.reserve(n);
+      nd_index nc = 0;
+      map.assign(n, -1);
+      for (nd_index i = 0; i < n; ++i) {
+        nd_index v = order[i], best = v, heaviest = 0;
+        if (mate[v] != -1)
+          continue;
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p) {
+          nd_index u = g.adjacency[p];
+          if (mate[u] == -1 && u != v && g.edge_weight[p] > heaviest) {
+            best = u;
+            heaviest = g.edge_weight[p];
+          }
+        }
+        mate[v] = best;
+        mate[best] = v;
+        map[v] = map[best] = nc++;
+        members.push_back(v);
+      }
+      if (nc * 10 > n * 9)
+        return false;
+
+      // merges the adjacency lists of each pair; position[c] is where
+      // coarse vertex c appears in the list being built, if at or after
+      // its start
+      coarse.first.assign(nc + 1, 0);
+      coarse.vertex_weight.assign(nc, 0);
+      coarse.adjacency.clear();
+      coarse.edge_weight.clear();
+      coarse.label.clear();
+      std::vector<nd_index> position(nc, -1);
+      for (nd_index c = 0; c < nc; ++c) {
+        const nd_index start = coarse.adjacency.size();
+        nd_index v = members[c];
+        for (int k = 0; k < 2; ++k, v = mate[v]) {
+          if (k == 1 && v == members[c])
+            break;
+          coarse.vertex_weight[c] += g.vertex_weight[v];
+          for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p) {
+            nd_index cu = map[g.adjacency[p]];
+            if (cu == c)
+              continue;
+            if (position[cu] >= start)
+              coarse.edge_weight[position[cu]] += g.edge_weight[p];
+            else {
+              position[cu] = coarse.adjacency.size();
+              coarse.adjacency.push_back(cu);
+              coarse.edge_weight.push_back(g.edge_weight[p]);
+            }
+          }
+        }
+        coarse.first[c + 1] = coarse.adjacency.size();
+      }
+      return true;
+    }
+
+    // The last vertex reached by a breadth-first search from s, which is
+    // far from s, as in the search for the starting vertex of RCM.
+    inline nd_index nd_farthest(const nd_graph& g, nd_index s,
+                                std::vector<nd_index>& queue,
+                                std::vector<char>& seen)
+    {
+      seen.assign(g.num_vertices(), 0);
+      queue.clear();
+      queue.push_back(s);
+      seen[s] = 1;
+      for (std::size_t head = 0; head < queue.size(); ++head) {
+        nd_index v = queue[head];
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p)
+          if (!seen[g.adjacency[p]]) {
+            seen[g.adjacency[p]] = 1;
+            queue.push_back(g.adjacency[p]);
+          }
+      }
+      return queue.back();
+    }
+
+    // Grows the left side breadth-first from s (and from the following
+    // unreached vertices, if the component of s is too light) until it
+    // holds half of the weight.  The right vertices adjacent to it form
+    // the separator.
+    inline void nd_grow(const nd_graph& g, nd_index s, nd_index total,
+                        std::vector<char>& where,
+                        std::vector<nd_index>& queue, std::vector<char>& seen)
+    {
+      const nd_index n = g.num_vertices();
+      where.assign(n, nd_right);
+      seen.assign(n, 0);
+      queue.clear();
+      queue.push_back(s);
+      seen[s] = 1;
+      nd_index weight = 0, next_seed = 0;
+      for (std::size_t head = 0; 2 * weight < total; ++head) {
+        if (head == queue.size()) {
+          while (seen[next_seed])
+            ++next_seed;
+          queue.push_back(next_seed);
+          seen[next_seed] = 1;
+        }
+        nd_index v = queue[head];
+        where[v] = nd_left;
+        weight += g.vertex_weight[v];
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p)
+          if (!seen[g.adjacency[p]]) {
+            seen[g.adjacency[p]] = 1;
+            queue.push_back(g.adjacency[p]);
+          }
+      }
+      for (nd_index v = 0; v < n; ++v)
+        if (where[v] == nd_right)
+          for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p)
+            if (where[g.adjacency[p]] == nd_left) {
+              where[v] = nd_separator;
+              break;
+            }
+    }
+
+    inline void nd_side_weights(const nd_graph& g,
+                                const std::vector<char>& where,
+                                nd_index weights[3])
+    {
+      weights[0] = weights[1] = weights[2] = 0;
+      for (nd_index v = 0; v < g.num_vertices(); ++v)
+        weights[int(where[v])] += g.vertex_weight[v];
+    }
+
+    // Whether the separator given by weights is smaller than best, or as
+    // small and better balanced.
+    inline bool nd_better(const nd_index weights[3], const nd_index best[3])
+    {
+      if (weights[2] != best[2])
+        return weights[2] < best[2];
+      return std::abs(weights[0] - weights[1]) < std::abs(best[0] - best[1]);
+    }
+
+    // The weight that leaves the separator if separator vertex v moves to
+    // side to, pulling its neighbours on the other side into the
+    // separator.
+    inline nd_index nd_gain(const nd_graph& g, const std::vector<char>& where,
+                            nd_index v, int to)
+    {
+      nd_index gain = g.vertex_weight[v];
+      for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p)
+        if (where[g.adjacency[p]] == 1 - to)
+          gain -= g.vertex_weight[g.adjacency[p]];
+      return gain;
+    }
+
+    // Fiduccia-Mattheyses refinement of a vertex separator: moves the
+    // separator vertex of highest gain to a side that stays within
+    // max_side, each vertex at most once per pass, and keeps the best
+    // separator seen.  A pass ends after n / 100 moves without
+    // improvement, but no fewer than 15 and no more than 100.
+    class nd_refiner
+    {
+    public:
+      void refine(const nd_graph& g, std::vector<char>& where,
+                  nd_index weights[3], nd_index max_side)
+      {
+        const nd_index n = g.num_vertices();
+        const std::size_t patience
+          = (std::min)(std::size_t(100), (std::max)(std::size_t(15),
+                                                    std::size_t(n / 100)));
+        for (int pass = 0; pass < 8; ++pass) {
+          for (int side = 0; side < 2; ++side)
+            m_queues[side] = queue_type();
+          m_locked.assign(n, 0);
+          m_log.clear();
+          for (nd_index v = 0; v < n; ++v)
+            if (where[v] == nd_separator)
+              push(g, where, v);
+
+          nd_index best[3] = { weights[0], weights[1], weights[2] };
+          std::size_t best_moves = 0, since_best = 0;
+          while (since_best < patience) {
+            int to = -1;
+            nd_index v = -1, gain = 0;
+            for (int side = 0; side < 2; ++side) {
+              std::pair<nd_index, nd_index> top;
+              if (!valid_top(g, where, side, top)
+                  || weights[side] + g.vertex_weight[top.second] > max_side)
+                continue;
+              if (to == -1 || top.first > gain
+                  || (top.first == gain && weights[side] < weights[to])) {
+                to = side;
+                gain = top.first;
+                v = top.second;
+              }
+            }
+            if (to == -1)
+              break;
+            m_queues[to].pop();
+            move(g, where, weights, v, to);
+            if (nd_better(weights, best)) {
+              std::copy(weights, weights + 3, best);
+              best_moves = m_log.size();
+              since_best = 0;
+            } else
+              ++since_best;
+          }
+          while (m_log.size() > best_moves) {
+            nd_index u = m_log.back().first;
+            weights[int(where[u])] -= g.vertex_weight[u];
+            where[u] = m_log.back().second;
+            weights[int(where[u])] += g.vertex_weight[u];
+            m_log.pop_back();
+          }
+          if (best_moves == 0)
+            break;
+        }
+      }
+
+    private:
+      typedef std::priority_queue<std::pair<nd_index, nd_index> > queue_type;
+
+      void push(const nd_graph& g, const std::vector<char>& where, nd_index v)
+      {
+        for (int side = 0; side < 2; ++side)
+          m_queues[side].push(std::make_pair(nd_gain(g, where, v, side), v));
+      }
+
+      // Gains change whenever a neighbour moves, and every change pushes
+      // a new entry, so the entries that no longer match are dropped.
+      bool valid_top(const nd_graph& g, const std::vector<char>& where,
+                     int side, std::pair<nd_index, nd_index>& top)
+      {
+        queue_type& q = m_queues[side];
+        while (!q.empty()) {
+          top = q.top();
+          nd_index v = top.second;
+          if (!m_locked[v] && where[v] == nd_separator
+              && nd_gain(g, where, v, side) == top.first)
+            return true;
+          q.pop();
+        }
+        return false;
+      }
+
+      void move(const nd_graph& g, std::vector<char>& where,
+                nd_index weights[3], nd_index v, int to)
+      {
+        const int other = 1 - to;
+        m_locked[v] = 1;
+        m_log.push_back(std::make_pair(v, char(nd_separator)));
+        where[v] = char(to);
+        weights[nd_separator] -= g.vertex_weight[v];
+        weights[to] += g.vertex_weight[v];
+        const std::size_t pulled = m_log.size();
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p) {
+          nd_index u = g.adjacency[p];
+          if (where[u] == other) {
+            m_log.push_back(std::make_pair(u, char(other)));
+            where[u] = nd_separator;
+            weights[other] -= g.vertex_weight[u];
+            weights[nd_separator] += g.vertex_weight[u];
+          }
+        }
+        // the gains of the separator vertices around the moved ones
+        update_around(g, where, v);
+        for (std::size_t i = pulled; i < m_log.size(); ++i)
+          update_around(g, where, m_log[i].first);
+      }
+
+      void update_around(const nd_graph& g, const std::vector<char>& where,
+                         nd_index v)
+      {
+        if (where[v] == nd_separator && !m_locked[v])
+          push(g, where, v);
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p) {
+          nd_index u = g.adjacency[p];
+          if (where[u] == nd_separator && !m_locked[u])
+            push(g, where, u);
+        }
+      }
+
+      queue_type m_queues[2];
+      std::vector<char> m_locked;
+      std::vector<std::pair<nd_index, char> > m_log;
+    };
+
+    // Finds a vertex separator of g: coarsens g by heavy-edge matching,
+    // separates the coarsest graph by breadth-first growth from a
+    // pseudo-peripheral vertex and from random vertices, and refines the
+    // best separator on the way back to g.
+    inline void nd_separate(const nd_graph& g, std::vector<char>& where,
+                            minstd_rand& gen)
+    {
+      std::deque<nd_graph> levels;
+      std::deque<std::vector<nd_index> > maps;
+      const nd_graph* coarsest = &g;
+      while (coarsest->num_vertices() > 100) {
+        levels.push_back(nd_graph());
+        maps.push_back(std::vector<nd_index>());
+        if (!nd_coarsen(*coarsest, levels.back(), maps.back(), gen)) {
+          levels.pop_back();
+          maps.pop_back();
+          break;
+        }
+        coarsest = &levels.back();
+      }
+
+      nd_index total = 0, heaviest = 0;
+      for (nd_index v = 0; v < g.num_vertices(); ++v) {
+        total += g.vertex_weight[v];
+        heaviest = (std::max)(heaviest, g.vertex_weight[v]);
+      }
+      const nd_index n = coarsest->num_vertices();
+      for (nd_index v = 0; v < n; ++v)
+        heaviest = (std::max)(heaviest, coarsest->vertex_weight[v]);
+      const nd_index max_side = (std::max)(total * 3 / 5, total / 2 + heaviest);
+
+      nd_refiner refiner;
+      std::vector<nd_index> queue;
+      std::vector<char> seen, trial;
+      nd_index best[3] = { 0, 0, total + 1 }, weights[3];
+      for (int i = 0; i < 4; ++i) {
+        nd_index s = nd_random(gen, n);
+        if (i == 0)
+          s = nd_farthest(*coarsest, nd_farthest(*coarsest, s, queue, seen),
+                          queue, seen);
+        nd_grow(*coarsest, s, total, trial, queue, seen);
+        nd_side_weights(*coarsest, trial, weights);
+        refiner.refine(*coarsest, trial, weights, max_side);
+        if (nd_better(weights, best)) {
+          std::copy(weights, weights + 3, best);
+          where.swap(trial);
+        }
+      }
+
+      for (std::size_t level = levels.size(); level-- > 0;) {
+        const nd_graph& fine = level == 0 ? g : levels[level - 1];
+        const std::vector<nd_index>& map = maps[level];
+        trial.resize(fine.num_vertices());
+        for (nd_index v = 0; v < fine.num_vertices(); ++v)
+          trial[v] = where[map[v]];
+        where.swap(trial);
+        nd_side_weights(fine, where, weights);
+        refiner.refine(fine, where, weights, max_side);
+      }
+    }
+
+    // The subgraph induced by the vertices on side, with unit weights.
+    inline void nd_subgraph(const nd_graph& g, const std::vector<char>& where,
+                            char side, nd_graph& sub,
+                            std::vector<nd_index>& local)
+    {
+      const nd_index n = g.num_vertices();
+      local.resize(n);
+      nd_index count = 0;
+      for (nd_index v = 0; v < n; ++v)
+        if (where[v] == side)
+          local[v] = count++;
+      sub.first.assign(1, 0);
+      sub.first.reserve(count + 1);
+      sub.adjacency.clear();
+      sub.label.clear();
+      for (nd_index v = 0; v < n; ++v) {
+        if (where[v] != side)
+          continue;
+        for (nd_index p = g.first[v]; p < g.first[v + 1]; ++p)
+          if (where[g.adjacency[p]] == side)
+            sub.adjacency.push_back(local[g.adjacency[p]]);
+        sub.first.push_back(sub.adjacency.size());
+        sub.label.push_back(g.label[v]);
+      }
+      sub.edge_weight.assign(sub.adjacency.size(), 1);
+      sub.vertex_weight.assign(count, 1);
+    }
+
+    // A subgraph still to be ordered into positions [offset, offset + n).
+    struct nd_task
+    {
+      nd_graph graph;
+      nd_index offset;
+    };
+
+    // Orders one subgraph of a level: small or inseparable subgraphs are
+    // ordered by approximate minimum degree; the others are split into
+    // two subgraphs for the next level, placed before their separator.
+    class nd_level_body
+    {
+    public:
+      nd_level_body(std::vector<nd_task>& tasks, std::vector<nd_task>& next,
+                    std::vector<nd_index>& order)
+        : m_tasks(tasks), m_next(next), m_order(order) { }
+
+      void operator()(std::size_t i, std::size_t) const
+      {
+        nd_task& task = m_tasks[i];
+        nd_graph& g = task.graph;
+        const nd_index n = g.num_vertices();
+        minstd_rand gen(static_cast<unsigned long>(task.offset + n + 1));
+        std::vector<char> where;
+        nd_index weights[3] = { 0, 0, 0 };
+        if (n > 200) {
+          nd_separate(g, where, gen);
+          nd_side_weights(g, where, weights);
+        }
+        if (weights[nd_left] == 0 || weights[nd_right] == 0) {
+          order_leaf(task);
+          return;
+        }
+
+        std::vector<nd_index> local;
+        nd_task& left = m_next[2 * i];
+        nd_task& right = m_next[2 * i + 1];
+        nd_subgraph(g, where, nd_left, left.graph, local);
+        nd_subgraph(g, where, nd_right, right.graph, local);
+        left.offset = task.offset;
+        right.offset = task.offset + left.graph.num_vertices();
+        nd_index position = right.offset + right.graph.num_vertices();
+        for (nd_index v = 0; v < n; ++v)
+          if (where[v] == nd_separator)
+            m_order[position++] = g.label[v];
+        task.graph = nd_graph();
+      }
+
+    private:
+      void order_leaf(nd_task& task) const
+      {
+        const nd_graph& g = task.graph;
+        const nd_index n = g.num_vertices();
+        if (n == 0)
+          return;
+        amd_impl impl(n, g.first, g.adjacency, 10.0);
+        impl.do_amd();
+        std::vector<nd_index> inverse_perm(n), perm(n), sizes;
+        impl.build_permutation(&inverse_perm[0], &perm[0], sizes);
+        for (nd_index k = 0; k < n; ++k)
+          m_order[task.offset + k] = g.label[perm[k]];
+        task.graph = nd_graph();
+      }
+
+      std::vector<nd_task>& m_tasks;
+      std::vector<nd_task>& m_next;
+      std::vector<nd_index>& m_order;
+    };
+
+  } // namespace detail
+
+  // Nested dissection ordering
+  //
+  // Computes a fill-reducing ordering of the symmetric sparse matrix
+  // given by the graph of its nonzeros and writes the vertices to
+  // permutation in their new order, as cuthill_mckee_ordering() does.
+  // Each subgraph is split by a small vertex separator, which is ordered
+  // after the two parts, and the parts are ordered recursively; subgraphs
+  // of up to 200 vertices are ordered by approximate minimum degree.
+  // The separators are found by multilevel bisection: heavy-edge matching
+  // coarsens the graph, breadth-first growth separates the coarsest
+  // graph, and Fiduccia-Mattheyses refinement improves the separator at
+  // each level on the way back.
+  //
+  // The subgraphs of each level of the dissection are ordered by
+  // num_threads threads (0 means one per hardware thread).  The ordering
+  // does not depend on the number of threads.
+  //
+  // As for approximate_minimum_degree_ordering(), the graph may be
+  // directed or undirected, and self-loops and parallel edges are
+  // ignored.
+  //
+  // see George Karypis and Vipin Kumar, A Fast and High Quality Multilevel
+  // Scheme for Partitioning Irregular Graphs, SIAM Journal on Scientific
+  // Computing, 20, 1998, Page 359-392
+  template <typename Graph, typename OutputIterator, typename VertexIndexMap>
+  OutputIterator
+  nested_dissection_ordering(const Graph& G, OutputIterator permutation,
+                             VertexIndexMap index_map,
+                             std::size_t num_threads = 1)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef detail::nd_index index_t;
+    const index_t n = num_vertices(G);
+    if (n == 0)
+      return permutation;
+    num_threads = detail::resolve_number_of_threads(num_threads);
+
+    std::vector<Vertex> index_vertex;
+    std::vector<detail::nd_task> tasks(1), next;
+    detail::nd_graph& g = tasks[0].graph;
+    detail::symmetric_adjacency(G, index_map, index_vertex, g.first,
+                                g.adjacency);
+    g.edge_weight.assign(g.adjacency.size(), 1);
+    g.vertex_weight.assign(n, 1);
+    g.label.resize(n);
+    for (index_t v = 0; v < n; ++v)
+      g.label[v] = v;
+    tasks[0].offset = 0;
+
+    // one level of the dissection at a time; the subgraphs of a level
+    // are independent and fill disjoint ranges of the order
+    std::vector<index_t> order(n);
+    while (!tasks.empty()) {
+      next.clear();
+      next.resize(2 * tasks.size());
+      detail::nd_level_body body(tasks, next, order);
+      detail::parallel_for(tasks.size(), body, num_threads);
+      tasks.clear();
+      for (std::size_t i = 0; i < next.size(); ++i)
+        if (next[i].graph.first.size() > 1) {
+          tasks.push_back(detail::nd_task());
+          tasks.back().offset = next[i].offset;
+          tasks.back().graph.swap(next[i].graph);
+        }
+    }
+
+    for (index_t k = 0; k < n; ++k)
+      *permutation++ = index_vertex[order[k]];
+    return permutation;
+  }
+
+  template <typename Graph, typename OutputIterator>
+  inline OutputIterator
+  nested_dissection_ordering(const Graph& G, OutputIterator permutation)
+  {
+    return nested_dissection_ordering(G, permutation, get(vertex_index, G));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_NESTED_DISSECTION_ORDERING_HPP
@@ -0,0 +1,391 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+#ifndef BOOST_GRAPH_PARALLEL_VERTEX_COLORING_HPP
+#define BOOST_GRAPH_PARALLEL_VERTEX_COLORING_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/smallest_last_ordering.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/tuple/tuple.hpp>
+
+/* Shared-memory parallel versions of sequential_vertex_coloring().
+
+   speculative_vertex_coloring() colors all the vertices at once, each
+   with the smallest color not used by its neighbors at that moment, then
+   finds the adjacent pairs that got the same color and colors the vertex
+   of larger index of each pair again, until there are no conflicts.
+
+   Reference:
+
+   Assefaw Hadish Gebremedhin and Fredrik Manne, Scalable parallel graph
+   coloring algorithms. Concurrency: Practice and Experience, V12,
+   P1131-1146, 2000
+
+   jones_plassmann_vertex_coloring() colors, in each round, the
+   uncolored vertices that precede all their uncolored neighbors in a
+   priority order.  Every vertex is then colored after its neighbors that
+   precede it and before the others, so the coloring is the one
+   sequential_vertex_coloring() gives with the vertices in priority
+   order, on any number of threads.
+
+   Reference:
+
+   Mark T. Jones and Paul E. Plassmann, A parallel graph coloring
+   heuristic. SIAM J. Sci. Comput. V14, P654-669, 1993
+
+   Both work on internal atomic colors and write the color map at the
+   end.  Self-loops are ignored. */
+
+namespace boost {
+
+  namespace detail {
+
+    // The colors of the vertices while they are being colored, by vertex
+    // index; uncolored vertices have uncolored().
+    class parallel_coloring_state
+    {
+    public:
+      explicit parallel_coloring_state(std::size_t n, std::size_t threads,
+                                       std::size_t max_degree)
+        : m_colors(n), m_marks(threads,
+                               std::vector<std::size_t>(max_degree + 1, 0)),
+          m_stamps(threads, 0)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          m_colors.set(i, uncolored());
+      }
+
+      static std::size_t uncolored() { return std::size_t(-1); }
+
+      std::size_t color(std::size_t i) const { return m_colors.load(i); }
+
+      // Gives v the smallest color not used by its neighbors, on
+      // thread t.
+      template <typename Graph, typename IndexMap>
+      void first_fit(const Graph& g, IndexMap index,
+                     typename graph_traits<Graph>::vertex_descriptor v,
+                     std::size_t t)
+      {
+        std::vector<std::size_t>& mark = m_marks[t];
+        const std::size_t stamp = ++m_stamps[t], iv = get(index, v);
+        typename graph_traits<Graph>::adjacency_iterator ai, ai_end;
+        for (boost::tie(ai, ai_end) = adjacent_vertices(v, g); ai != ai_end;
+             ++ai) {
+          std::size_t c = m_colors.load(get(index, *ai));
+          if (c < mark.size() && get(index, *ai) != iv)
+            mark[c] = stamp;
+        }
+        std::size_t c = 0;
+        while (mark[c] == stamp)
+          ++c;
+        m_colors.set(iv, c);
+      }
+
+      // Writes the colors to the color map and returns their number.
+      template <typename Graph, typename IndexMap, typename ColorMap>
+      typename property_traits<ColorMap>::value_type
+      write(const Graph& g, IndexMap index, ColorMap color) const
+      {
+        typedef typename property_traits<ColorMap>::value_type size_type;
+        size_type num_colors = 0;
+        typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+          size_type c = size_type(m_colors.load(get(index, *vi)));
+          put(color, *vi, c);
+          if (c + 1 > num_colors)
+            num_colors = c + 1;
+        }
+        return num_colors;
+      }
+
+    private:
+      parallel_counters m_colors;
+      std::vector<std::vector<std::size_t> > m_marks;
+      std::vector<std::size_t> m_stamps;
+    };
+
+    template <typename Graph>
+    std::size_t max_out_degree(const Graph& g)
+    {
+      std::size_t d = 0;
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        d = (std::max)(d, std::size_t(out_degree(*vi, g)));
+      return d;
+    }
+
+    // One round of speculative coloring over the positions in work: the
+    // assign phase colors their vertices, the check phase collects the
+    // ones that share a color with a neighbor of smaller index.
+    template <typename Graph, typename OrderPA, typename IndexMap>
+    struct speculative_coloring_body
+    {
+      speculative_coloring_body
+        (const Graph& g, OrderPA order, IndexMap index,
+         parallel_coloring_state& state, const std::vector<std::size_t>& work,
+         std::vector<std::vector<std::size_t> >& conflicts)
+        : m_g(g), m_order(order), m_index(index), m_state(state),
+          m_work(work), m_conflicts(conflicts), m_check(false) { }
+
+      void operator()(std::size_t i, std::size_t t)
+      {
+        typename graph_traits<Graph>::vertex_descriptor v
+          = get(m_order, m_work[i]);
+        if (!m_check) {
+          m_state.first_fit(m_g, m_index, v, t);
+          return;
+        }
+        const std::size_t iv = get(m_index, v), c = m_state.color(iv);
+        typename graph_traits<Graph>::adjacency_iterator ai, ai_end;
+        for (boost::tie(ai, ai_end) = adjacent_vertices(v, m_g);
+             ai != ai_end; ++ai) {
+          std::size_t iw = get(m_index, *ai);
+          if (iw < iv && m_state.color(iw) == c) {
+            m_conflicts[t].push_back(m_work[i]);
+            break;
+          }
+        }
+      }
+
+      const Graph& m_g;
+      OrderPA m_order;
+      IndexMap m_index;
+      parallel_coloring_state& m_state;
+      const std::vector<std::size_t>& m_work;
+      std::vector<std::vector<std::size_t> >& m_conflicts;
+      bool m_check;
+    };
+
+    // The vertices by decreasing priority, then increasing index.
+    template <typename PriorityMap, typename IndexMap>
+    struct jones_plassmann_order
+    {
+      jones_plassmann_order(PriorityMap priority, IndexMap index)
+        : m_priority(priority), m_index(index) { }
+
+      template <typename Vertex>
+      bool operator()(Vertex u, Vertex v) const
+      {
+        if (get(m_priority, v) < get(m_priority, u))
+          return true;
+        return !(get(m_priority, u) < get(m_priority, v))
+          && get(m_index, u) < get(m_index, v);
+      }
+
+      PriorityMap m_priority;
+      IndexMap m_index;
+    };
+
+    // The rounds of Jones-Plassmann coloring, with rank[i] the position
+    // of the vertex of index i in priority order.  The count phase sets
+    // the number of neighbors that precede each vertex, and the color
+    // phase colors the vertices of work and releases the neighbors that
+    // follow them; both collect the vertices ready to be colored in next.
+    template <typename Graph, typename IndexMap>
+    struct jones_plassmann_body
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+
+      jones_plassmann_body
+        (const Graph& g, IndexMap index, const std::vector<std::size_t>& rank,
+         parallel_coloring_state& state, parallel_counters& waiting,
+         const std::vector<Vertex>& work,
+         std::vector<std::vector<Vertex> >& next)
+        : m_g(g), m_index(index), m_rank(rank), m_state(state),
+          m_waiting(waiting), m_work(work), m_next(next), m_count(true) { }
+
+      void operator()(std::size_t i, std::size_t t)
+      {
+        Vertex v = m_work[i];
+        const std::size_t rank = m_rank[get(m_index, v)];
+        typename graph_traits<Graph>::adjacency_iterator ai, ai_end;
+        if (m_count) {
+          std::size_t preceding = 0;
+          for (boost::tie(ai, ai_end) = adjacent_vertices(v, m_g);
+               ai != ai_end; ++ai)
+            if (m_rank[get(m_index, *ai)] < rank)
+              ++preceding;
+          m_waiting.set(get(m_index, v), preceding);
+          if (preceding == 0)
+            m_next[t].push_back(v);
+          return;
+        }
+        // the neighbors that follow v are still uncolored
+        m_state.first_fit(m_g, m_index, v, t);
+        for (boost::tie(ai, ai_end) = adjacent_vertices(v, m_g); ai != ai_end;
+             ++ai) {
+          std::size_t w = get(m_index, *ai);
+          if (m_rank[w] > rank && m_waiting.decrement(w) == 0)
+            m_next[t].push_back(*ai);
+        }
+      }
+
+      const Graph& m_g;
+      IndexMap m_index;
+      const std::vector<std::size_t>& m_rank;
+      parallel_coloring_state& m_state;
+      parallel_counters& m_waiting;
+      const std::vector<Vertex>& m_work;
+      std::vector<std::vector<Vertex> >& m_next;
+      bool m_count;
+    };
+
+  } // namespace detail
+
+  // Colors the vertices in the given order on num_threads threads (0
+  // means one per hardware thread), coloring again the vertices that
+  // conflict with a neighbor.  On one thread the coloring is that of
+  // sequential_vertex_coloring() with the same order.
+  template <class VertexListGraph, class OrderPA, class ColorMap,
+            class VertexIndexMap>
+  typename property_traits<ColorMap>::value_type
+  speculative_vertex_coloring(const VertexListGraph& G, OrderPA order,
+                              ColorMap color, VertexIndexMap index_map,
+                              std::size_t num_threads)
+  {
+    const std::size_t n = num_vertices(G);
+    num_threads = detail::resolve_number_of_threads(num_threads);
+    detail::parallel_coloring_state
+      state(n, num_threads, detail::max_out_degree(G));
+    std::vector<std::size_t> work(n);
+    for (std::size_t i = 0; i < n; ++i)
+      work[i] = i;
+    std::vector<std::vector<std::size_t> > conflicts(num_threads);
+    detail::speculative_coloring_body<VertexListGraph, OrderPA,
+                                      VertexIndexMap>
+      body(G, order, index_map, state, work, conflicts);
+
+    while (!work.empty()) {
+      body.m_check = false;
+      detail::parallel_for(work.size(), body, num_threads, 256);
+      body.m_check = true;
+      detail::parallel_for(work.size(), body, num_threads, 256);
+      work.clear();
+      for (std::size_t t = 0; t < num_threads; ++t) {
+        work.insert(work.end(), conflicts[t].begin(), conflicts[t].end());
+        conflicts[t].clear();
+      }
+      std::sort(work.begin(), work.end());
+    }
+    return state.write(G, index_map, color);
+  }
+
+  template <class VertexListGraph, class ColorMap>
+  typename property_traits<ColorMap>::value_type
+  speculative_vertex_coloring(const VertexListGraph& G, ColorMap color,
+                              std::size_t num_threads = 1)
+  {
+    typedef typename graph_traits<VertexListGraph>::vertex_descriptor
+      vertex_descriptor;
+    typedef typename graph_traits<VertexListGraph>::vertex_iterator
+      vertex_iterator;
+
+    std::pair<vertex_iterator, vertex_iterator> v = vertices(G);
+    std::vector<vertex_descriptor> order(v.first, v.second);
+    return speculative_vertex_coloring
+             (G,
+              make_iterator_property_map
+              (order.begin(), identity_property_map(),
+               graph_traits<VertexListGraph>::null_vertex()),
+              color, get(vertex_index, G), num_threads);
+  }
+
+  // Colors the vertices in rounds on num_threads threads (0 means one
+  // per hardware thread).  The coloring is that of
+  // sequential_vertex_coloring() with the vertices in order of
+  // decreasing priority, and of increasing index among equal
+  // priorities.
+  template <class VertexListGraph, class PriorityMap, class ColorMap,
+            class VertexIndexMap>
+  typename property_traits<ColorMap>::value_type
+  jones_plassmann_vertex_coloring(const VertexListGraph& G,
+                                  PriorityMap priority, ColorMap color,
+                                  VertexIndexMap index_map,
+                                  std::size_t num_threads)
+  {
+    typedef typename graph_traits<VertexListGraph>::vertex_descriptor Vertex;
+    const std::size_t n = num_vertices(G);
+    num_threads = detail::resolve_number_of_threads(num_threads);
+    detail::parallel_coloring_state
+      state(n, num_threads, detail::max_out_degree(G));
+    detail::parallel_counters waiting(n);
+    typename graph_traits<VertexListGraph>::vertex_iterator vi, vi_end;
+    boost::tie(vi, vi_end) = vertices(G);
+    std::vector<Vertex> work(vi, vi_end);
+    std::sort(work.begin(), work.end(),
+              detail::jones_plassmann_order<PriorityMap, VertexIndexMap>
+                (priority, index_map));
+    std::vector<std::size_t> rank(n);
+    for (std::size_t k = 0; k < n; ++k)
+      rank[get(index_map, work[k])] = k;
+    std::vector<std::vector<Vertex> > next(num_threads);
+    detail::jones_plassmann_body<VertexListGraph, VertexIndexMap>
+      body(G, index_map, rank, state, waiting, work, next);
+
+    detail::parallel_for(work.size(), body, num_threads, 256);
+    body.m_count = false;
+    for (;;) {
+      work.clear();
+      for (std::size_t t = 0; t < num_threads; ++t) {
+        work.insert(work.end(), next[t].begin(), next[t].end());
+        next[t].clear();
+      }
+      if (work.empty())
+        break;
+      detail::parallel_for(work.size(), body, num_threads, 256);
+    }
+    return state.write(G, index_map, color);
+  }
+
+  // Jones-Plassmann coloring with the largest-degree-first priorities.
+  template <class VertexListGraph, class ColorMap>
+  typename property_traits<ColorMap>::value_type
+  jones_plassmann_vertex_coloring(const VertexListGraph& G, ColorMap color,
+                                  std::size_t num_threads = 1)
+  {
+    typedef typename graph_traits<VertexListGraph>::degree_size_type
+      degree_size_type;
+    std::vector<degree_size_type> degree(num_vertices(G));
+    typename graph_traits<VertexListGraph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(G); vi != vi_end; ++vi)
+      degree[get(vertex_index, G, *vi)] = out_degree(*vi, G);
+    return jones_plassmann_vertex_coloring
+             (G, make_iterator_property_map(degree.begin(),
+                                            get(vertex_index, G)),
+              color, get(vertex_index, G), num_threads);
+  }
+
+  // Jones-Plassmann coloring with the priorities of
+  // smallest_last_vertex_ordering(): the coloring is that of
+  // sequential_vertex_coloring() with the smallest-last order.
+  template <class VertexListGraph, class ColorMap>
+  typename property_traits<ColorMap>::value_type
+  smallest_last_vertex_coloring(const VertexListGraph& G, ColorMap color,
+                                std::size_t num_threads = 1)
+  {
+    const std::size_t n = num_vertices(G);
+    std::vector<typename graph_traits<VertexListGraph>::vertex_descriptor>
+      order = smallest_last_vertex_ordering(G);
+    std::vector<std::size_t> priority(n);
+    for (std::size_t k = 0; k < n; ++k)
+      priority[get(vertex_index, G, order[k])] = n - k;
+    return jones_plassmann_vertex_coloring
+             (G, make_iterator_property_map(priority.begin(),
+                                            get(vertex_index, G)),
+              color, get(vertex_index, G), num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_VERTEX_COLORING_HPP
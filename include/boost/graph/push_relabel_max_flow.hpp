@@ -13,7 +13,6 @@
 #include <boost/config.hpp>
 #include <boost/assert.hpp>
 #include <vector>
-#include <list>
 #include <iosfwd>
 #include <algorithm> // for std::min and std::max
 
@@ -21,6 +20,7 @@
 #include <boost/limits.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 
 namespace boost {
 
@@ -41,10 +41,14 @@ namespace boost {
    // has positive excess flow and its distance is less than n (it is
    // not blocked).
 
-    template <class Vertex>
+    // The two lists of a layer are intrusive: they are threaded through
+    // per-vertex next/prev arrays by vertex index, so moving a vertex
+    // between lists never allocates.
     struct preflow_layer {
-      std::list<Vertex> active_vertices;
-      std::list<Vertex> inactive_vertices;
+      preflow_layer() : active_first(none()), inactive_first(none()) { }
+      static std::size_t none() { return std::size_t(-1); }
+      std::size_t active_first;
+      std::size_t inactive_first;
     };
 
     template <class Graph, 
@@ -63,8 +67,9 @@ namespace boost {
       typedef typename Traits::out_edge_iterator out_edge_iterator;
       typedef typename Traits::vertices_size_type vertices_size_type;
       typedef typename Traits::edges_size_type edges_size_type;
+      typedef FlowValue flow_value_type;
 
-      typedef preflow_layer<vertex_descriptor> Layer;
+      typedef preflow_layer Layer;
       typedef std::vector< Layer > LayerArray;
       typedef typename LayerArray::iterator layer_iterator;
       typedef typename LayerArray::size_type distance_size_type;
@@ -87,26 +92,40 @@ namespace boost {
       //=======================================================================
       // Layer List Management Functions
 
-      typedef typename std::list<vertex_descriptor>::iterator list_iterator;
+      void push_front(std::size_t& first, vertex_descriptor u) {
+        std::size_t i = get(index, u);
+        layer_next[i] = first;
+        layer_prev[i] = Layer::none();
+        if (first != Layer::none())
+          layer_prev[first] = i;
+        first = i;
+      }
+      void unlink(std::size_t& first, vertex_descriptor u) {
+        std::size_t i = get(index, u);
+        if (layer_prev[i] == Layer::none())
+          first = layer_next[i];
+        else
+          layer_next[layer_prev[i]] = layer_next[i];
+        if (layer_next[i] != Layer::none())
+          layer_prev[layer_next[i]] = layer_prev[i];
+      }
 
       void add_to_active_list(vertex_descriptor u, Layer& layer) {
         BOOST_USING_STD_MIN();
         BOOST_USING_STD_MAX();
-        layer.active_vertices.push_front(u);
+        push_front(layer.active_first, u);
         max_active = max BOOST_PREVENT_MACRO_SUBSTITUTION(get(distance, u), max_active);
         min_active = min BOOST_PREVENT_MACRO_SUBSTITUTION(get(distance, u), min_active);
-        layer_list_ptr[u] = layer.active_vertices.begin();
       }
       void remove_from_active_list(vertex_descriptor u) {
-        layers[get(distance, u)].active_vertices.erase(layer_list_ptr[u]);    
+        unlink(layers[get(distance, u)].active_first, u);
       }
 
       void add_to_inactive_list(vertex_descriptor u, Layer& layer) {
-        layer.inactive_vertices.push_front(u);
-        layer_list_ptr[u] = layer.inactive_vertices.begin();
+        push_front(layer.inactive_first, u);
       }
       void remove_from_inactive_list(vertex_descriptor u) {
-        layers[get(distance, u)].inactive_vertices.erase(layer_list_ptr[u]);    
+        unlink(layers[get(distance, u)].inactive_first, u);
       }
 
       //=======================================================================
@@ -131,9 +150,9 @@ namespace boost {
           reverse_edge(rev),
           residual_capacity(res),
           layers(num_vertices(g_)),
-          layer_list_ptr_data(num_vertices(g_), 
-                              layers.front().inactive_vertices.end()),
-          layer_list_ptr(layer_list_ptr_data.begin(), idx),
+          layer_next(num_vertices(g_)),
+          layer_prev(num_vertices(g_)),
+          vertex_of(num_vertices(g_)),
           push_count(0), update_count(0), relabel_count(0), 
           gap_count(0), gap_node_count(0),
           work_since_last_update(0)
@@ -155,6 +174,7 @@ namespace boost {
           vertex_descriptor u = *u_iter;
           put(excess_flow, u, 0);
           current[u] = out_edges(u, g);
+          vertex_of[get(index, u)] = u;
         }
 
         bool overflow_detected = false;
@@ -225,10 +245,8 @@ namespace boost {
         put(color, sink, ColorTraits::gray());
         put(distance, sink, 0);
         
-        for (distance_size_type l = 0; l <= max_distance; ++l) {
-          layers[l].active_vertices.clear();
-          layers[l].inactive_vertices.clear();
-        }
+        for (distance_size_type l = 0; l <= max_distance; ++l)
+          layers[l] = Layer();
         
         max_distance = max_active = 0;
         min_active = n;
@@ -291,8 +309,8 @@ namespace boost {
 
           if (ai == ai_end) {   // i must be relabeled
             relabel_distance(u);
-            if (layer.active_vertices.empty()
-                && layer.inactive_vertices.empty())
+            if (layer.active_first == Layer::none()
+                && layer.inactive_first == Layer::none())
               gap(du);
             if (get(distance, u) == n)
               break;
@@ -375,13 +393,12 @@ namespace boost {
         // Set the distance for the vertices beyond the gap to "infinity".
         for (layer_iterator l = layers.begin() + empty_distance + 1;
              l < layers.begin() + max_distance; ++l) {
-          list_iterator i;
-          for (i = l->inactive_vertices.begin(); 
-               i != l->inactive_vertices.end(); ++i) {
-            put(distance, *i, n);
+          for (std::size_t i = l->inactive_first; i != Layer::none();
+               i = layer_next[i]) {
+            put(distance, vertex_of[i], n);
             ++gap_node_count;
           }
-          l->inactive_vertices.clear();
+          l->inactive_first = Layer::none();
         }
         max_distance = r;
         max_active = r;
@@ -396,12 +413,11 @@ namespace boost {
         while (max_active >= min_active) { // "main" loop
 
           Layer& layer = layers[max_active];
-          list_iterator u_iter = layer.active_vertices.begin();
 
-          if (u_iter == layer.active_vertices.end())
+          if (layer.active_first == Layer::none())
             --max_active;
           else {
-            vertex_descriptor u = *u_iter;
+            vertex_descriptor u = vertex_of[layer.active_first];
             remove_from_active_list(u);
             
             discharge(u);
@@ -659,8 +675,9 @@ namespace boost {
       ResidualCapacityEdgeMap residual_capacity;
 
       LayerArray layers;
-      std::vector< list_iterator > layer_list_ptr_data;
-      iterator_property_map<typename std::vector< list_iterator >::iterator, VertexIndexMap> layer_list_ptr;
+      std::vector< std::size_t > layer_next;  // by vertex index
+      std::vector< std::size_t > layer_prev;
+      std::vector< vertex_descriptor > vertex_of;
       distance_size_type max_distance;  // maximal distance
       distance_size_type max_active;    // maximal distance with active node
       distance_size_type min_active;    // minimal distance with active node
@@ -680,6 +697,352 @@ namespace boost {
       long work_since_last_update;
     };
 
+    //=======================================================================
+    // Synchronous parallel push-relabel, after Baumstark, Blelloch and
+    // Shun, "Efficient Implementation of a Synchronous Parallel Push-Relabel
+    // Algorithm", ESA 2015.  Each round discharges all active vertices in
+    // parallel against the labels of the previous round; a vertex pushes
+    // to an active neighbour only if it "wins" the edge, which keeps the
+    // labeling valid.  Residual capacities and excess additions are atomic
+    // and the new labels take effect at the end of the round.  The global
+    // relabeling is a parallel level-synchronous breadth-first search.
+    //
+    // The work is done on a compressed copy of the residual graph; the
+    // preflow is written back to the serial solver, which then runs the
+    // second phase.  The statistics are added to its counters.
+    template <class PushRelabel>
+    class parallel_push_relabel
+    {
+    public:
+      typedef typename PushRelabel::vertex_descriptor vertex_descriptor;
+      typedef typename PushRelabel::edge_descriptor edge_descriptor;
+      typedef typename PushRelabel::vertex_iterator vertex_iterator;
+      typedef typename PushRelabel::out_edge_iterator out_edge_iterator;
+      typedef typename PushRelabel::flow_value_type FlowValue;
+      typedef std::size_t size_type;
+
+      parallel_push_relabel(PushRelabel& pr, size_type num_threads)
+        : pr(pr), n(pr.n), num_threads(num_threads),
+          src(get(pr.index, pr.src)), sink(get(pr.index, pr.sink)),
+          first(n + 1, 0), res(num_edges(pr.g)),
+          excess(n), added(n), label(n), queued(n),
+          new_label(n), remaining(n), next(num_threads), stats(num_threads)
+      {
+        for (size_type u = 0; u < n; ++u)
+          first[u + 1] = first[u] + out_degree(pr.vertex_of[u], pr.g);
+        const size_type m = first[n];
+        head.resize(m);
+        edge_of.resize(m);
+        rev.resize(m);
+        by_head.resize(m);
+        copy_body copy(*this);
+        parallel_for(n, copy, num_threads, 256);
+
+        // The arcs entering each vertex, in order of source.
+        in_first.assign(n + 1, 0);
+        for (size_type a = 0; a < m; ++a)
+          ++in_first[head[a] + 1];
+        for (size_type u = 0; u < n; ++u)
+          in_first[u + 1] += in_first[u];
+        in_arcs.resize(m);
+        std::vector<size_type> fill(in_first.begin(), in_first.end() - 1);
+        for (size_type u = 0; u < n; ++u)
+          for (size_type a = first[u]; a < first[u + 1]; ++a)
+            in_arcs[fill[head[a]]++] = std::make_pair(u, a);
+
+        reverse_body reverse(*this);
+        parallel_for(n, reverse, num_threads, 256);
+        std::vector<std::pair<size_type, size_type> >().swap(by_head);
+        std::vector<std::pair<size_type, size_type> >().swap(in_arcs);
+        std::vector<size_type>().swap(in_first);
+      }
+
+      FlowValue maximum_preflow()
+      {
+        global_relabel();
+        long work = 0;
+        for (;;) {
+          while (!active.empty()) {
+            work += round();
+            if (work * pr.global_update_frequency() > pr.nm) {
+              global_relabel();
+              work = 0;
+            }
+          }
+          // Stop only when exact labels agree that nothing is active.
+          global_relabel();
+          if (active.empty())
+            break;
+        }
+
+        for (size_type a = 0; a < edge_of.size(); ++a)
+          put(pr.residual_capacity, edge_of[a], res.load(a));
+        vertex_iterator u_iter, u_end;
+        for (boost::tie(u_iter, u_end) = vertices(pr.g); u_iter != u_end; ++u_iter)
+          put(pr.excess_flow, *u_iter, excess[get(pr.index, *u_iter)]);
+        for (size_type t = 0; t < num_threads; ++t) {
+          pr.push_count += stats[t].pushes;
+          pr.relabel_count += stats[t].relabels;
+        }
+        return excess[sink];
+      }
+
+    private:
+      // Copies the arcs of u, with the arc indices also sorted by head.
+      struct copy_body
+      {
+        explicit copy_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type u, size_type) const {
+          vertex_descriptor v = p.pr.vertex_of[u];
+          p.excess[u] = get(p.pr.excess_flow, v);
+          size_type a = p.first[u];
+          out_edge_iterator ai, a_end;
+          for (boost::tie(ai, a_end) = out_edges(v, p.pr.g); ai != a_end;
+               ++ai, ++a) {
+            p.head[a] = get(p.pr.index, target(*ai, p.pr.g));
+            p.edge_of[a] = *ai;
+            p.res.set(a, get(p.pr.residual_capacity, *ai));
+            p.by_head[a] = std::make_pair(p.head[a], a);
+          }
+          std::sort(p.by_head.begin() + p.first[u], p.by_head.begin() + a);
+        }
+        parallel_push_relabel& p;
+      };
+
+      // Pairs the arcs entering u, sorted by source, with the arcs leaving
+      // u, sorted by head.  The reverse edge map is only consulted when
+      // there are parallel arcs.
+      struct reverse_body
+      {
+        explicit reverse_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type u, size_type) const {
+          size_type i = p.in_first[u], i_end = p.in_first[u + 1];
+          size_type j = p.first[u], j_end = p.first[u + 1];
+          while (i < i_end) {
+            size_type v = p.in_arcs[i].first;
+            while (p.by_head[j].first < v)
+              ++j;
+            size_type i_next = i + 1, j_next = j + 1;
+            while (i_next < i_end && p.in_arcs[i_next].first == v)
+              ++i_next;
+            while (j_next < j_end && p.by_head[j_next].first == v)
+              ++j_next;
+            if (i_next == i + 1 && j_next == j + 1)
+              p.rev[p.in_arcs[i].second] = p.by_head[j].second;
+            else
+              for (; i < i_next; ++i) {
+                edge_descriptor r
+                  = get(p.pr.reverse_edge, p.edge_of[p.in_arcs[i].second]);
+                size_type k = j;
+                while (p.edge_of[p.by_head[k].second] != r)
+                  ++k;
+                p.rev[p.in_arcs[i].second] = p.by_head[k].second;
+              }
+            i = i_next;
+            j = j_next;
+          }
+        }
+        parallel_push_relabel& p;
+      };
+
+      bool is_active(size_type v) const {
+        return v != src && v != sink && excess[v] > 0 && label.load(v) < n;
+      }
+
+      // Discharges v using the labels of the previous round.
+      struct discharge_body
+      {
+        explicit discharge_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type i, size_type t) const { p.discharge(p.active[i], t); }
+        parallel_push_relabel& p;
+      };
+
+      void discharge(size_type v, size_type t)
+      {
+        const size_type d_old = label.load(v);
+        size_type d = d_old;
+        FlowValue e = excess[v];
+        thread_stats& st = stats[t];
+        for (;;) {
+          size_type relabel_to = n;
+          bool skipped = false;
+          for (size_type a = first[v]; a < first[v + 1] && e > 0; ++a) {
+            FlowValue r = res.load(a);
+            if (!(r > 0))
+              continue;
+            ++st.work;
+            size_type w = head[a], d_w = label.load(w);
+            if (d == d_w + 1) {
+              if (is_active(w)
+                  && !(d_old == d_w + 1 || d_old + 1 < d_w
+                       || (d_old == d_w && v < w))) {
+                skipped = true;
+                continue;
+              }
+              BOOST_USING_STD_MIN();
+              FlowValue delta = min BOOST_PREVENT_MACRO_SUBSTITUTION(r, e);
+              res.add(a, -delta);
+              res.add(rev[a], delta);
+              added.add(w, delta);
+              e -= delta;
+              r -= delta;
+              ++st.pushes;
+              if (queued.compare_and_set(w, 0, 1))
+                next[t].push_back(w);
+            }
+            if (r > 0 && d_w >= d && d_w + 1 < relabel_to)
+              relabel_to = d_w + 1;
+          }
+          if (!(e > 0) || skipped)
+            break;
+          ++st.relabels;
+          st.work += pr.beta();
+          d = relabel_to;
+          if (d >= n) {
+            d = n;
+            break;
+          }
+        }
+        new_label[v] = d;
+        remaining[v] = e;
+      }
+
+      // Publishes the new label and the remaining excess of v.
+      struct commit_body
+      {
+        explicit commit_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type i, size_type t) const {
+          size_type v = p.active[i];
+          p.label.set(v, p.new_label[v]);
+          p.excess[v] = p.remaining[v];
+          if (p.queued.compare_and_set(v, 0, 1))
+            p.next[t].push_back(v);
+        }
+        parallel_push_relabel& p;
+      };
+
+      // Adds the flow received during the round; keeps the active ones.
+      struct receive_body
+      {
+        explicit receive_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type i, size_type t) const {
+          size_type v = p.touched[i];
+          p.excess[v] += p.added.load(v);
+          p.added.set(v, 0);
+          p.queued.set(v, 0);
+          if (p.is_active(v))
+            p.next[t].push_back(v);
+        }
+        parallel_push_relabel& p;
+      };
+
+      long round()
+      {
+        long work = 0;
+        for (size_type t = 0; t < num_threads; ++t)
+          work -= stats[t].work;
+        discharge_body discharge(*this);
+        parallel_for(active.size(), discharge, num_threads, 16);
+        commit_body commit(*this);
+        parallel_for(active.size(), commit, num_threads, 256);
+        gather(touched);
+        receive_body receive(*this);
+        parallel_for(touched.size(), receive, num_threads, 256);
+        gather(active);
+        for (size_type t = 0; t < num_threads; ++t)
+          work += stats[t].work;
+        return work;
+      }
+
+      // One level of the breadth-first search from the sink over the
+      // reversed residual graph.
+      struct relabel_body
+      {
+        relabel_body(parallel_push_relabel& p, size_type level)
+          : p(p), level(level) { }
+        void operator()(size_type i, size_type t) const {
+          size_type w = p.touched[i];
+          for (size_type a = p.first[w]; a < p.first[w + 1]; ++a) {
+            size_type v = p.head[a];
+            if (v != p.src && p.res.load(p.rev[a]) > 0
+                && p.label.load(v) == p.n
+                && p.label.compare_and_set(v, p.n, level + 1))
+              p.next[t].push_back(v);
+          }
+        }
+        parallel_push_relabel& p;
+        size_type level;
+      };
+
+      struct activate_body
+      {
+        explicit activate_body(parallel_push_relabel& p) : p(p) { }
+        void operator()(size_type v, size_type t) const {
+          if (p.is_active(v))
+            p.next[t].push_back(v);
+        }
+        parallel_push_relabel& p;
+      };
+
+      void global_relabel()
+      {
+        ++pr.update_count;
+        for (size_type v = 0; v < n; ++v)
+          label.set(v, n);
+        label.set(sink, 0);
+        touched.assign(1, sink);
+        for (size_type level = 0; !touched.empty(); ++level) {
+          relabel_body body(*this, level);
+          parallel_for(touched.size(), body, num_threads, 64);
+          gather(touched);
+        }
+        activate_body activate(*this);
+        parallel_for(n, activate, num_threads, 1024);
+        gather(active);
+      }
+
+      // Moves the per-thread lists into out.
+      void gather(std::vector<size_type>& out)
+      {
+        out.clear();
+        for (size_type t = 0; t < num_threads; ++t) {
+          out.insert(out.end(), next[t].begin(), next[t].end());
+          next[t].clear();
+        }
+      }
+
+      struct thread_stats
+      {
+        thread_stats() : pushes(0), relabels(0), work(0) { }
+        long pushes, relabels, work;
+        char padding[64];  // keep the threads' counters on separate lines
+      };
+
+      PushRelabel& pr;
+      size_type n;
+      size_type num_threads;
+      size_type src, sink;
+
+      // The residual graph; arcs of vertex u are [first[u], first[u + 1]).
+      std::vector<size_type> first, head, rev;
+      std::vector<edge_descriptor> edge_of;
+      parallel_values<FlowValue> res;
+      // Scratch space for finding the reverse arcs.
+      std::vector<std::pair<size_type, size_type> > by_head, in_arcs;
+      std::vector<size_type> in_first;
+
+      std::vector<FlowValue> excess;
+      parallel_values<FlowValue> added;
+      parallel_counters label;
+      parallel_counters queued;
+      std::vector<size_type> new_label;
+      std::vector<FlowValue> remaining;
+
+      std::vector<size_type> active, touched;
+      std::vector<std::vector<size_type> > next;  // per thread
+      std::vector<thread_stats> stats;
+    };
+
   } // namespace detail
   
   template <class Graph, 
@@ -740,6 +1103,78 @@ namespace boost {
     return push_relabel_max_flow(g, src, sink, params);
   }
 
+  // Parallel push-relabel.  Uses the synchronous parallel algorithm for the
+  // first phase when more than one thread is available and the serial one
+  // otherwise; the second phase is serial.
+  template <class Graph, 
+            class CapacityEdgeMap, class ResidualCapacityEdgeMap,
+            class ReverseEdgeMap, class VertexIndexMap>
+  typename property_traits<CapacityEdgeMap>::value_type
+  push_relabel_max_flow_parallel
+    (Graph& g, 
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink,
+     CapacityEdgeMap cap, ResidualCapacityEdgeMap res,
+     ReverseEdgeMap rev, VertexIndexMap index_map,
+     std::size_t num_threads)
+  {
+    typedef typename property_traits<CapacityEdgeMap>::value_type FlowValue;
+    typedef detail::push_relabel<Graph, CapacityEdgeMap,
+      ResidualCapacityEdgeMap, ReverseEdgeMap, VertexIndexMap, FlowValue>
+      Algo;
+
+    Algo algo(g, cap, res, rev, src, sink, index_map);
+
+    FlowValue flow;
+    num_threads = detail::resolve_number_of_threads(num_threads);
+    // On overflow the source is left active, which only the serial
+    // version handles.
+    if (num_threads > 1 && get(algo.excess_flow, src) == 0) {
+      detail::parallel_push_relabel<Algo> parallel(algo, num_threads);
+      flow = parallel.maximum_preflow();
+    } else
+      flow = algo.maximum_preflow();
+
+    algo.convert_preflow_to_flow();
+
+    BOOST_ASSERT(algo.is_flow());
+    BOOST_ASSERT(algo.is_optimal());
+
+    return flow;
+  }
+
+  template <class Graph, class P, class T, class R>
+  typename detail::edge_capacity_value<Graph, P, T, R>::type
+  push_relabel_max_flow_parallel
+    (Graph& g, 
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink,
+     const bgl_named_params<P, T, R>& params)
+  {
+    return push_relabel_max_flow_parallel
+      (g, src, sink,
+       choose_const_pmap(get_param(params, edge_capacity), g, edge_capacity),
+       choose_pmap(get_param(params, edge_residual_capacity), 
+                   g, edge_residual_capacity),
+       choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       choose_param(get_param(params, number_of_threads_t()), std::size_t(1))
+       );
+  }
+
+  template <class Graph>
+  typename property_traits<
+    typename property_map<Graph, edge_capacity_t>::const_type
+  >::value_type
+  push_relabel_max_flow_parallel
+    (Graph& g, 
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink)
+  {
+    bgl_named_params<int, buffer_param_t> params(0); // bogus empty param
+    return push_relabel_max_flow_parallel(g, src, sink, params);
+  }
+
 } // namespace boost
 
 #endif // BOOST_PUSH_RELABEL_MAX_FLOW_HPP
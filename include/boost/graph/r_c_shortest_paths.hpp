@@ -8,13 +8,22 @@
 #ifndef BOOST_GRAPH_R_C_SHORTEST_PATHS_HPP
 #define BOOST_GRAPH_R_C_SHORTEST_PATHS_HPP
 
+#include <list>
 #include <map>
 #include <queue>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <new>
 
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/property_map/property_map.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 
 namespace boost {
 
@@ -116,6 +125,172 @@ inline bool operator>=
   return l2 < l1 || l1 == l2;
 }
 
+// r_c_shortest_paths_pool_allocator class
+// an allocator that hands out single objects from slabs of growing size 
+// and keeps deallocated objects in a free list for reuse; the slabs are 
+// released in bulk when the allocator is destroyed
+// since r_c_shortest_paths creates its own label allocator, all labels of 
+// a call are released when the call returns
+// copies of an allocator do not share its slabs
+template<class T>
+class r_c_shortest_paths_pool_allocator
+{
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  template<class U>
+  struct rebind
+  {
+    typedef r_c_shortest_paths_pool_allocator<U> other;
+  };
+
+  r_c_shortest_paths_pool_allocator() 
+  : p_free( 0 ), i_next( 0 ), i_slab_size( 0 ) {}
+  r_c_shortest_paths_pool_allocator
+  ( const r_c_shortest_paths_pool_allocator& ) 
+  : p_free( 0 ), i_next( 0 ), i_slab_size( 0 ) {}
+  template<class U>
+  r_c_shortest_paths_pool_allocator
+  ( const r_c_shortest_paths_pool_allocator<U>& ) 
+  : p_free( 0 ), i_next( 0 ), i_slab_size( 0 ) {}
+  ~r_c_shortest_paths_pool_allocator()
+  {
+    for( size_type i = 0; i < vec_slabs.size(); ++i )
+      ::operator delete( vec_slabs[i] );
+  }
+
+  pointer address( reference x ) const { return &x; }
+  const_pointer address( const_reference x ) const { return &x; }
+  size_type max_size() const { return size_type( -1 ) / sizeof( T ); }
+
+  pointer allocate( size_type n, const void* = 0 )
+  {
+    if( n != 1 )
+      return static_cast<pointer>( ::operator new( n * sizeof( T ) ) );
+    if( p_free )
+    {
+      node* p = p_free;
+      p_free = p->next;
+      return reinterpret_cast<pointer>( p );
+    }
+    if( i_next == i_slab_size )
+    {
+      i_slab_size = i_slab_size == 0 ? 64 
+                    : ( std::min )( 2 * i_slab_size, size_type( 65536 ) );
+      vec_slabs.push_back
+        ( static_cast<node*>( ::operator new( i_slab_size * sizeof( node ) ) ) );
+      i_next = 0;
+    }
+    return reinterpret_cast<pointer>( vec_slabs.back() + i_next++ );
+  }
+  void deallocate( pointer p, size_type n )
+  {
+    if( n != 1 )
+    {
+      ::operator delete( p );
+      return;
+    }
+    node* q = reinterpret_cast<node*>( p );
+    q->next = p_free;
+    p_free = q;
+  }
+  void construct( pointer p, const T& val ) { new( p ) T( val ); }
+  void destroy( pointer p ) { p->~T(); }
+
+  friend bool operator==( const r_c_shortest_paths_pool_allocator& a, 
+                          const r_c_shortest_paths_pool_allocator& b )
+    { return &a == &b; }
+  friend bool operator!=( const r_c_shortest_paths_pool_allocator& a, 
+                          const r_c_shortest_paths_pool_allocator& b )
+    { return &a != &b; }
+private:
+  r_c_shortest_paths_pool_allocator& operator=
+  ( const r_c_shortest_paths_pool_allocator& );
+  union node
+  {
+    typename aligned_storage<sizeof( T ), alignment_of<T>::value>::type 
+      storage;
+    node* next;
+  };
+  std::vector<node*> vec_slabs;
+  node* p_free;
+  size_type i_next;
+  size_type i_slab_size;
+}; // r_c_shortest_paths_pool_allocator
+
+
+namespace detail {
+
+// constant_dominance_key struct
+// the dominance key used if none is given: all labels are alike
+struct constant_dominance_key
+{
+  template<class Resource_Container>
+  int operator()( const Resource_Container& ) const { return 0; }
+}; // constant_dominance_key
+
+} // detail
+
+// keyed_dominance_function class
+// a dominance function together with one or two dominance keys, i.e., 
+// function objects that map a resource container to a value such that 
+// dominance( rc1, rc2 ) implies !( key( rc2 ) < key( rc1 ) ), for example 
+// the cost and the time if a label can only be dominated by labels that 
+// are not more expensive and not later
+// r_c_shortest_paths keeps the labels at each vertex sorted by the first 
+// key in blocks that know the range of the second key, and checks a new 
+// label only against the blocks and labels whose keys allow dominance
+template<class Dominance_Function, 
+         class Dominance_Key, 
+         class Second_Dominance_Key = detail::constant_dominance_key>
+class keyed_dominance_function
+{
+public:
+  keyed_dominance_function
+  ( const Dominance_Function& d = Dominance_Function(), 
+    const Dominance_Key& k1 = Dominance_Key(), 
+    const Second_Dominance_Key& k2 = Second_Dominance_Key() ) 
+  : dominance( d ), first_key( k1 ), second_key( k2 ) {}
+  template<class Resource_Container>
+  bool operator()( const Resource_Container& rc1, 
+                   const Resource_Container& rc2 ) const
+  {
+    return dominance( rc1, rc2 );
+  }
+  const Dominance_Key& key() const { return first_key; }
+  const Second_Dominance_Key& second() const { return second_key; }
+private:
+  Dominance_Function dominance;
+  Dominance_Key first_key;
+  Second_Dominance_Key second_key;
+}; // keyed_dominance_function
+
+template<class Dominance_Function, class Dominance_Key>
+inline keyed_dominance_function<Dominance_Function, Dominance_Key> 
+make_keyed_dominance( const Dominance_Function& d, const Dominance_Key& k )
+{
+  return keyed_dominance_function<Dominance_Function, Dominance_Key>( d, k );
+}
+
+template<class Dominance_Function, 
+         class Dominance_Key, 
+         class Second_Dominance_Key>
+inline 
+keyed_dominance_function
+  <Dominance_Function, Dominance_Key, Second_Dominance_Key> 
+make_keyed_dominance( const Dominance_Function& d, 
+                      const Dominance_Key& k1, 
+                      const Second_Dominance_Key& k2 )
+{
+  return keyed_dominance_function
+    <Dominance_Function, Dominance_Key, Second_Dominance_Key>( d, k1, k2 );
+}
+
 namespace detail {
 
 // ks_smart_pointer class
@@ -160,6 +335,639 @@ private:
 }; // ks_smart_pointer
 
 
+// dominance_keys_of struct
+// the dominance keys of a dominance function, if it is a 
+// keyed_dominance_function, and constant keys otherwise
+template<class Dominance_Function>
+struct dominance_keys_of
+{
+  typedef constant_dominance_key first_type;
+  typedef constant_dominance_key second_type;
+  static first_type first( const Dominance_Function& ) 
+    { return first_type(); }
+  static second_type second( const Dominance_Function& ) 
+    { return second_type(); }
+}; // dominance_keys_of
+
+template<class Dominance_Function, 
+         class Dominance_Key, 
+         class Second_Dominance_Key>
+struct dominance_keys_of
+  <keyed_dominance_function
+    <Dominance_Function, Dominance_Key, Second_Dominance_Key> >
+{
+  typedef keyed_dominance_function
+    <Dominance_Function, Dominance_Key, Second_Dominance_Key> dominance_type;
+  typedef Dominance_Key first_type;
+  typedef Second_Dominance_Key second_type;
+  static first_type first( const dominance_type& d ) { return d.key(); }
+  static second_type second( const dominance_type& d ) { return d.second(); }
+}; // dominance_keys_of
+
+// label_keys struct
+// compares labels by the dominance keys of their resource consumption; 
+// the function call operator compares by the first key
+template<class Label, class Dominance_Key, class Second_Dominance_Key>
+struct label_keys
+{
+  label_keys( const Dominance_Key& k1, const Second_Dominance_Key& k2 ) 
+  : first_key( k1 ), second_key( k2 ) {}
+  bool operator()( const Label* p1, const Label* p2 ) const
+  {
+    return first_key( p1->cumulated_resource_consumption ) 
+           < first_key( p2->cumulated_resource_consumption );
+  }
+  bool second_less( const Label* p1, const Label* p2 ) const
+  {
+    return second_key( p1->cumulated_resource_consumption ) 
+           < second_key( p2->cumulated_resource_consumption );
+  }
+  Dominance_Key first_key;
+  Second_Dominance_Key second_key;
+}; // label_keys
+
+// vertex_label_index class
+// the undominated labels resident at a vertex, sorted by the first 
+// dominance key and cut into blocks of at most 2 * block_size labels; 
+// each block knows its labels with the smallest and the largest second 
+// key, so that the dominance checks skip the blocks that cannot hold a 
+// label dominating, or dominated by, a new label
+template<class Label>
+class vertex_label_index
+{
+public:
+  vertex_label_index() : i_size( 0 ) {}
+
+  size_t size() const { return i_size; }
+
+  // whether a label in the index dominates p_new; the labels with the 
+  // closest first key are tried first, because a label with a much 
+  // smaller key tends to be worse in the other resources
+  template<class Keys, class Dominance_Function>
+  bool is_dominated( const Label* p_new, 
+                     const Keys& keys, 
+                     Dominance_Function& dominance ) const
+  {
+    typename std::list<block>::const_iterator bi = last_block( p_new, keys );
+    while( bi != list_blocks.begin() )
+    {
+      const block& cur = *--bi;
+      if( keys.second_less( p_new, cur.p_min_second ) )
+        continue;
+      typename std::vector<Label*>::const_iterator iter = 
+        std::upper_bound
+          ( cur.vec_labels.begin(), cur.vec_labels.end(), p_new, keys );
+      while( iter != cur.vec_labels.begin() )
+      {
+        --iter;
+        if( dominance( (*iter)->cumulated_resource_consumption, 
+                       p_new->cumulated_resource_consumption ) )
+          return true;
+      }
+    }
+    return false;
+  }
+
+  // removes the labels dominated by p_new and appends them to removed
+  template<class Keys, class Dominance_Function>
+  void remove_dominated( const Label* p_new, 
+                         const Keys& keys, 
+                         Dominance_Function& dominance, 
+                         std::vector<Label*>& removed )
+  {
+    typename std::list<block>::iterator bi = list_blocks.begin();
+    while( bi != list_blocks.end() )
+    {
+      block& cur = *bi;
+      if( keys( cur.vec_labels.back(), p_new ) 
+          || keys.second_less( cur.p_max_second, p_new ) )
+      {
+        ++bi;
+        continue;
+      }
+      typename std::vector<Label*>::iterator kept = 
+        std::lower_bound
+          ( cur.vec_labels.begin(), cur.vec_labels.end(), p_new, keys );
+      const size_t i_removed_before = removed.size();
+      for( typename std::vector<Label*>::iterator iter = kept; 
+           iter != cur.vec_labels.end(); 
+           ++iter )
+      {
+        if( dominance( p_new->cumulated_resource_consumption, 
+                       (*iter)->cumulated_resource_consumption ) )
+          removed.push_back( *iter );
+        else
+          *kept++ = *iter;
+      }
+      cur.vec_labels.erase( kept, cur.vec_labels.end() );
+      i_size -= removed.size() - i_removed_before;
+      if( cur.vec_labels.empty() )
+        bi = list_blocks.erase( bi );
+      else
+      {
+        if( removed.size() != i_removed_before )
+          update_bounds( cur, keys );
+        ++bi;
+      }
+    }
+  }
+
+  template<class Keys>
+  void insert( Label* p_new, const Keys& keys )
+  {
+    typename std::list<block>::iterator bi = last_block( p_new, keys );
+    if( bi != list_blocks.begin() )
+      --bi;
+    if( bi == list_blocks.end() )
+      bi = list_blocks.insert( bi, block() );
+    block& cur = *bi;
+    cur.vec_labels.insert
+      ( std::upper_bound
+          ( cur.vec_labels.begin(), cur.vec_labels.end(), p_new, keys ), 
+        p_new );
+    ++i_size;
+    if( cur.vec_labels.size() == 1 
+        || keys.second_less( p_new, cur.p_min_second ) )
+      cur.p_min_second = p_new;
+    if( cur.vec_labels.size() == 1 
+        || keys.second_less( cur.p_max_second, p_new ) )
+      cur.p_max_second = p_new;
+    if( cur.vec_labels.size() > 2 * block_size )
+    {
+      typename std::list<block>::iterator half = bi;
+      half = list_blocks.insert( ++half, block() );
+      half->vec_labels.assign
+        ( cur.vec_labels.begin() + block_size, cur.vec_labels.end() );
+      cur.vec_labels.resize( block_size );
+      update_bounds( cur, keys );
+      update_bounds( *half, keys );
+    }
+  }
+
+  // appends the labels to labels, in the order of the first key
+  void copy_labels( std::vector<Label*>& labels ) const
+  {
+    typename std::list<block>::const_iterator bi = list_blocks.begin();
+    for( ; bi != list_blocks.end(); ++bi )
+      labels.insert
+        ( labels.end(), bi->vec_labels.begin(), bi->vec_labels.end() );
+  }
+
+private:
+  enum { block_size = 32 };
+
+  struct block
+  {
+    block() : p_min_second( 0 ), p_max_second( 0 ) {}
+    std::vector<Label*> vec_labels;
+    Label* p_min_second;
+    Label* p_max_second;
+  };
+
+  // the block after the last block whose first label has a first key 
+  // not greater than that of p_new
+  template<class Keys>
+  typename std::list<block>::const_iterator 
+  last_block( const Label* p_new, const Keys& keys ) const
+  {
+    typename std::list<block>::const_iterator bi = list_blocks.end();
+    while( bi != list_blocks.begin() )
+    {
+      --bi;
+      if( !keys( p_new, bi->vec_labels.front() ) )
+        return ++bi;
+    }
+    return bi;
+  }
+
+  template<class Keys>
+  typename std::list<block>::iterator 
+  last_block( const Label* p_new, const Keys& keys )
+  {
+    typename std::list<block>::iterator bi = list_blocks.end();
+    while( bi != list_blocks.begin() )
+    {
+      --bi;
+      if( !keys( p_new, bi->vec_labels.front() ) )
+        return ++bi;
+    }
+    return bi;
+  }
+
+  template<class Keys>
+  static void update_bounds( block& cur, const Keys& keys )
+  {
+    cur.p_min_second = cur.p_max_second = cur.vec_labels.front();
+    for( size_t i = 1; i < cur.vec_labels.size(); ++i )
+    {
+      if( keys.second_less( cur.vec_labels[i], cur.p_min_second ) )
+        cur.p_min_second = cur.vec_labels[i];
+      if( keys.second_less( cur.p_max_second, cur.vec_labels[i] ) )
+        cur.p_max_second = cur.vec_labels[i];
+    }
+  }
+
+  std::list<block> list_blocks;
+  size_t i_size;
+}; // vertex_label_index
+
+// label_num_less struct
+// orders pointers to labels by their creation
+template<class Label>
+struct label_num_less
+{
+  bool operator()( const Label* p1, const Label* p2 ) const
+  {
+    return p1->num < p2->num;
+  }
+}; // label_num_less
+
+// label_resource_less struct
+// orders pointers to labels by their resource consumption
+template<class Label>
+struct label_resource_less
+{
+  bool operator()( const Label* p1, const Label* p2 ) const
+  {
+    return p1->cumulated_resource_consumption 
+           < p2->cumulated_resource_consumption;
+  }
+}; // label_resource_less
+
+// r_c_forward_direction struct
+// labels are extended from the source to the target of the out-edges
+template<class Graph>
+struct r_c_forward_direction
+{
+  typedef typename graph_traits<Graph>::out_edge_iterator iterator;
+  static std::pair<iterator, iterator> 
+  edges( typename graph_traits<Graph>::vertex_descriptor v, const Graph& g )
+  {
+    return out_edges( v, g );
+  }
+  static typename graph_traits<Graph>::vertex_descriptor 
+  next( typename graph_traits<Graph>::edge_descriptor ed, const Graph& g )
+  {
+    return target( ed, g );
+  }
+}; // r_c_forward_direction
+
+// r_c_backward_direction struct
+// labels are extended from the target to the source of the in-edges
+template<class Graph>
+struct r_c_backward_direction
+{
+  typedef typename graph_traits<Graph>::in_edge_iterator iterator;
+  static std::pair<iterator, iterator> 
+  edges( typename graph_traits<Graph>::vertex_descriptor v, const Graph& g )
+  {
+    return in_edges( v, g );
+  }
+  static typename graph_traits<Graph>::vertex_descriptor 
+  next( typename graph_traits<Graph>::edge_descriptor ed, const Graph& g )
+  {
+    return source( ed, g );
+  }
+}; // r_c_backward_direction
+
+// always_extendable struct
+struct always_extendable
+{
+  template<class Resource_Container>
+  bool operator()( const Resource_Container& ) const { return true; }
+}; // always_extendable
+
+// r_c_label_setting class
+// the labels of one search: the queue of unprocessed labels, the 
+// undominated labels at each vertex and the label allocators; the 
+// destructor deletes all labels
+// with one thread, the labels are extended one at a time in the order of 
+// the queue; with several threads, batches of undominated labels are 
+// taken from the queue and extended concurrently, each thread with its 
+// own allocator, and the dominance check and insertion at a vertex are 
+// done under the lock of that vertex
+template<class Graph, 
+         class VertexIndexMap, 
+         class Resource_Container, 
+         class Label_Allocator, 
+         class Keys>
+class r_c_label_setting
+{
+public:
+  typedef r_c_shortest_paths_label<Graph, Resource_Container> Label;
+  typedef Resource_Container Resource_Container_Type;
+  typedef 
+    typename Label_Allocator::template rebind<Label>::other LAlloc;
+  typedef ks_smart_pointer<Label> Splabel;
+  typedef 
+    std::priority_queue<Splabel, std::vector<Splabel>, std::greater<Splabel> > 
+      Queue;
+  typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename graph_traits<Graph>::edge_descriptor Edge;
+
+  r_c_label_setting( const Graph& graph, 
+                     const VertexIndexMap& vertex_index_map, 
+                     const Keys& label_keys, 
+                     std::size_t num_threads )
+  : g( graph ), 
+    keys( label_keys ), 
+    i_threads( num_threads ), 
+    label_num( 1 ), 
+    l_allocs( new LAlloc[num_threads] ), 
+    vec_vertex_labels_data( num_vertices( graph ) ), 
+    vec_vertex_labels( vec_vertex_labels_data.begin(), vertex_index_map ), 
+    vertex_mutexes( new parallel_mutex[num_vertices( graph )] ), 
+    vertex_index( vertex_index_map ), 
+    vec_dominated_processed_labels( num_threads ), 
+    vec_new_labels( num_threads ), 
+    vec_newly_dominated_labels( num_threads )
+  {}
+
+  ~r_c_label_setting()
+  {
+    // dominated labels are only referenced by the queue; undominated 
+    // labels are resident at their vertices
+    while( !unprocessed_labels.empty() )
+    {
+      Splabel l = unprocessed_labels.top();
+      unprocessed_labels.pop();
+      if( l->b_is_dominated )
+        delete_label( l.get(), 0 );
+    }
+    std::vector<Label*>& vec_labels = vec_dominated_processed_labels[0];
+    for( std::size_t i = 1; i < i_threads; ++i )
+      vec_labels.insert( vec_labels.end(), 
+                         vec_dominated_processed_labels[i].begin(), 
+                         vec_dominated_processed_labels[i].end() );
+    BGL_FORALL_VERTICES_T(v, g, Graph) {
+      vec_vertex_labels[v].copy_labels( vec_labels );
+    }
+    for( std::size_t i = 0; i < vec_labels.size(); ++i )
+      delete_label( vec_labels[i], 0 );
+  }
+
+  void start( Vertex s, const Resource_Container& rc )
+  {
+    Label* first_label = l_allocs[0].allocate( 1 );
+    l_allocs[0].construct
+      ( first_label, Label( 0, rc, 0, Edge(), s ) );
+    vec_vertex_labels[s].insert( first_label, keys );
+    unprocessed_labels.push( Splabel( first_label ) );
+  }
+
+  // processes labels until the queue is empty, the visitor stops the 
+  // search, or, if b_stop_at_t, an undominated label at t is popped; 
+  // labels for which extendable is false are processed but not extended
+  template<class Direction, 
+           class Resource_Extension_Function, 
+           class Dominance_Function, 
+           class Extendable, 
+           class Visitor>
+  void run( Direction, 
+            Resource_Extension_Function& ref, 
+            Dominance_Function& dominance, 
+            const Extendable& extendable, 
+            Visitor& vis, 
+            bool b_stop_at_t, 
+            Vertex t )
+  {
+    typedef 
+      extend_body<Direction, Resource_Extension_Function, 
+                  Dominance_Function, Visitor> Body;
+    Body body( *this, ref, dominance, vis );
+    const std::size_t i_batch_size = i_threads == 1 ? 1 : 16 * i_threads;
+    std::vector<Label*> batch;
+    bool b_stop = false;
+    while( !b_stop 
+           && !unprocessed_labels.empty() 
+           && vis.on_enter_loop( unprocessed_labels, g ) )
+    {
+      batch.clear();
+      for( std::size_t i = 0; 
+           i < i_batch_size && !unprocessed_labels.empty(); 
+           ++i )
+      {
+        Splabel cur_label = unprocessed_labels.top();
+        assert (cur_label->b_is_valid);
+        unprocessed_labels.pop();
+        vis.on_label_popped( *cur_label, g );
+        // a label that was dominated after it was queued is no longer 
+        // resident at its vertex, and only the queue still referenced it
+        if( cur_label->b_is_dominated )
+        {
+          vis.on_label_dominated( *cur_label, g );
+          delete_label( cur_label.get(), 0 );
+          continue;
+        }
+        if( b_stop_at_t && cur_label->resident_vertex == t )
+        {
+          b_stop = true;
+          break;
+        }
+        cur_label->b_is_processed = true;
+        vis.on_label_not_dominated( *cur_label, g );
+        if( extendable( cur_label->cumulated_resource_consumption ) )
+          batch.push_back( cur_label.get() );
+      }
+      body.batch = &batch;
+      if( i_threads == 1 )
+      {
+        for( std::size_t i = 0; i < batch.size(); ++i )
+          body( i, 0 );
+      }
+      else
+        parallel_for( batch.size(), body, i_threads );
+      for( std::size_t i = 0; i < i_threads; ++i )
+      {
+        for( std::size_t k = 0; k < vec_new_labels[i].size(); ++k )
+          unprocessed_labels.push( Splabel( vec_new_labels[i][k] ) );
+        vec_new_labels[i].clear();
+      }
+    }
+  }
+
+  // the undominated labels at v, in the order of their creation
+  void labels_at( Vertex v, std::vector<Label*>& labels ) const
+  {
+    labels.clear();
+    vec_vertex_labels[v].copy_labels( labels );
+    std::sort( labels.begin(), labels.end(), label_num_less<Label>() );
+  }
+
+private:
+  typedef 
+    iterator_property_map
+      <typename std::vector<vertex_label_index<Label> >::iterator, 
+       VertexIndexMap> Vertex_Labels;
+
+  // extends the labels of a batch; called with the index of a label in 
+  // the batch and of the thread
+  template<class Direction, 
+           class Resource_Extension_Function, 
+           class Dominance_Function, 
+           class Visitor>
+  struct extend_body
+  {
+    extend_body( r_c_label_setting& s, 
+                 Resource_Extension_Function& r, 
+                 Dominance_Function& d, 
+                 Visitor& v ) 
+    : search( s ), ref( r ), dominance( d ), vis( v ), batch( 0 ) {}
+
+    void operator()( std::size_t i, std::size_t thread )
+    {
+      const Label* cur_label = (*batch)[i];
+      typename Direction::iterator ei, ei_end;
+      for( boost::tie( ei, ei_end ) = 
+             Direction::edges( cur_label->resident_vertex, search.g ); 
+           ei != ei_end; 
+           ++ei )
+        search.extend
+          ( cur_label, *ei, Direction::next( *ei, search.g ), 
+            ref, dominance, vis, vis_mutex, thread );
+    }
+
+    r_c_label_setting& search;
+    Resource_Extension_Function& ref;
+    Dominance_Function& dominance;
+    Visitor& vis;
+    parallel_mutex vis_mutex;
+    const std::vector<Label*>* batch;
+  }; // extend_body
+
+  template<class Resource_Extension_Function, 
+           class Dominance_Function, 
+           class Visitor>
+  void extend( const Label* cur_label, 
+               Edge ed, 
+               Vertex next_vertex, 
+               Resource_Extension_Function& ref, 
+               Dominance_Function& dominance, 
+               Visitor& vis, 
+               parallel_mutex& vis_mutex, 
+               std::size_t thread )
+  {
+    Label* new_label = l_allocs[thread].allocate( 1 );
+    l_allocs[thread].construct
+      ( new_label, 
+        Label( next_label_num(), 
+               cur_label->cumulated_resource_consumption, 
+               cur_label, 
+               ed, 
+               next_vertex ) );
+    bool b_feasible = 
+      ref( g, 
+           new_label->cumulated_resource_consumption, 
+           new_label->p_pred_label->cumulated_resource_consumption, 
+           new_label->pred_edge );
+    if( !b_feasible )
+    {
+      {
+        parallel_lock lock( vis_mutex );
+        vis.on_label_not_feasible( *new_label, g );
+      }
+      delete_label( new_label, thread );
+      return;
+    }
+    {
+      parallel_lock lock( vis_mutex );
+      vis.on_label_feasible( *new_label, g );
+    }
+
+    // dominance check against the labels resident at the new vertex
+    bool b_dominated;
+    {
+      parallel_lock lock( vertex_mutex( next_vertex ) );
+      vertex_label_index<Label>& index = vec_vertex_labels[next_vertex];
+      b_dominated = index.is_dominated( new_label, keys, dominance );
+      if( !b_dominated )
+      {
+        std::vector<Label*>& vec_removed = 
+          vec_newly_dominated_labels[thread];
+        vec_removed.clear();
+        index.remove_dominated( new_label, keys, dominance, vec_removed );
+        for( std::size_t i = 0; i < vec_removed.size(); ++i )
+        {
+          Label* p_label = vec_removed[i];
+          p_label->b_is_dominated = true;
+          // processed labels are kept until the end, because the labels 
+          // extended from them point to them; unprocessed labels are 
+          // deleted when popped
+          if( p_label->b_is_processed )
+            vec_dominated_processed_labels[thread].push_back( p_label );
+        }
+        index.insert( new_label, keys );
+      }
+    }
+    if( b_dominated )
+    {
+      new_label->b_is_dominated = true;
+      {
+        parallel_lock lock( vis_mutex );
+        vis.on_label_dominated( *new_label, g );
+      }
+      delete_label( new_label, thread );
+      return;
+    }
+    vec_new_labels[thread].push_back( new_label );
+  }
+
+  void delete_label( Label* p_label, std::size_t thread )
+  {
+    assert (p_label->b_is_valid);
+    p_label->b_is_valid = false;
+    l_allocs[thread].destroy( p_label );
+    l_allocs[thread].deallocate( p_label, 1 );
+  }
+
+  unsigned long next_label_num()
+  {
+    if( i_threads == 1 )
+    {
+      label_num.set( 0, label_num.load( 0 ) + 1 );
+      return label_num.load( 0 ) - 1;
+    }
+    std::size_t num;
+    do
+      num = label_num.load( 0 );
+    while( !label_num.compare_and_set( 0, num, num + 1 ) );
+    return num;
+  }
+
+  parallel_mutex& vertex_mutex( Vertex v )
+  {
+    return vertex_mutexes[get( vertex_index, v )];
+  }
+
+  const Graph& g;
+  const Keys keys;
+  const std::size_t i_threads;
+  parallel_counters label_num;
+  scoped_array<LAlloc> l_allocs;
+  Queue unprocessed_labels;
+  std::vector<vertex_label_index<Label> > vec_vertex_labels_data;
+  Vertex_Labels vec_vertex_labels;
+  scoped_array<parallel_mutex> vertex_mutexes;
+  VertexIndexMap vertex_index;
+  // per thread
+  std::vector<std::vector<Label*> > vec_dominated_processed_labels;
+  std::vector<std::vector<Label*> > vec_new_labels;
+  std::vector<std::vector<Label*> > vec_newly_dominated_labels;
+}; // r_c_label_setting
+
+// r_c_label_path function
+// appends the edges of the path of a label to path, from the label back 
+// to the first label
+template<class Label, class Edge>
+void r_c_label_path( const Label* p_label, std::vector<Edge>& path )
+{
+  for( ; p_label->p_pred_label != 0; p_label = p_label->p_pred_label )
+  {
+    assert (p_label->b_is_valid);
+    path.push_back( p_label->pred_edge );
+  }
+}
+
 // r_c_shortest_paths_dispatch function (body/implementation)
 template<class Graph, 
          class VertexIndexMap, 
@@ -190,305 +998,350 @@ void r_c_shortest_paths_dispatch
   Dominance_Function& dominance, 
   // to specify the memory management strategy for the labels
   Label_Allocator /*la*/, 
-  Visitor vis )
+  Visitor vis, 
+  std::size_t num_threads )
 {
   pareto_optimal_resource_containers.clear();
   pareto_optimal_solutions.clear();
 
-  size_t i_label_num = 0;
   typedef 
-    typename 
-      Label_Allocator::template rebind
-        <r_c_shortest_paths_label
-          <Graph, Resource_Container> >::other LAlloc;
-  LAlloc l_alloc;
+    dominance_keys_of<typename remove_const<Dominance_Function>::type> 
+      Keys_Of;
   typedef 
-    ks_smart_pointer
-      <r_c_shortest_paths_label<Graph, Resource_Container> > Splabel;
-  std::priority_queue<Splabel, std::vector<Splabel>, std::greater<Splabel> > 
-    unprocessed_labels;
-
-  bool b_feasible = true;
-  r_c_shortest_paths_label<Graph, Resource_Container>* first_label = 
-    l_alloc.allocate( 1 );
-  l_alloc.construct
-    ( first_label, 
-      r_c_shortest_paths_label
-        <Graph, Resource_Container>( i_label_num++, 
-                                     rc, 
-                                     0, 
-                                     typename graph_traits<Graph>::
-                                       edge_descriptor(), 
-                                     s ) );
-
-  Splabel splabel_first_label = Splabel( first_label );
-  unprocessed_labels.push( splabel_first_label );
-  std::vector<std::list<Splabel> > vec_vertex_labels_data( num_vertices( g ) );
-  iterator_property_map<typename std::vector<std::list<Splabel> >::iterator,
-                        VertexIndexMap>
-    vec_vertex_labels(vec_vertex_labels_data.begin(), vertex_index_map);
-  vec_vertex_labels[s].push_back( splabel_first_label );
-  typedef
-    std::vector<typename std::list<Splabel>::iterator> 
-    vec_last_valid_positions_for_dominance_data_type;
-  vec_last_valid_positions_for_dominance_data_type
-    vec_last_valid_positions_for_dominance_data( num_vertices( g ) );
-  iterator_property_map<
-      typename vec_last_valid_positions_for_dominance_data_type::iterator,
-      VertexIndexMap>
-    vec_last_valid_positions_for_dominance
-      (vec_last_valid_positions_for_dominance_data.begin(),
-       vertex_index_map);
-  BGL_FORALL_VERTICES_T(v, g, Graph) {
-    put(vec_last_valid_positions_for_dominance, v, vec_vertex_labels[v].begin());
-  }
-  std::vector<size_t> vec_last_valid_index_for_dominance_data( num_vertices( g ), 0 );
-  iterator_property_map<std::vector<size_t>::iterator, VertexIndexMap>
-    vec_last_valid_index_for_dominance
-      (vec_last_valid_index_for_dominance_data.begin(), vertex_index_map);
-  std::vector<bool> 
-    b_vec_vertex_already_checked_for_dominance_data( num_vertices( g ), false );
-  iterator_property_map<std::vector<bool>::iterator, VertexIndexMap>
-    b_vec_vertex_already_checked_for_dominance
-      (b_vec_vertex_already_checked_for_dominance_data.begin(),
-       vertex_index_map);
-
-  while( !unprocessed_labels.empty()  && vis.on_enter_loop(unprocessed_labels, g) )
-  {
-    Splabel cur_label = unprocessed_labels.top();
-    assert (cur_label->b_is_valid);
-    unprocessed_labels.pop();
-    vis.on_label_popped( *cur_label, g );
-    // an Splabel object in unprocessed_labels and the respective Splabel 
-    // object in the respective list<Splabel> of vec_vertex_labels share their 
-    // embedded r_c_shortest_paths_label object
-    // to avoid memory leaks, dominated 
-    // r_c_shortest_paths_label objects are marked and deleted when popped 
-    // from unprocessed_labels, as they can no longer be deleted at the end of 
-    // the function; only the Splabel object in unprocessed_labels still 
-    // references the r_c_shortest_paths_label object
-    // this is also for efficiency, because the else branch is executed only 
-    // if there is a chance that extending the 
-    // label leads to new undominated labels, which in turn is possible only 
-    // if the label to be extended is undominated
-    assert (cur_label->b_is_valid);
-    if( !cur_label->b_is_dominated )
-    {
-      typename boost::graph_traits<Graph>::vertex_descriptor
-        i_cur_resident_vertex = cur_label->resident_vertex;
-      std::list<Splabel>& list_labels_cur_vertex = 
-        get(vec_vertex_labels, i_cur_resident_vertex);
-      if( list_labels_cur_vertex.size() >= 2 
-          && vec_last_valid_index_for_dominance[i_cur_resident_vertex] 
-               < list_labels_cur_vertex.size() )
-      {
-        typename std::list<Splabel>::iterator outer_iter = 
-          list_labels_cur_vertex.begin();
-        bool b_outer_iter_at_or_beyond_last_valid_pos_for_dominance = false;
-        while( outer_iter != list_labels_cur_vertex.end() )
-        {
-          Splabel cur_outer_splabel = *outer_iter;
-          assert (cur_outer_splabel->b_is_valid);
-          typename std::list<Splabel>::iterator inner_iter = outer_iter;
-          if( !b_outer_iter_at_or_beyond_last_valid_pos_for_dominance 
-              && outer_iter == 
-                   get(vec_last_valid_positions_for_dominance,
-                       i_cur_resident_vertex) )
-            b_outer_iter_at_or_beyond_last_valid_pos_for_dominance = true;
-          if( !get(b_vec_vertex_already_checked_for_dominance, i_cur_resident_vertex)
-              || b_outer_iter_at_or_beyond_last_valid_pos_for_dominance )
-          {
-            ++inner_iter;
-          }
-          else
-          {
-            inner_iter = 
-              get(vec_last_valid_positions_for_dominance,
-                  i_cur_resident_vertex);
-            ++inner_iter;
-          }
-          bool b_outer_iter_erased = false;
-          while( inner_iter != list_labels_cur_vertex.end() )
-          {
-            Splabel cur_inner_splabel = *inner_iter;
-            assert (cur_inner_splabel->b_is_valid);
-            if( dominance( cur_outer_splabel->
-                             cumulated_resource_consumption, 
-                           cur_inner_splabel->
-                             cumulated_resource_consumption ) )
-            {
-              typename std::list<Splabel>::iterator buf = inner_iter;
-              ++inner_iter;
-              list_labels_cur_vertex.erase( buf );
-              if( cur_inner_splabel->b_is_processed )
-              {
-                cur_inner_splabel->b_is_valid = false;
-                l_alloc.destroy( cur_inner_splabel.get() );
-                l_alloc.deallocate( cur_inner_splabel.get(), 1 );
-              }
-              else
-                cur_inner_splabel->b_is_dominated = true;
-              continue;
-            }
-            else
-              ++inner_iter;
-            if( dominance( cur_inner_splabel->
-                             cumulated_resource_consumption, 
-                           cur_outer_splabel->
-                             cumulated_resource_consumption ) )
-            {
-              typename std::list<Splabel>::iterator buf = outer_iter;
-              ++outer_iter;
-              list_labels_cur_vertex.erase( buf );
-              b_outer_iter_erased = true;
-              assert (cur_outer_splabel->b_is_valid);
-              if( cur_outer_splabel->b_is_processed )
-              {
-                cur_outer_splabel->b_is_valid = false;
-                l_alloc.destroy( cur_outer_splabel.get() );
-                l_alloc.deallocate( cur_outer_splabel.get(), 1 );
-              }
-              else
-                cur_outer_splabel->b_is_dominated = true;
-              break;
-            }
-          }
-          if( !b_outer_iter_erased )
-            ++outer_iter;
-        }
-        if( list_labels_cur_vertex.size() > 1 )
-          put(vec_last_valid_positions_for_dominance, i_cur_resident_vertex,
-            (--(list_labels_cur_vertex.end())));
-        else
-          put(vec_last_valid_positions_for_dominance, i_cur_resident_vertex,
-            list_labels_cur_vertex.begin());
-        put(b_vec_vertex_already_checked_for_dominance,
-            i_cur_resident_vertex, true);
-        put(vec_last_valid_index_for_dominance, i_cur_resident_vertex,
-          list_labels_cur_vertex.size() - 1);
-      }
-    }
-    assert (b_all_pareto_optimal_solutions || cur_label->b_is_valid);
-    if( !b_all_pareto_optimal_solutions && cur_label->resident_vertex == t )
-    {
-      // the devil don't sleep
-      if( cur_label->b_is_dominated )
-      {
-        cur_label->b_is_valid = false;
-        l_alloc.destroy( cur_label.get() );
-        l_alloc.deallocate( cur_label.get(), 1 );
-      }
-      while( unprocessed_labels.size() )
-      {
-        Splabel l = unprocessed_labels.top();
-        assert (l->b_is_valid);
-        unprocessed_labels.pop();
-        // delete only dominated labels, because nondominated labels are 
-        // deleted at the end of the function
-        if( l->b_is_dominated )
-        {
-          l->b_is_valid = false;
-          l_alloc.destroy( l.get() );
-          l_alloc.deallocate( l.get(), 1 );
-        }
-      }
+    label_keys<r_c_shortest_paths_label<Graph, Resource_Container>, 
+               typename Keys_Of::first_type, 
+               typename Keys_Of::second_type> Keys;
+  typedef 
+    r_c_label_setting
+      <Graph, VertexIndexMap, Resource_Container, Label_Allocator, Keys> 
+        Search;
+  typedef typename Search::Label Label;
+  Search search( g, 
+                 vertex_index_map, 
+                 Keys( Keys_Of::first( dominance ), 
+                       Keys_Of::second( dominance ) ), 
+                 resolve_number_of_threads( num_threads ) );
+  search.start( s, rc );
+  search.run( r_c_forward_direction<Graph>(), ref, dominance, 
+              always_extendable(), vis, !b_all_pareto_optimal_solutions, t );
+
+  // report the labels at t in the order of their creation, or, if 
+  // several threads were requested, in which case the order of creation 
+  // depends on the scheduling, in the order of their resource consumption
+  std::vector<Label*> dsplabels;
+  search.labels_at( t, dsplabels );
+  if( num_threads != 1 )
+    std::stable_sort
+      ( dsplabels.begin(), dsplabels.end(), label_resource_less<Label>() );
+  for( std::size_t i = 0; i < dsplabels.size(); ++i )
+  {
+    pareto_optimal_resource_containers.
+      push_back( dsplabels[i]->cumulated_resource_consumption );
+    pareto_optimal_solutions.push_back
+      ( std::vector<typename graph_traits<Graph>::edge_descriptor>() );
+    r_c_label_path( dsplabels[i], pareto_optimal_solutions.back() );
+    if( !b_all_pareto_optimal_solutions )
       break;
-    }
-    if( !cur_label->b_is_dominated )
-    {
-      cur_label->b_is_processed = true;
-      vis.on_label_not_dominated( *cur_label, g );
-      typename graph_traits<Graph>::vertex_descriptor cur_vertex = 
-        cur_label->resident_vertex;
-      typename graph_traits<Graph>::out_edge_iterator oei, oei_end;
-      for( boost::tie( oei, oei_end ) = out_edges( cur_vertex, g ); 
-           oei != oei_end; 
-           ++oei )
-      {
-        b_feasible = true;
-        r_c_shortest_paths_label<Graph, Resource_Container>* new_label = 
-          l_alloc.allocate( 1 );
-        l_alloc.construct( new_label, 
-                           r_c_shortest_paths_label
-                             <Graph, Resource_Container>
-                               ( i_label_num++, 
-                                 cur_label->cumulated_resource_consumption, 
-                                 cur_label.get(), 
-                                 *oei, 
-                                 target( *oei, g ) ) );
-        b_feasible = 
-          ref( g, 
-               new_label->cumulated_resource_consumption, 
-               new_label->p_pred_label->cumulated_resource_consumption, 
-               new_label->pred_edge );
-
-        if( !b_feasible )
-        {
-          vis.on_label_not_feasible( *new_label, g );
-          new_label->b_is_valid = false;
-          l_alloc.destroy( new_label );
-          l_alloc.deallocate( new_label, 1 );
-        }
-        else
-        {
-          const r_c_shortest_paths_label<Graph, Resource_Container>& 
-            ref_new_label = *new_label;
-          vis.on_label_feasible( ref_new_label, g );
-          Splabel new_sp_label( new_label );
-          vec_vertex_labels[new_sp_label->resident_vertex].
-            push_back( new_sp_label );
-          unprocessed_labels.push( new_sp_label );
-        }
-      }
-    }
-    else
-    {
-      assert (cur_label->b_is_valid);
-      vis.on_label_dominated( *cur_label, g );
-      cur_label->b_is_valid = false;
-      l_alloc.destroy( cur_label.get() );
-      l_alloc.deallocate( cur_label.get(), 1 );
-    }
   }
-  std::list<Splabel> dsplabels = get(vec_vertex_labels, t);
-  typename std::list<Splabel>::const_iterator csi = dsplabels.begin();
-  typename std::list<Splabel>::const_iterator csi_end = dsplabels.end();
-  // if d could be reached from o
-  if( !dsplabels.empty() )
+} // r_c_shortest_paths_dispatch
+
+// r_c_not_halfway struct
+// the labels of one direction of the bidirectional search that are not 
+// past the halfway point, and may therefore be extended
+template<class Halfway>
+struct r_c_not_halfway
+{
+  r_c_not_halfway( const Halfway& h, bool b_fwd ) 
+  : halfway( h ), b_forward( b_fwd ) {}
+  template<class Resource_Container>
+  bool operator()( const Resource_Container& rc ) const
+  {
+    return !halfway( rc, b_forward );
+  }
+  const Halfway& halfway;
+  const bool b_forward;
+}; // r_c_not_halfway
+
+// r_c_joined_path struct
+// a path from s to t made of the path of a forward label, an edge and the 
+// path of a backward label
+template<class Label, class Resource_Container, class Edge>
+struct r_c_joined_path
+{
+  r_c_joined_path( const Label* pf, 
+                   const Label* pb, 
+                   const Edge& ed, 
+                   const Resource_Container& rc ) 
+  : p_forward_label( pf ), 
+    p_backward_label( pb ), 
+    join_edge( ed ), 
+    cumulated_resource_consumption( rc ) 
+  {}
+  const Label* p_forward_label;
+  const Label* p_backward_label;
+  Edge join_edge;
+  Resource_Container cumulated_resource_consumption;
+}; // r_c_joined_path
+
+// r_c_joined_path_less struct
+template<class Joined_Path>
+struct r_c_joined_path_less
+{
+  bool operator()( const Joined_Path& p1, const Joined_Path& p2 ) const
+  {
+    return p1.cumulated_resource_consumption 
+           < p2.cumulated_resource_consumption;
+  }
+}; // r_c_joined_path_less
+
+// r_c_join_body struct
+// joins the forward labels at the source of an edge with the backward 
+// labels at its target; called with the index of the edge and of the 
+// thread
+template<class Graph, 
+         class Forward_Search, 
+         class Backward_Search, 
+         class Join>
+struct r_c_join_body
+{
+  typedef typename Forward_Search::Label Label;
+  typedef typename graph_traits<Graph>::edge_descriptor Edge;
+  typedef 
+    typename Forward_Search::Resource_Container_Type Resource_Container;
+  typedef r_c_joined_path<Label, Resource_Container, Edge> Joined_Path;
+
+  r_c_join_body( const Graph& graph, 
+                 const Forward_Search& fwd, 
+                 const Backward_Search& bwd, 
+                 const std::vector<Edge>& vec_edges, 
+                 const Join& j, 
+                 std::size_t num_threads ) 
+  : g( graph ), 
+    forward( fwd ), 
+    backward( bwd ), 
+    edges( vec_edges ), 
+    join( j ), 
+    vec_joined_paths( num_threads ), 
+    vec_forward_labels( num_threads ), 
+    vec_backward_labels( num_threads ) 
+  {}
+
+  void operator()( std::size_t i, std::size_t thread )
   {
-    for( ; csi != csi_end; ++csi )
+    const Edge ed = edges[i];
+    std::vector<Label*>& forward_labels = vec_forward_labels[thread];
+    std::vector<Label*>& backward_labels = vec_backward_labels[thread];
+    backward.labels_at( target( ed, g ), backward_labels );
+    if( backward_labels.empty() )
+      return;
+    forward.labels_at( source( ed, g ), forward_labels );
+    for( std::size_t f = 0; f < forward_labels.size(); ++f )
     {
-      std::vector<typename graph_traits<Graph>::edge_descriptor> 
-        cur_pareto_optimal_path;
-      const r_c_shortest_paths_label<Graph, Resource_Container>* p_cur_label = 
-        (*csi).get();
-      assert (p_cur_label->b_is_valid);
-      pareto_optimal_resource_containers.
-        push_back( p_cur_label->cumulated_resource_consumption );
-      while( p_cur_label->num != 0 )
+      for( std::size_t b = 0; b < backward_labels.size(); ++b )
       {
-        cur_pareto_optimal_path.push_back( p_cur_label->pred_edge );
-        p_cur_label = p_cur_label->p_pred_label;
-        assert (p_cur_label->b_is_valid);
+        Resource_Container rc = 
+          forward_labels[f]->cumulated_resource_consumption;
+        if( join( g, 
+                  rc, 
+                  forward_labels[f]->cumulated_resource_consumption, 
+                  backward_labels[b]->cumulated_resource_consumption, 
+                  ed ) )
+          vec_joined_paths[thread].push_back
+            ( Joined_Path
+                ( forward_labels[f], backward_labels[b], ed, rc ) );
       }
-      pareto_optimal_solutions.push_back( cur_pareto_optimal_path );
-      if( !b_all_pareto_optimal_solutions )
-        break;
     }
   }
 
-  BGL_FORALL_VERTICES_T(i, g, Graph) {
-    const std::list<Splabel>& list_labels_cur_vertex = vec_vertex_labels[i];
-    csi_end = list_labels_cur_vertex.end();
-    for( csi = list_labels_cur_vertex.begin(); csi != csi_end; ++csi )
-    {
-      assert ((*csi)->b_is_valid);
-      (*csi)->b_is_valid = false;
-      l_alloc.destroy( (*csi).get() );
-      l_alloc.deallocate( (*csi).get(), 1 );
-    }
+  const Graph& g;
+  const Forward_Search& forward;
+  const Backward_Search& backward;
+  const std::vector<Edge>& edges;
+  const Join& join;
+  // per thread
+  std::vector<std::vector<Joined_Path> > vec_joined_paths;
+  std::vector<std::vector<Label*> > vec_forward_labels;
+  std::vector<std::vector<Label*> > vec_backward_labels;
+}; // r_c_join_body
+
+// r_c_shortest_paths_bidirectional_dispatch function 
+// (body/implementation)
+template<class Graph, 
+         class VertexIndexMap, 
+         class EdgeIndexMap, 
+         class Resource_Container, 
+         class Forward_Resource_Extension_Function, 
+         class Backward_Resource_Extension_Function, 
+         class Forward_Dominance_Function, 
+         class Backward_Dominance_Function, 
+         class Halfway_Function, 
+         class Join_Function, 
+         class Label_Allocator, 
+         class Visitor>
+void r_c_shortest_paths_bidirectional_dispatch
+( const Graph& g, 
+  const VertexIndexMap& vertex_index_map, 
+  const EdgeIndexMap& edge_index_map, 
+  typename graph_traits<Graph>::vertex_descriptor s, 
+  typename graph_traits<Graph>::vertex_descriptor t, 
+  std::vector
+    <std::vector
+      <typename graph_traits
+        <Graph>::edge_descriptor> >& pareto_optimal_solutions, 
+  std::vector
+    <Resource_Container>& pareto_optimal_resource_containers, 
+  const Resource_Container& forward_rc, 
+  const Resource_Container& backward_rc, 
+  Forward_Resource_Extension_Function& forward_ref, 
+  Backward_Resource_Extension_Function& backward_ref, 
+  Forward_Dominance_Function& forward_dominance, 
+  Backward_Dominance_Function& backward_dominance, 
+  Halfway_Function& halfway, 
+  Join_Function& join, 
+  Label_Allocator la, 
+  Visitor vis, 
+  std::size_t num_threads )
+{
+  typedef typename graph_traits<Graph>::edge_descriptor Edge;
+  if( s == t )
+  {
+    r_c_shortest_paths_dispatch( g, 
+                                 vertex_index_map, 
+                                 edge_index_map, 
+                                 s, 
+                                 t, 
+                                 pareto_optimal_solutions, 
+                                 pareto_optimal_resource_containers, 
+                                 true, 
+                                 forward_rc, 
+                                 forward_ref, 
+                                 forward_dominance, 
+                                 la, 
+                                 vis, 
+                                 num_threads );
+    return;
   }
-} // r_c_shortest_paths_dispatch
+  pareto_optimal_resource_containers.clear();
+  pareto_optimal_solutions.clear();
+
+  typedef 
+    dominance_keys_of
+      <typename remove_const<Forward_Dominance_Function>::type> 
+        Forward_Keys_Of;
+  typedef 
+    dominance_keys_of
+      <typename remove_const<Backward_Dominance_Function>::type> 
+        Backward_Keys_Of;
+  typedef 
+    label_keys<r_c_shortest_paths_label<Graph, Resource_Container>, 
+               typename Forward_Keys_Of::first_type, 
+               typename Forward_Keys_Of::second_type> Forward_Keys;
+  typedef 
+    label_keys<r_c_shortest_paths_label<Graph, Resource_Container>, 
+               typename Backward_Keys_Of::first_type, 
+               typename Backward_Keys_Of::second_type> Backward_Keys;
+  typedef 
+    r_c_label_setting<Graph, VertexIndexMap, Resource_Container, 
+                      Label_Allocator, Forward_Keys> Forward_Search;
+  typedef 
+    r_c_label_setting<Graph, VertexIndexMap, Resource_Container, 
+                      Label_Allocator, Backward_Keys> Backward_Search;
+  const std::size_t i_threads = resolve_number_of_threads( num_threads );
+
+  // the forward labels from s and the backward labels from t; a label past 
+  // the halfway point is kept but not extended
+  Forward_Search forward( g, 
+                          vertex_index_map, 
+                          Forward_Keys
+                            ( Forward_Keys_Of::first( forward_dominance ), 
+                              Forward_Keys_Of::second( forward_dominance ) ), 
+                          i_threads );
+  forward.start( s, forward_rc );
+  forward.run( r_c_forward_direction<Graph>(), 
+               forward_ref, 
+               forward_dominance, 
+               r_c_not_halfway<Halfway_Function>( halfway, true ), 
+               vis, 
+               false, 
+               t );
+  Backward_Search backward
+    ( g, 
+      vertex_index_map, 
+      Backward_Keys( Backward_Keys_Of::first( backward_dominance ), 
+                     Backward_Keys_Of::second( backward_dominance ) ), 
+      i_threads );
+  backward.start( t, backward_rc );
+  backward.run( r_c_backward_direction<Graph>(), 
+                backward_ref, 
+                backward_dominance, 
+                r_c_not_halfway<Halfway_Function>( halfway, false ), 
+                vis, 
+                false, 
+                s );
+
+  // join the forward and the backward labels across every edge
+  std::vector<Edge> vec_edges;
+  typename graph_traits<Graph>::edge_iterator ei, ei_end;
+  for( boost::tie( ei, ei_end ) = edges( g ); ei != ei_end; ++ei )
+    vec_edges.push_back( *ei );
+  typedef 
+    r_c_join_body<Graph, Forward_Search, Backward_Search, Join_Function> 
+      Join_Body;
+  typedef typename Join_Body::Joined_Path Joined_Path;
+  Join_Body body( g, forward, backward, vec_edges, join, i_threads );
+  parallel_for( vec_edges.size(), body, i_threads );
+
+  // keep the joined paths that no other joined path dominates, in the 
+  // order of their resource consumption
+  std::vector<Joined_Path>& vec_joined_paths = body.vec_joined_paths[0];
+  for( std::size_t i = 1; i < i_threads; ++i )
+    vec_joined_paths.insert( vec_joined_paths.end(), 
+                             body.vec_joined_paths[i].begin(), 
+                             body.vec_joined_paths[i].end() );
+  std::stable_sort( vec_joined_paths.begin(), 
+                    vec_joined_paths.end(), 
+                    r_c_joined_path_less<Joined_Path>() );
+  std::vector<Joined_Path> vec_pareto_optimal_paths;
+  for( std::size_t i = 0; i < vec_joined_paths.size(); ++i )
+  {
+    const Joined_Path& cur_path = vec_joined_paths[i];
+    bool b_dominated = false;
+    for( std::size_t k = 0; 
+         k < vec_pareto_optimal_paths.size() && !b_dominated; 
+         ++k )
+      b_dominated = 
+        forward_dominance
+          ( vec_pareto_optimal_paths[k].cumulated_resource_consumption, 
+            cur_path.cumulated_resource_consumption );
+    if( b_dominated )
+      continue;
+    std::size_t i_kept = 0;
+    for( std::size_t k = 0; k < vec_pareto_optimal_paths.size(); ++k )
+      if( !forward_dominance
+             ( cur_path.cumulated_resource_consumption, 
+               vec_pareto_optimal_paths[k].cumulated_resource_consumption ) )
+        vec_pareto_optimal_paths[i_kept++] = vec_pareto_optimal_paths[k];
+    vec_pareto_optimal_paths.erase
+      ( vec_pareto_optimal_paths.begin() + i_kept, 
+        vec_pareto_optimal_paths.end() );
+    vec_pareto_optimal_paths.push_back( cur_path );
+  }
+
+  // like those of r_c_shortest_paths, the paths list the edges from t 
+  // back to s
+  for( std::size_t i = 0; i < vec_pareto_optimal_paths.size(); ++i )
+  {
+    const Joined_Path& cur_path = vec_pareto_optimal_paths[i];
+    pareto_optimal_resource_containers.
+      push_back( cur_path.cumulated_resource_consumption );
+    pareto_optimal_solutions.push_back( std::vector<Edge>() );
+    std::vector<Edge>& path = pareto_optimal_solutions.back();
+    r_c_label_path( cur_path.p_backward_label, path );
+    std::reverse( path.begin(), path.end() );
+    path.push_back( cur_path.join_edge );
+    r_c_label_path( cur_path.p_forward_label, path );
+  }
+} // r_c_shortest_paths_bidirectional_dispatch
 
 } // detail
 
@@ -512,7 +1365,7 @@ struct default_r_c_shortest_paths_visitor
 
 // default_r_c_shortest_paths_allocator
 typedef 
-  std::allocator<int> default_r_c_shortest_paths_allocator;
+  r_c_shortest_paths_pool_allocator<int> default_r_c_shortest_paths_allocator;
 // default_r_c_shortest_paths_allocator
 
 
@@ -545,7 +1398,8 @@ void r_c_shortest_paths
   const Dominance_Function& dominance, 
   // to specify the memory management strategy for the labels
   Label_Allocator la, 
-  Visitor vis )
+  Visitor vis, 
+  std::size_t num_threads = 1 )
 {
   r_c_shortest_paths_dispatch( g, 
                                vertex_index_map, 
@@ -559,7 +1413,8 @@ void r_c_shortest_paths
                                ref, 
                                dominance, 
                                la, 
-                               vis );
+                               vis, 
+                               num_threads );
 }
 
 // second overload:
@@ -589,7 +1444,8 @@ void r_c_shortest_paths
   const Dominance_Function& dominance, 
   // to specify the memory management strategy for the labels
   Label_Allocator la, 
-  Visitor vis )
+  Visitor vis, 
+  std::size_t num_threads = 1 )
 {
   // each inner vector corresponds to a pareto-optimal path
   std::vector<std::vector<typename graph_traits<Graph>::edge_descriptor> > 
@@ -607,7 +1463,8 @@ void r_c_shortest_paths
                                ref, 
                                dominance, 
                                la, 
-                               vis );
+                               vis, 
+                               num_threads );
   if (!pareto_optimal_solutions.empty()) {
     pareto_optimal_solution = pareto_optimal_solutions[0];
     pareto_optimal_resource_container = pareto_optimal_resource_containers[0];
@@ -651,7 +1508,8 @@ void r_c_shortest_paths
                                ref, 
                                dominance, 
                                default_r_c_shortest_paths_allocator(), 
-                               default_r_c_shortest_paths_visitor() );
+                               default_r_c_shortest_paths_visitor(), 
+                               1 );
 }
 
 // fourth overload:
@@ -694,7 +1552,8 @@ void r_c_shortest_paths
                                ref, 
                                dominance, 
                                default_r_c_shortest_paths_allocator(), 
-                               default_r_c_shortest_paths_visitor() );
+                               default_r_c_shortest_paths_visitor(), 
+                               1 );
   if (!pareto_optimal_solutions.empty()) {
     pareto_optimal_solution = pareto_optimal_solutions[0];
     pareto_optimal_resource_container = pareto_optimal_resource_containers[0];
@@ -703,6 +1562,127 @@ void r_c_shortest_paths
 // r_c_shortest_paths
 
 
+// r_c_shortest_paths_bidirectional functions (handle/interface)
+// first overload:
+// - specify Label_Allocator and Visitor arguments
+template<class Graph, 
+         class VertexIndexMap, 
+         class EdgeIndexMap, 
+         class Resource_Container, 
+         class Forward_Resource_Extension_Function, 
+         class Backward_Resource_Extension_Function, 
+         class Forward_Dominance_Function, 
+         class Backward_Dominance_Function, 
+         class Halfway_Function, 
+         class Join_Function, 
+         class Label_Allocator, 
+         class Visitor>
+void r_c_shortest_paths_bidirectional
+( const Graph& g, 
+  const VertexIndexMap& vertex_index_map, 
+  const EdgeIndexMap& edge_index_map, 
+  typename graph_traits<Graph>::vertex_descriptor s, 
+  typename graph_traits<Graph>::vertex_descriptor t, 
+  // each inner vector corresponds to a pareto-optimal path
+  std::vector<std::vector<typename graph_traits<Graph>::edge_descriptor> >& 
+    pareto_optimal_solutions, 
+  std::vector<Resource_Container>& pareto_optimal_resource_containers, 
+  // to initialize the first forward label at s and the first backward 
+  // label at t
+  const Resource_Container& forward_rc, 
+  const Resource_Container& backward_rc, 
+  const Forward_Resource_Extension_Function& forward_ref, 
+  const Backward_Resource_Extension_Function& backward_ref, 
+  const Forward_Dominance_Function& forward_dominance, 
+  const Backward_Dominance_Function& backward_dominance, 
+  // whether a forward or backward label is past the halfway point
+  const Halfway_Function& halfway, 
+  // to join a forward and a backward label across an edge
+  const Join_Function& join, 
+  // to specify the memory management strategy for the labels
+  Label_Allocator la, 
+  Visitor vis, 
+  std::size_t num_threads = 1 )
+{
+  r_c_shortest_paths_bidirectional_dispatch
+    ( g, 
+      vertex_index_map, 
+      edge_index_map, 
+      s, 
+      t, 
+      pareto_optimal_solutions, 
+      pareto_optimal_resource_containers, 
+      forward_rc, 
+      backward_rc, 
+      forward_ref, 
+      backward_ref, 
+      forward_dominance, 
+      backward_dominance, 
+      halfway, 
+      join, 
+      la, 
+      vis, 
+      num_threads );
+}
+
+// second overload:
+// - use default Label_Allocator and Visitor
+template<class Graph, 
+         class VertexIndexMap, 
+         class EdgeIndexMap, 
+         class Resource_Container, 
+         class Forward_Resource_Extension_Function, 
+         class Backward_Resource_Extension_Function, 
+         class Forward_Dominance_Function, 
+         class Backward_Dominance_Function, 
+         class Halfway_Function, 
+         class Join_Function>
+void r_c_shortest_paths_bidirectional
+( const Graph& g, 
+  const VertexIndexMap& vertex_index_map, 
+  const EdgeIndexMap& edge_index_map, 
+  typename graph_traits<Graph>::vertex_descriptor s, 
+  typename graph_traits<Graph>::vertex_descriptor t, 
+  // each inner vector corresponds to a pareto-optimal path
+  std::vector<std::vector<typename graph_traits<Graph>::edge_descriptor> >& 
+    pareto_optimal_solutions, 
+  std::vector<Resource_Container>& pareto_optimal_resource_containers, 
+  // to initialize the first forward label at s and the first backward 
+  // label at t
+  const Resource_Container& forward_rc, 
+  const Resource_Container& backward_rc, 
+  const Forward_Resource_Extension_Function& forward_ref, 
+  const Backward_Resource_Extension_Function& backward_ref, 
+  const Forward_Dominance_Function& forward_dominance, 
+  const Backward_Dominance_Function& backward_dominance, 
+  // whether a forward or backward label is past the halfway point
+  const Halfway_Function& halfway, 
+  // to join a forward and a backward label across an edge
+  const Join_Function& join )
+{
+  r_c_shortest_paths_bidirectional_dispatch
+    ( g, 
+      vertex_index_map, 
+      edge_index_map, 
+      s, 
+      t, 
+      pareto_optimal_solutions, 
+      pareto_optimal_resource_containers, 
+      forward_rc, 
+      backward_rc, 
+      forward_ref, 
+      backward_ref, 
+      forward_dominance, 
+      backward_dominance, 
+      halfway, 
+      join, 
+      default_r_c_shortest_paths_allocator(), 
+      default_r_c_shortest_paths_visitor(), 
+      1 );
+}
+// r_c_shortest_paths_bidirectional
+
+
 // check_r_c_path function
 template<class Graph, 
          class Resource_Container, 
@@ -0,0 +1,386 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_REACHABILITY_INDEX_HPP
+#define BOOST_GRAPH_REACHABILITY_INDEX_HPP
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <climits>
+#include <boost/config.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/strong_components.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/concept/assert.hpp>
+
+namespace boost {
+
+  // Reachability queries without a transitive closure
+  //
+  // Both classes below answer reachable(u, v) for a directed graph that
+  // does not change afterwards.  The graph is first collapsed into its
+  // strongly connected components, so u and v in the same component
+  // always reach each other, and all the work is done on the acyclic
+  // condensation.
+  //
+  // reachability_index stores k randomized interval labels per component
+  // (GRAIL, Yildirim, Chaoji and Zaki, "GRAIL: Scalable Reachability
+  // Index for Large Graphs", VLDB 2010), i.e. O(k (V + E)) space.  An
+  // interval that is not nested in the source's interval proves that the
+  // target cannot be reached, which answers most negative queries in O(k);
+  // the rest are settled by a depth-first search that the same test
+  // prunes.  The k labelings are built in parallel.
+  //
+  // reachability_closure stores one bit per pair of components and
+  // answers every query in O(1).  It is meant for small or dense DAGs where
+  // C^2 bits are affordable; it is built level by level in parallel.
+
+  namespace detail {
+
+    // The condensation of a graph as a compressed adjacency structure,
+    // with a topological position for each component.
+    struct reachability_condensation
+    {
+      typedef std::size_t size_type;
+
+      template <typename Graph, typename VertexIndexMap>
+      void build(const Graph& g, VertexIndexMap index)
+      {
+        BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+        BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+        typedef typename graph_traits<Graph>::vertex_iterator VIter;
+        typedef typename graph_traits<Graph>::out_edge_iterator EIter;
+
+        component.assign(num_vertices(g), 0);
+        num_components = strong_components
+          (g, make_iterator_property_map(component.begin(), index),
+           vertex_index_map(index));
+
+        std::vector<std::pair<size_type, size_type> > arcs;
+        VIter vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+          size_type a = component[get(index, *vi)];
+          EIter ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei) {
+            size_type b = component[get(index, target(*ei, g))];
+            if (a != b)
+              arcs.push_back(std::make_pair(a, b));
+          }
+        }
+        std::sort(arcs.begin(), arcs.end());
+        arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+        offset.assign(num_components + 1, 0);
+        adjacent.resize(arcs.size());
+        std::vector<size_type> in_degree(num_components, 0);
+        for (size_type i = 0; i < arcs.size(); ++i) {
+          ++offset[arcs[i].first + 1];
+          ++in_degree[arcs[i].second];
+          adjacent[i] = arcs[i].second;
+        }
+        for (size_type c = 0; c < num_components; ++c)
+          offset[c + 1] += offset[c];
+
+        // Kahn's algorithm, remembering the sources for the labelings.
+        order.clear();
+        order.reserve(num_components);
+        for (size_type c = 0; c < num_components; ++c)
+          if (in_degree[c] == 0)
+            order.push_back(c);
+        roots.assign(order.begin(), order.end());
+        for (size_type i = 0; i < order.size(); ++i)
+          for (size_type j = offset[order[i]]; j < offset[order[i] + 1]; ++j)
+            if (--in_degree[adjacent[j]] == 0)
+              order.push_back(adjacent[j]);
+        position.resize(num_components);
+        for (size_type i = 0; i < num_components; ++i)
+          position[order[i]] = i;
+      }
+
+      size_type num_components;
+      std::vector<size_type> component;   // vertex index -> component
+      std::vector<size_type> offset;      // component -> first arc
+      std::vector<size_type> adjacent;    // arc -> target component
+      std::vector<size_type> order;       // topological order
+      std::vector<size_type> position;    // component -> place in order
+      std::vector<size_type> roots;       // components without in-arcs
+    };
+
+    struct reachability_interval
+    {
+      std::size_t low, post;
+    };
+
+    // Computes one randomized post-order interval labeling.
+    template <typename Labels>
+    struct grail_labeling_body
+    {
+      typedef std::size_t size_type;
+
+      grail_labeling_body(const reachability_condensation& c, Labels& labels,
+                          size_type k)
+        : c(c), labels(labels), k(k) { }
+
+      void operator()(size_type i, size_type) const
+      {
+        const size_type n = c.num_components;
+        minstd_rand gen(static_cast<minstd_rand::result_type>(2 * i + 1));
+        std::vector<size_type> roots(c.roots);
+        if (i != 0)
+          for (size_type j = roots.size(); j > 1; --j)
+            std::swap(roots[j - 1], roots[gen() % j]);
+
+        std::vector<char> visited(n, false);
+        std::vector<size_type> rotate(n, 0);
+        std::vector<std::pair<size_type, size_type> > stack;
+        size_type rank = 0;
+        for (size_type r = 0; r < roots.size(); ++r) {
+          visited[roots[r]] = true;
+          stack.push_back(std::make_pair(roots[r], size_type(0)));
+          while (!stack.empty()) {
+            size_type u = stack.back().first;
+            size_type first = c.offset[u], degree = c.offset[u + 1] - first;
+            if (stack.back().second == 0 && i != 0 && degree > 1)
+              rotate[u] = gen() % degree;
+            if (stack.back().second < degree) {
+              size_type v = c.adjacent[first + (stack.back().second++
+                                                + rotate[u]) % degree];
+              if (!visited[v]) {
+                visited[v] = true;
+                stack.push_back(std::make_pair(v, size_type(0)));
+              }
+              continue;
+            }
+            reachability_interval& l = labels[u * k + i];
+            l.low = rank;
+            for (size_type j = first; j < c.offset[u + 1]; ++j)
+              l.low = (std::min)(l.low, labels[c.adjacent[j] * k + i].low);
+            l.post = rank++;
+            stack.pop_back();
+          }
+        }
+      }
+
+      const reachability_condensation& c;
+      Labels& labels;
+      size_type k;
+    };
+
+    // ORs the rows of the successors into the row of each component of
+    // one level; the successors all belong to earlier levels.
+    struct closure_level_body
+    {
+      typedef std::size_t size_type;
+
+      closure_level_body(const reachability_condensation& c,
+                         const std::vector<size_type>& level,
+                         std::vector<size_type>& bits, size_type words)
+        : c(c), level(level), bits(bits), words(words) { }
+
+      void operator()(size_type i, size_type) const
+      {
+        size_type u = level[i];
+        size_type* row = &bits[u * words];
+        row[u / word_bits] |= size_type(1) << (u % word_bits);
+        for (size_type j = c.offset[u]; j < c.offset[u + 1]; ++j) {
+          const size_type* succ = &bits[c.adjacent[j] * words];
+          for (size_type w = 0; w < words; ++w)
+            row[w] |= succ[w];
+        }
+      }
+
+      BOOST_STATIC_CONSTANT(size_type, word_bits = sizeof(size_type) * CHAR_BIT);
+
+      const reachability_condensation& c;
+      const std::vector<size_type>& level;
+      std::vector<size_type>& bits;
+      size_type words;
+    };
+
+  } // namespace detail
+
+  template <typename Graph,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class reachability_index
+  {
+  public:
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef std::size_t size_type;
+
+    // Scratch space for the searches that the labels cannot settle.  Give
+    // each thread its own to run queries concurrently.
+    class workspace
+    {
+    public:
+      workspace() : m_stamp(0) { }
+    private:
+      friend class reachability_index;
+      std::vector<unsigned> m_seen;
+      std::vector<size_type> m_stack;
+      unsigned m_stamp;
+    };
+
+    explicit reachability_index(const Graph& g, size_type num_labels = 3,
+                                size_type num_threads = 1)
+      : m_index(get(vertex_index, g))
+      { build(g, num_labels, num_threads); }
+
+    reachability_index(const Graph& g, VertexIndexMap index,
+                       size_type num_labels = 3, size_type num_threads = 1)
+      : m_index(index)
+      { build(g, num_labels, num_threads); }
+
+    // Not safe to call from several threads; use the overload taking a
+    // workspace for that.
+    bool reachable(vertex_descriptor u, vertex_descriptor v) const
+      { return reachable(u, v, m_workspace); }
+
+    bool reachable(vertex_descriptor u, vertex_descriptor v,
+                   workspace& ws) const
+    {
+      size_type a = component(u), b = component(v);
+      if (a == b)
+        return true;
+      if (!may_reach(a, b))
+        return false;
+
+      if (ws.m_seen.size() != m_c.num_components || ++ws.m_stamp == 0) {
+        ws.m_seen.assign(m_c.num_components, 0);
+        ws.m_stamp = 1;
+      }
+      ws.m_stack.clear();
+      ws.m_stack.push_back(a);
+      ws.m_seen[a] = ws.m_stamp;
+      while (!ws.m_stack.empty()) {
+        size_type x = ws.m_stack.back();
+        ws.m_stack.pop_back();
+        for (size_type j = m_c.offset[x]; j < m_c.offset[x + 1]; ++j) {
+          size_type y = m_c.adjacent[j];
+          if (y == b)
+            return true;
+          if (ws.m_seen[y] != ws.m_stamp && may_reach(y, b)) {
+            ws.m_seen[y] = ws.m_stamp;
+            ws.m_stack.push_back(y);
+          }
+        }
+      }
+      return false;
+    }
+
+    size_type component(vertex_descriptor v) const
+      { return m_c.component[get(m_index, v)]; }
+
+    size_type num_components() const { return m_c.num_components; }
+
+  private:
+    void build(const Graph& g, size_type num_labels, size_type num_threads)
+    {
+      m_c.build(g, m_index);
+      m_k = (std::max)(num_labels, size_type(1));
+      m_labels.resize(m_c.num_components * m_k);
+      detail::grail_labeling_body<std::vector<detail::reachability_interval> >
+        body(m_c, m_labels, m_k);
+      detail::parallel_for(m_k, body,
+                           detail::resolve_number_of_threads(num_threads));
+    }
+
+    // False if b is certainly not reachable from a.
+    bool may_reach(size_type a, size_type b) const
+    {
+      if (m_c.position[a] >= m_c.position[b])
+        return false;
+      const detail::reachability_interval* la = &m_labels[a * m_k];
+      const detail::reachability_interval* lb = &m_labels[b * m_k];
+      for (size_type i = 0; i < m_k; ++i)
+        if (lb[i].low < la[i].low || lb[i].post > la[i].post)
+          return false;
+      return true;
+    }
+
+    VertexIndexMap m_index;
+    detail::reachability_condensation m_c;
+    size_type m_k;
+    std::vector<detail::reachability_interval> m_labels;
+    mutable workspace m_workspace;
+  };
+
+  template <typename Graph,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class reachability_closure
+  {
+  public:
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef std::size_t size_type;
+
+    explicit reachability_closure(const Graph& g, size_type num_threads = 1)
+      : m_index(get(vertex_index, g))
+      { build(g, num_threads); }
+
+    reachability_closure(const Graph& g, VertexIndexMap index,
+                         size_type num_threads = 1)
+      : m_index(index)
+      { build(g, num_threads); }
+
+    bool reachable(vertex_descriptor u, vertex_descriptor v) const
+    {
+      size_type a = component(u), b = component(v);
+      return (m_bits[a * m_words + b / word_bits] >> (b % word_bits)) & 1;
+    }
+
+    size_type component(vertex_descriptor v) const
+      { return m_c.component[get(m_index, v)]; }
+
+    size_type num_components() const { return m_c.num_components; }
+
+  private:
+    BOOST_STATIC_CONSTANT(size_type, word_bits = sizeof(size_type) * CHAR_BIT);
+
+    void build(const Graph& g, size_type num_threads)
+    {
+      m_c.build(g, m_index);
+      const size_type n = m_c.num_components;
+      m_words = (n + word_bits - 1) / word_bits;
+      m_bits.assign(n * m_words, 0);
+
+      // Group the components by height above the sinks.
+      std::vector<size_type> height(n, 0);
+      size_type levels = n == 0 ? 0 : 1;
+      for (size_type i = n; i-- > 0; ) {
+        size_type u = m_c.order[i];
+        for (size_type j = m_c.offset[u]; j < m_c.offset[u + 1]; ++j)
+          height[u] = (std::max)(height[u], height[m_c.adjacent[j]] + 1);
+        levels = (std::max)(levels, height[u] + 1);
+      }
+      std::vector<std::vector<size_type> > by_height(levels);
+      for (size_type u = 0; u < n; ++u)
+        by_height[height[u]].push_back(u);
+
+      num_threads = detail::resolve_number_of_threads(num_threads);
+      for (size_type h = 0; h < levels; ++h) {
+        detail::closure_level_body body(m_c, by_height[h], m_bits, m_words);
+        detail::parallel_for(by_height[h].size(), body, num_threads, 16);
+      }
+    }
+
+    VertexIndexMap m_index;
+    detail::reachability_condensation m_c;
+    size_type m_words;
+    std::vector<size_type> m_bits;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_REACHABILITY_INDEX_HPP
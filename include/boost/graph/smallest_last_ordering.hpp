@@ -31,6 +31,7 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/pending/bucket_sorter.hpp>
+#include <boost/property_map/shared_array_property_map.hpp>
 
 namespace boost {
 
@@ -48,7 +49,15 @@ namespace boost {
     typedef typename boost::property_map<VertexListGraph, vertex_index_t>::type ID;
     typedef bucket_sorter<size_type, Vertex, Degree, ID> BucketSorter;
     
-    BucketSorter degree_bucket_sorter(num, num, degree,  
+    // one bucket per degree; parallel edges and self-loops can make
+    // degrees exceed num - 1
+    size_type max_degree = 0;
+    typename GraphTraits::vertex_iterator v, vend;
+    for (boost::tie(v, vend) = vertices(G); v != vend; ++v)
+      if (out_degree(*v, G) > max_degree)
+        max_degree = out_degree(*v, G);
+
+    BucketSorter degree_bucket_sorter(num, max_degree + 1, degree,  
                                       get(vertex_index,G));
 
     smallest_last_vertex_ordering(G, order, degree, marker, degree_bucket_sorter);
@@ -74,6 +83,9 @@ namespace boost {
       degree_buckets.push(*v);
     }
  
+    if (num == 0)
+      return;
+
     size_type minimum_degree = 0;
     size_type current_order = num - 1;
     
@@ -200,6 +200,26 @@ namespace boost {
 
 namespace graph {
   namespace detail {
+    template <class UndirectedGraph, class WeightMap, class ParityMap, class VertexAssignmentMap, class IndexMap>
+    struct stoer_wagner_with_queue {
+      typedef typename boost::property_traits<WeightMap>::value_type weight_type;
+
+      stoer_wagner_with_queue(const UndirectedGraph& g, WeightMap weights, ParityMap parities, VertexAssignmentMap assignments, IndexMap index_map, weight_type& result)
+        : g(g), weights(weights), parities(parities), assignments(assignments), index_map(index_map), result(result) {}
+
+      template <typename KeyedUpdatablePriorityQueue>
+      void operator()(KeyedUpdatablePriorityQueue& pq) const {
+        result = boost::stoer_wagner_min_cut(g, weights, parities, assignments, pq, index_map);
+      }
+
+      const UndirectedGraph& g;
+      WeightMap weights;
+      ParityMap parities;
+      VertexAssignmentMap assignments;
+      IndexMap index_map;
+      weight_type& result;
+    };
+
     template <class UndirectedGraph, class WeightMap>
     struct stoer_wagner_min_cut_impl {
       typedef typename boost::property_traits<WeightMap>::value_type result_type;
@@ -207,21 +227,21 @@ namespace graph {
       result_type operator() (const UndirectedGraph& g, WeightMap weights, const ArgPack& arg_pack) const {
         using namespace boost::graph::keywords;
         typedef typename boost::graph_traits<UndirectedGraph>::vertex_descriptor vertex_descriptor;
-        typedef typename boost::property_traits<WeightMap>::value_type weight_type;
-
-        typedef boost::detail::make_priority_queue_from_arg_pack_gen<boost::graph::keywords::tag::max_priority_queue, weight_type, vertex_descriptor, std::greater<weight_type> > gen_type;
-
-        gen_type gen(choose_param(get_param(arg_pack, boost::distance_zero_t()), weight_type(0)));
-
-        typename boost::result_of<gen_type(const UndirectedGraph&, const ArgPack&)>::type pq = gen(g, arg_pack);
-
-        return boost::stoer_wagner_min_cut(g,
-          weights,
-          arg_pack [_parity_map | boost::dummy_property_map()],
-          boost::detail::make_property_map_from_arg_pack_gen<tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, arg_pack),
-          pq,
-          boost::detail::override_const_property(arg_pack, _vertex_index_map, g, vertex_index)
-        );
+        typedef typename boost::remove_const<typename boost::parameter::value_type<ArgPack, tag::parity_map, boost::dummy_property_map>::type>::type parity_map;
+        typedef typename boost::detail::map_maker<UndirectedGraph, ArgPack, tag::vertex_assignment_map, vertex_descriptor>::map_type assignment_map;
+        typedef typename boost::detail::override_const_property_result<ArgPack, tag::vertex_index_map, vertex_index_t, UndirectedGraph>::type index_map;
+
+        // The queue is chosen as for maximum_adjacency_search, so integral
+        // weights get a bucket queue unless one is passed explicitly.
+        result_type result;
+        with_mas_queue(g, weights, arg_pack,
+          stoer_wagner_with_queue<UndirectedGraph, WeightMap, parity_map, assignment_map, index_map>(g,
+            weights,
+            arg_pack [_parity_map | boost::dummy_property_map()],
+            boost::detail::make_property_map_from_arg_pack_gen<tag::vertex_assignment_map, vertex_descriptor>(vertex_descriptor())(g, arg_pack),
+            boost::detail::override_const_property(arg_pack, _vertex_index_map, g, vertex_index),
+            result));
+        return result;
       }
     };
   }
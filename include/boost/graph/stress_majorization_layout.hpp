@@ -0,0 +1,547 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_STRESS_MAJORIZATION_LAYOUT_HPP
+#define BOOST_GRAPH_STRESS_MAJORIZATION_LAYOUT_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/kamada_kawai_spring_layout.hpp> // for edge_length,
+                                                     // side_length and
+                                                     // layout_tolerance
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/limits.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace boost {
+
+namespace detail {
+
+  // The term of the sparse stress that ties a vertex to a pivot: the
+  // distance to keep and its weight.  Floats halve the memory, which is
+  // the number of pivots times the number of vertices.
+  struct stress_pivot_term
+  {
+    float distance;
+    float weight;
+  };
+
+  template<typename T>
+  double stress_edge_length(graph::edge_or_side<true, T> length, double)
+  { return double(length.value); }
+
+  template<typename T>
+  double stress_edge_length(graph::edge_or_side<false, T> length,
+                            double diameter)
+  { return diameter > 0. ? double(length.value) / diameter
+                         : double(length.value); }
+
+  // Weighs the term of vertex i and pivot p by the number of vertices
+  // nearest to p that are at most half as far from p as i is, so that
+  // the pivot stands for the vertices of its region that lie beyond it.
+  struct stress_pivot_weights_body
+  {
+    stress_pivot_weights_body(std::vector<stress_pivot_term>& terms,
+                              const std::vector<std::vector<double> >& region,
+                              double length)
+      : terms(terms), region(region), length(length) { }
+
+    void operator()(std::size_t i, std::size_t)
+    {
+      const std::size_t k = region.size();
+      for (std::size_t p = 0; p < k; ++p) {
+        stress_pivot_term& term = terms[i * k + p];
+        double d = term.distance;
+        std::size_t count =
+          std::upper_bound(region[p].begin(), region[p].end(), d / 2)
+          - region[p].begin();
+        d *= length;
+        term.distance = float(d);
+        term.weight = d > 0. ? float(count / (d * d)) : 0.f;
+      }
+    }
+
+    std::vector<stress_pivot_term>& terms;
+    const std::vector<std::vector<double> >& region;
+    double length;
+  };
+
+  // The pivot MDS of Brandes and Pich.  c(i, p) is the double-centered
+  // square distance of vertex i and pivot p.
+  template<std::size_t Dims>
+  struct pivot_mds_body
+  {
+    pivot_mds_body(const std::vector<stress_pivot_term>& terms,
+                   std::size_t k, const std::vector<double>& column_mean,
+                   double mean, std::vector<double>& coords)
+      : terms(terms), k(k), column_mean(column_mean), mean(mean),
+        coords(coords), chunk(4096), row(1), products(0), vectors(0) { }
+
+    std::size_t chunks() const
+    { return (coords.size() / Dims + chunk - 1) / chunk; }
+
+    // The entries of c for vertex i, into c.
+    void centered(std::size_t i, double* c) const
+    {
+      double row_mean = 0.;
+      for (std::size_t p = 0; p < k; ++p) {
+        double d = terms[i * k + p].distance;
+        c[p] = d * d;
+        row_mean += c[p];
+      }
+      row_mean /= double(k);
+      for (std::size_t p = 0; p < k; ++p)
+        c[p] = -0.5 * (c[p] - row_mean - column_mean[p] + mean);
+    }
+
+    // First, the products c^T c summed over each chunk of vertices, so
+    // that the sum does not depend on the threads; then the coordinates.
+    void operator()(std::size_t i, std::size_t t)
+    {
+      std::vector<double>& c = row[t];
+      c.resize(k);
+      if (products) {
+        double* b = &(*products)[i * k * k];
+        const std::size_t n = coords.size() / Dims;
+        for (std::size_t v = i * chunk; v < (std::min)(n, (i + 1) * chunk);
+             ++v) {
+          centered(v, &c[0]);
+          for (std::size_t p = 0; p < k; ++p)
+            for (std::size_t q = p; q < k; ++q)
+              b[p * k + q] += c[p] * c[q];
+        }
+        return;
+      }
+      centered(i, &c[0]);
+      for (std::size_t d = 0; d < Dims; ++d) {
+        double x = 0.;
+        for (std::size_t p = 0; p < k; ++p)
+          x += c[p] * (*vectors)[d * k + p];
+        coords[i * Dims + d] = x;
+      }
+    }
+
+    const std::vector<stress_pivot_term>& terms;
+    std::size_t k;
+    const std::vector<double>& column_mean;
+    double mean;
+    std::vector<double>& coords;
+    std::size_t chunk;
+    std::vector<std::vector<double> > row;
+    std::vector<double>* products;
+    const std::vector<double>* vectors;
+  };
+
+  // The eigenvectors of the dims largest eigenvalues of the symmetric
+  // k x k matrix b, one after the other in vectors, by power iteration
+  // against the eigenvectors already found.
+  inline void
+  pivot_mds_eigenvectors(const std::vector<double>& b, std::size_t k,
+                         std::size_t dims, std::vector<double>& vectors)
+  {
+    vectors.assign(dims * k, 0.);
+    std::vector<double> next(k);
+    for (std::size_t d = 0; d < dims; ++d) {
+      double* v = &vectors[d * k];
+      for (std::size_t p = 0; p < k; ++p)
+        v[p] = double((p * 7919 + d * 104729) % 1000) / 1000. - 0.5;
+      for (int iteration = 0; iteration < 1000; ++iteration) {
+        for (std::size_t e = 0; e < d; ++e) {
+          const double* u = &vectors[e * k];
+          double dot = 0.;
+          for (std::size_t p = 0; p < k; ++p)
+            dot += u[p] * v[p];
+          for (std::size_t p = 0; p < k; ++p)
+            v[p] -= dot * u[p];
+        }
+        double norm = 0.;
+        for (std::size_t p = 0; p < k; ++p)
+          norm += v[p] * v[p];
+        norm = std::sqrt(norm);
+        if (norm == 0.)
+          break;
+        for (std::size_t p = 0; p < k; ++p)
+          v[p] /= norm;
+        if (iteration > 0) {
+          double change = 0.;
+          for (std::size_t p = 0; p < k; ++p)
+            change += (v[p] - next[p]) * (v[p] - next[p]);
+          if (change < 1e-20)
+            break;
+        }
+        std::copy(v, v + k, next.begin());
+        for (std::size_t p = 0; p < k; ++p) {
+          double x = 0.;
+          for (std::size_t q = 0; q < k; ++q)
+            x += b[p * k + q] * next[q];
+          v[p] = x;
+        }
+      }
+    }
+  }
+
+  // One step of stress majorization for vertex i: the position that
+  // minimizes the majorant of its stress with the other vertices fixed,
+  // from the positions old, into positions.  All vertices move at once,
+  // so the result does not depend on the threads.  With scale set, sums
+  // instead what the best scaling of the layout takes.
+  template<typename Graph, typename WeightMap, typename VertexIndexMap,
+           std::size_t Dims>
+  struct stress_majorization_body
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+
+    stress_majorization_body
+      (const Graph& g, WeightMap weight, VertexIndexMap index,
+       const std::vector<vertex_descriptor>& verts,
+       const std::vector<std::size_t>& pivots,
+       const std::vector<stress_pivot_term>& terms, double length,
+       std::vector<double>& old, std::vector<double>& positions,
+       std::vector<double>& stress, std::vector<double>& scale_sum)
+      : g(g), weight(weight), index(index), verts(verts), pivots(pivots),
+        terms(terms), length(length), old(&old), positions(&positions),
+        stress(stress), scale_sum(scale_sum), scale(false) { }
+
+    // The sums of the stress terms of one vertex.
+    struct sums
+    {
+      double num[Dims < 2 ? 2 : Dims], den, stress;
+    };
+
+    void add(std::size_t i, std::size_t j, double d, double w, sums& s) const
+    {
+      const double* x = &(*old)[i * Dims];
+      const double* y = &(*old)[j * Dims];
+      double dist = 0.;
+      for (std::size_t c = 0; c < Dims; ++c)
+        dist += (x[c] - y[c]) * (x[c] - y[c]);
+      dist = std::sqrt(dist);
+      s.stress += w * (dist - d) * (dist - d);
+      s.den += w;
+      if (scale) {
+        s.num[0] += w * d * dist;
+        s.num[1] += w * dist * dist;
+        return;
+      }
+      for (std::size_t c = 0; c < Dims; ++c)
+        s.num[c] += w * (y[c] + (dist > 0. ? d * (x[c] - y[c]) / dist : 0.));
+    }
+
+    void operator()(std::size_t i, std::size_t)
+    {
+      sums s;
+      s.den = s.stress = 0.;
+      for (std::size_t c = 0; c < (Dims < 2 ? 2 : Dims); ++c)
+        s.num[c] = 0.;
+      BGL_FORALL_OUTEDGES_T(verts[i], e, g, Graph) {
+        std::size_t j = get(index, target(e, g));
+        double d = length * double(get(weight, e));
+        if (j != i && d > 0.)
+          add(i, j, d, 1. / (d * d), s);
+      }
+      const std::size_t k = pivots.size();
+      for (std::size_t p = 0; p < k; ++p) {
+        const stress_pivot_term& term = terms[i * k + p];
+        if (pivots[p] != i && term.weight > 0.f)
+          add(i, pivots[p], term.distance, term.weight, s);
+      }
+
+      stress[i] = s.stress;
+      if (scale) {
+        scale_sum[2 * i] = s.num[0];
+        scale_sum[2 * i + 1] = s.num[1];
+        return;
+      }
+      for (std::size_t c = 0; c < Dims; ++c)
+        (*positions)[i * Dims + c] =
+          s.den > 0. ? s.num[c] / s.den : (*old)[i * Dims + c];
+    }
+
+    const Graph& g;
+    WeightMap weight;
+    VertexIndexMap index;
+    const std::vector<vertex_descriptor>& verts;
+    const std::vector<std::size_t>& pivots;
+    const std::vector<stress_pivot_term>& terms;
+    double length;
+    std::vector<double>* old;
+    std::vector<double>* positions;
+    std::vector<double>& stress;
+    std::vector<double>& scale_sum;
+    bool scale;
+  };
+
+  // Stops the stress majorization layout after this many iterations.
+  inline std::size_t stress_majorization_max_iterations() { return 500; }
+
+} // end namespace detail
+
+/** \brief Sparse stress majorization layout for undirected graphs.
+ *
+ * Lays out a connected, undirected graph so that the distance between
+ * any two vertices in the layout approaches their shortest distance in
+ * the graph, like kamada_kawai_spring_layout(), but without the matrix
+ * of all distances.  The sparse stress model of Ortmann, Klimenta and
+ * Brandes keeps the terms of the edges and those between each vertex and
+ * num_pivots pivots, found one after the other by Dijkstra's algorithm
+ * from the vertex farthest from the pivots so far.  The pivot term of a
+ * vertex is weighted by the number of vertices of the pivot's region
+ * that it stands for.  The layout starts from the pivot MDS of Brandes
+ * and Pich, ignoring the positions in @p position, and every iteration
+ * moves all vertices at once, on num_threads threads (0 means one per
+ * hardware thread); the layout does not depend on the number of
+ * threads.
+ *
+ * \param edge_or_side_length is either @c boost::edge_length(e), the
+ * length of an edge of unit weight, or @c boost::side_length(s), the
+ * length that the largest distance from a pivot is given.
+ *
+ * \param done is called after each iteration with the sparse stress of
+ * the layout before it, the vertex with the largest share of it, the
+ * graph and @c true, as the @c done parameter of
+ * kamada_kawai_spring_layout() with the global energy.  The layout also
+ * stops after 500 iterations.
+ *
+ * \param num_pivots is the number of pivots, at most the number of
+ * vertices.  The time and the memory are proportional to it.
+ *
+ * The layout is centered on @c topology.center().
+ *
+ * \returns @c true, or @c false, leaving @p position as it was, if the
+ * graph is not connected.
+ */
+template<typename Topology, typename Graph, typename PositionMap,
+         typename WeightMap, typename T, bool EdgeOrSideLength,
+         typename Done, typename VertexIndexMap>
+bool
+stress_majorization_layout
+  (const Graph& g,
+   PositionMap position,
+   WeightMap weight,
+   const Topology& topology,
+   detail::graph::edge_or_side<EdgeOrSideLength, T> edge_or_side_length,
+   Done done,
+   std::size_t num_pivots,
+   VertexIndexMap index,
+   std::size_t num_threads)
+{
+  BOOST_STATIC_ASSERT((is_convertible<
+                         typename graph_traits<Graph>::directed_category*,
+                         undirected_tag*
+                       >::value));
+  typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+  typedef typename property_traits<WeightMap>::value_type weight_type;
+  typedef typename Topology::point_type Point;
+  const std::size_t dims = Point::dimensions;
+  typedef detail::stress_majorization_body<Graph, WeightMap, VertexIndexMap,
+                                           Point::dimensions> body_type;
+
+  const std::size_t n = num_vertices(g);
+  if (n == 0)
+    return true;
+  std::vector<vertex_descriptor> verts(n);
+  BGL_FORALL_VERTICES_T(v, g, Graph)
+    verts[get(index, v)] = v;
+  if (n == 1) {
+    put(position, verts[0], topology.center());
+    return true;
+  }
+  num_threads = detail::resolve_number_of_threads(num_threads);
+
+  // The pivots, each the vertex farthest from those before, and the
+  // region of the nearest pivot of each vertex.
+  const std::size_t k = (std::max)(std::size_t(1), (std::min)(num_pivots, n));
+  std::vector<std::size_t> pivots(k), region(n);
+  std::vector<detail::stress_pivot_term> terms(n * k);
+  std::vector<weight_type> distance(n);
+  std::vector<double> nearest(n, (std::numeric_limits<double>::max)());
+  double diameter = 0.;
+  std::size_t next = 0;
+  for (std::size_t p = 0; p < k; ++p) {
+    pivots[p] = next;
+    dijkstra_shortest_paths
+      (g, verts[next],
+       weight_map(weight).vertex_index_map(index).
+       distance_map(make_iterator_property_map(distance.begin(), index)));
+    for (std::size_t i = 0; i < n; ++i) {
+      if (distance[i] == (std::numeric_limits<weight_type>::max)())
+        return false;
+      double d = double(distance[i]);
+      terms[i * k + p].distance = float(d);
+      diameter = (std::max)(diameter, d);
+      if (d < nearest[i]) {
+        nearest[i] = d;
+        region[i] = p;
+      }
+    }
+    next = std::max_element(nearest.begin(), nearest.end())
+      - nearest.begin();
+  }
+  std::vector<std::vector<double> > regions(k);
+  for (std::size_t i = 0; i < n; ++i)
+    regions[region[i]].push_back(terms[i * k + region[i]].distance);
+  for (std::size_t p = 0; p < k; ++p)
+    std::sort(regions[p].begin(), regions[p].end());
+
+  // Pivot MDS, on the distances before they are scaled.
+  std::vector<double> coords(n * dims), column_mean(k, 0.);
+  double mean = 0.;
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t p = 0; p < k; ++p) {
+      double d = terms[i * k + p].distance;
+      column_mean[p] += d * d;
+    }
+  for (std::size_t p = 0; p < k; ++p) {
+    column_mean[p] /= double(n);
+    mean += column_mean[p] / double(k);
+  }
+  {
+    detail::pivot_mds_body<Point::dimensions>
+      mds(terms, k, column_mean, mean, coords);
+    mds.row.resize(num_threads);
+    std::vector<double> products(mds.chunks() * k * k, 0.), b(k * k, 0.);
+    std::vector<double> vectors;
+    mds.products = &products;
+    detail::parallel_for(mds.chunks(), mds, num_threads);
+    for (std::size_t c = 0; c < mds.chunks(); ++c)
+      for (std::size_t p = 0; p < k; ++p)
+        for (std::size_t q = p; q < k; ++q)
+          b[p * k + q] += products[c * k * k + p * k + q];
+    for (std::size_t p = 0; p < k; ++p)
+      for (std::size_t q = 0; q < p; ++q)
+        b[p * k + q] = b[q * k + p];
+    detail::pivot_mds_eigenvectors(b, k, dims, vectors);
+    mds.products = 0;
+    mds.vectors = &vectors;
+    detail::parallel_for(n, mds, num_threads, 256);
+  }
+
+  double length = detail::stress_edge_length(edge_or_side_length, diameter);
+  detail::stress_pivot_weights_body weigh(terms, regions, length);
+  detail::parallel_for(n, weigh, num_threads, 256);
+
+  // Scale the initial layout to fit the distances best, then iterate.
+  std::vector<double> positions(n * dims), stress(n), scale_sum(2 * n);
+  body_type body(g, weight, index, verts, pivots, terms, length, coords,
+                 positions, stress, scale_sum);
+  body.scale = true;
+  detail::parallel_for(n, body, num_threads, 256);
+  double fit = 0., square = 0.;
+  for (std::size_t i = 0; i < n; ++i) {
+    fit += scale_sum[2 * i];
+    square += scale_sum[2 * i + 1];
+  }
+  if (square > 0.)
+    for (std::size_t i = 0; i < n * dims; ++i)
+      coords[i] *= fit / square;
+  body.scale = false;
+
+  for (std::size_t iteration = 0;
+       iteration < detail::stress_majorization_max_iterations();
+       ++iteration) {
+    detail::parallel_for(n, body, num_threads, 256);
+    std::swap(body.old, body.positions);
+    double total = 0.;
+    std::size_t worst = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      total += stress[i];
+      if (stress[i] > stress[worst])
+        worst = i;
+    }
+    if (done(total, verts[worst], g, true))
+      break;
+  }
+
+  const std::vector<double>& x = *body.old;
+  std::vector<double> centroid(dims, 0.);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t c = 0; c < dims; ++c)
+      centroid[c] += x[i * dims + c] / double(n);
+  Point center = topology.center();
+  for (std::size_t i = 0; i < n; ++i) {
+    Point p;
+    for (std::size_t c = 0; c < dims; ++c)
+      p[c] = center[c] + x[i * dims + c] - centroid[c];
+    put(position, verts[i], p);
+  }
+  return true;
+}
+
+/**
+ * \overload
+ */
+template<typename Topology, typename Graph, typename PositionMap,
+         typename WeightMap, typename T, bool EdgeOrSideLength,
+         typename Done>
+bool
+stress_majorization_layout
+  (const Graph& g,
+   PositionMap position,
+   WeightMap weight,
+   const Topology& topology,
+   detail::graph::edge_or_side<EdgeOrSideLength, T> edge_or_side_length,
+   Done done,
+   std::size_t num_pivots,
+   std::size_t num_threads = 1)
+{
+  return stress_majorization_layout(g, position, weight, topology,
+                                    edge_or_side_length, done, num_pivots,
+                                    get(vertex_index, g), num_threads);
+}
+
+/**
+ * \overload
+ *
+ * Uses 50 pivots.
+ */
+template<typename Topology, typename Graph, typename PositionMap,
+         typename WeightMap, typename T, bool EdgeOrSideLength,
+         typename Done>
+bool
+stress_majorization_layout
+  (const Graph& g,
+   PositionMap position,
+   WeightMap weight,
+   const Topology& topology,
+   detail::graph::edge_or_side<EdgeOrSideLength, T> edge_or_side_length,
+   Done done)
+{
+  return stress_majorization_layout(g, position, weight, topology,
+                                    edge_or_side_length, done, 50);
+}
+
+/**
+ * \overload
+ *
+ * Uses 50 pivots, and layout_tolerance<double>() to stop.
+ */
+template<typename Topology, typename Graph, typename PositionMap,
+         typename WeightMap, typename T, bool EdgeOrSideLength>
+bool
+stress_majorization_layout
+  (const Graph& g,
+   PositionMap position,
+   WeightMap weight,
+   const Topology& topology,
+   detail::graph::edge_or_side<EdgeOrSideLength, T> edge_or_side_length)
+{
+  return stress_majorization_layout(g, position, weight, topology,
+                                    edge_or_side_length,
+                                    layout_tolerance<double>(), 50);
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_STRESS_MAJORIZATION_LAYOUT_HPP
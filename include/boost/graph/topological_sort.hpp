@@ -16,7 +16,10 @@
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/visitors.hpp>
 #include <boost/graph/exception.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/throw_exception.hpp>
+#include <vector>
+#include <algorithm>
 
 namespace boost { 
 
@@ -72,6 +75,156 @@ namespace boost {
                      bgl_named_params<int, buffer_param_t>(0)); // bogus
   }
 
+
+  // Level-synchronous topological sort
+  //
+  // Kahn's algorithm, processed one level at a time: level 0 holds the
+  // vertices without in-edges and level k + 1 the vertices whose last
+  // in-edge comes from level k.  All vertices of a level are independent
+  // of each other, so each level is expanded by all threads at once.
+  // Within a level the vertices are ordered by index, which makes the
+  // result independent of the number of threads.
+
+  namespace detail {
+
+    template <typename Graph, typename IndexMap>
+    struct topo_level_body
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+
+      topo_level_body(const Graph& g, IndexMap index,
+                      const std::vector<Vertex>& verts,
+                      const std::vector<std::size_t>& order,
+                      std::size_t first, parallel_counters& in_degree,
+                      std::vector<std::vector<std::size_t> >& next)
+        : m_g(g), m_index(index), m_verts(verts), m_order(order),
+          m_first(first), m_in_degree(in_degree), m_next(next) { }
+
+      void operator()(std::size_t i, std::size_t t)
+      {
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(m_verts[m_order[m_first + i]],
+                                                m_g);
+             ei != ei_end; ++ei) {
+          std::size_t v = get(m_index, target(*ei, m_g));
+          if (m_in_degree.decrement(v) == 0)
+            m_next[t].push_back(v);
+        }
+      }
+
+      const Graph& m_g;
+      IndexMap m_index;
+      const std::vector<Vertex>& m_verts;
+      const std::vector<std::size_t>& m_order;
+      std::size_t m_first;
+      parallel_counters& m_in_degree;
+      std::vector<std::vector<std::size_t> >& m_next;
+    };
+
+    // Fills order with the vertex indices in level order and
+    // level_begin with the position in order where each level starts,
+    // followed by the size of order.  If only is given, only the vertices
+    // v with only[v] set are ordered; the edges out of them must not lead
+    // to other vertices.  Throws not_a_dag on a cycle.
+    template <typename Graph, typename IndexMap>
+    void topological_levels
+      (const Graph& g, IndexMap index, std::size_t num_threads,
+       std::vector<typename graph_traits<Graph>::vertex_descriptor>& verts,
+       std::vector<std::size_t>& order,
+       std::vector<std::size_t>& level_begin,
+       const std::vector<char>* only = 0)
+    {
+      const std::size_t n = num_vertices(g);
+      parallel_counters in_degree(n);
+      verts.resize(n);
+      order.clear();
+      order.reserve(n);
+      level_begin.clear();
+
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      std::size_t count = 0;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        verts[get(index, *vi)] = *vi;
+        if (only && !(*only)[get(index, *vi)])
+          continue;
+        ++count;
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei)
+          in_degree.increment(get(index, target(*ei, g)));
+      }
+      for (std::size_t v = 0; v < n; ++v)
+        if (in_degree.load(v) == 0 && (!only || (*only)[v]))
+          order.push_back(v);
+
+      num_threads = resolve_number_of_threads(num_threads);
+      std::vector<std::vector<std::size_t> > next(num_threads);
+      std::size_t first = 0;
+      while (first != order.size()) {
+        level_begin.push_back(first);
+        std::size_t last = order.size();
+        topo_level_body<Graph, IndexMap>
+          body(g, index, verts, order, first, in_degree, next);
+        parallel_for(last - first, body, num_threads, 64);
+        for (std::size_t t = 0; t < num_threads; ++t) {
+          order.insert(order.end(), next[t].begin(), next[t].end());
+          next[t].clear();
+        }
+        std::sort(order.begin() + last, order.end());
+        first = last;
+      }
+      if (order.size() != count)
+        BOOST_THROW_EXCEPTION(not_a_dag());
+      level_begin.push_back(count);
+    }
+
+  } // namespace detail
+
+  // Writes the vertices to result in level order, records the level of
+  // every vertex in the level map and returns the number of levels.
+  template <typename VertexListGraph, typename OutputIterator,
+            typename LevelMap, typename IndexMap>
+  std::size_t
+  topological_sort_levels(const VertexListGraph& g, OutputIterator result,
+                          LevelMap level, IndexMap index,
+                          std::size_t num_threads)
+  {
+    typedef typename graph_traits<VertexListGraph>::vertex_descriptor Vertex;
+    std::vector<Vertex> verts;
+    std::vector<std::size_t> order, level_begin;
+    detail::topological_levels(g, index, num_threads, verts, order,
+                               level_begin);
+    for (std::size_t k = 0; k + 1 < level_begin.size(); ++k)
+      for (std::size_t i = level_begin[k]; i < level_begin[k + 1]; ++i) {
+        put(level, verts[order[i]], k);
+        *result++ = verts[order[i]];
+      }
+    return level_begin.size() - 1;
+  }
+
+  template <typename VertexListGraph, typename OutputIterator,
+            typename LevelMap, typename P, typename T, typename R>
+  std::size_t
+  topological_sort_levels(const VertexListGraph& g, OutputIterator result,
+                          LevelMap level,
+                          const bgl_named_params<P, T, R>& params)
+  {
+    return topological_sort_levels
+      (g, result, level,
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       choose_param(get_param(params, number_of_threads_t()),
+                    std::size_t(1)));
+  }
+
+  template <typename VertexListGraph, typename OutputIterator,
+            typename LevelMap>
+  std::size_t
+  topological_sort_levels(const VertexListGraph& g, OutputIterator result,
+                          LevelMap level)
+  {
+    return topological_sort_levels(g, result, level,
+                                   get(vertex_index, g), 1);
+  }
+
 } // namespace boost
 
 #endif /*BOOST_GRAPH_TOPOLOGICAL_SORT_H*/
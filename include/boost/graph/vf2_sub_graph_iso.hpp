@@ -22,6 +22,9 @@
 #include <iterator>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <functional>
+#include <queue>
 
 #include <boost/assert.hpp>
 #include <boost/concept/assert.hpp>
@@ -30,6 +33,7 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/mcgregor_common_subgraphs.hpp> // for always_equivalent
 #include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/type_traits/has_less.hpp>
 #include <boost/mpl/int.hpp>
 #include <boost/range/algorithm/sort.hpp>
@@ -409,6 +413,11 @@ namespace boost {
       base_state<Graph1, Graph2, IndexMap1, IndexMap2> state1_;
       base_state<Graph2, Graph1, IndexMap2, IndexMap1> state2_;
 
+      // Degrees of the unmatched in- and out-neighbors of the vertices
+      // tested by feasible(), for the lookahead
+      std::vector<std::size_t> in_degrees1_, out_degrees1_;
+      std::vector<std::size_t> in_degrees2_, out_degrees2_;
+
       // Three helper functions used in Feasibility and Valid functions to test
       // terminal set counts when testing for:
       // - graph sub-graph monomorphism, or
@@ -431,6 +440,31 @@ namespace boost {
                                  boost::mpl::int_<isomorphism>) const {
         return a == b;
       }
+
+      template <typename Graph>
+      static std::size_t degree(typename graph_traits<Graph>::vertex_descriptor v,
+                                const Graph& graph) {
+        return in_degree(v, graph) + out_degree(v, graph);
+      }
+
+      // Lookahead beyond the terminal set counts: the unmatched neighbors
+      // of the new vertex of graph1 must be mapped to distinct unmatched
+      // neighbors of the new vertex of graph2 with at least the same
+      // degree (exactly the same for isomorphism), which is possible iff
+      // the degrees, both sorted in decreasing order, compare elementwise.
+      bool degrees_fit(std::vector<std::size_t>& degrees1,
+                       std::vector<std::size_t>& degrees2) const {
+        if (!comp_term_sets(degrees1.size(), degrees2.size(),
+                            boost::mpl::int_<problem_selection>()))
+          return false;
+        std::sort(degrees1.begin(), degrees1.end(), std::greater<std::size_t>());
+        std::sort(degrees2.begin(), degrees2.end(), std::greater<std::size_t>());
+        for (std::size_t i = 0; i < degrees1.size(); ++i)
+          if (!comp_term_sets(degrees1[i], degrees2[i],
+                              boost::mpl::int_<problem_selection>()))
+            return false;
+        return true;
+      }
       
       // Forbidden 
       state(const state&);
@@ -465,6 +499,15 @@ namespace boost {
       bool feasible(const vertex1_type& v_new, const vertex2_type& w_new) {
         
         if (!vertex_comp_(v_new, w_new)) return false;
+
+        if (!comp_term_sets(in_degree(v_new, graph1_), in_degree(w_new, graph2_),
+                            boost::mpl::int_<problem_selection>()) ||
+            !comp_term_sets(out_degree(v_new, graph1_), out_degree(w_new, graph2_),
+                            boost::mpl::int_<problem_selection>()))
+          return false;
+
+        in_degrees1_.clear(); out_degrees1_.clear();
+        in_degrees2_.clear(); out_degrees2_.clear();
         
         // graph1
         graph1_size_type term_in1_count = 0, term_out1_count = 0, rest1_count = 0;
@@ -491,6 +534,7 @@ namespace boost {
                 ++term_out1_count;
               if ((state1_.in_depth(v) == 0) && (state1_.out_depth(v) == 0))
                 ++rest1_count;
+              in_degrees1_.push_back(degree(v, graph1_));
             }
           }
         }
@@ -517,6 +561,7 @@ namespace boost {
                 ++term_out1_count;
               if ((state1_.in_depth(v) == 0) && (state1_.out_depth(v) == 0))
                 ++rest1_count;
+              out_degrees1_.push_back(degree(v, graph1_));
             }
           }
         }
@@ -547,6 +592,7 @@ namespace boost {
                 ++term_out2_count;
               if ((state2_.in_depth(w) == 0) && (state2_.out_depth(w) == 0))
                 ++rest2_count;
+              in_degrees2_.push_back(degree(w, graph2_));
             }
           }
         }
@@ -574,26 +620,32 @@ namespace boost {
                 ++term_out2_count;
               if ((state2_.in_depth(w) == 0) && (state2_.out_depth(w) == 0))
                 ++rest2_count;
+              out_degrees2_.push_back(degree(w, graph2_));
             }
           }
         }
 
         if (problem_selection != subgraph_mono) { // subgraph_iso and isomorphism
-          return comp_term_sets(term_in1_count, term_in2_count,
-                                boost::mpl::int_<problem_selection>()) &&
-                 comp_term_sets(term_out1_count, term_out2_count, 
-                                boost::mpl::int_<problem_selection>()) &&
-                 comp_term_sets(rest1_count, rest2_count, 
-                                boost::mpl::int_<problem_selection>());
+          if (!(comp_term_sets(term_in1_count, term_in2_count,
+                               boost::mpl::int_<problem_selection>()) &&
+                comp_term_sets(term_out1_count, term_out2_count, 
+                               boost::mpl::int_<problem_selection>()) &&
+                comp_term_sets(rest1_count, rest2_count, 
+                               boost::mpl::int_<problem_selection>())))
+            return false;
         } else { // subgraph_mono
-          return comp_term_sets(term_in1_count, term_in2_count,
-                                boost::mpl::int_<problem_selection>()) &&
-                 comp_term_sets(term_out1_count, term_out2_count, 
-                                boost::mpl::int_<problem_selection>()) &&
-                 comp_term_sets(term_in1_count + term_out1_count + rest1_count,
-                                term_in2_count + term_out2_count + rest2_count, 
-                                boost::mpl::int_<problem_selection>());
+          if (!(comp_term_sets(term_in1_count, term_in2_count,
+                               boost::mpl::int_<problem_selection>()) &&
+                comp_term_sets(term_out1_count, term_out2_count, 
+                               boost::mpl::int_<problem_selection>()) &&
+                comp_term_sets(term_in1_count + term_out1_count + rest1_count,
+                               term_in2_count + term_out2_count + rest2_count, 
+                               boost::mpl::int_<problem_selection>())))
+            return false;
         }
+
+        return degrees_fit(in_degrees1_, in_degrees2_) &&
+               degrees_fit(out_degrees1_, out_degrees2_);
       }
       
       // Returns true if vertex v in graph1 is a possible candidate to
@@ -622,6 +674,16 @@ namespace boost {
           return !state2_.in_core(w);
       }
 
+      // Returns true if vertex v of graph1 is in the present mapping
+      bool in_core(const vertex1_type& v) const {
+        return state1_.in_core(v);
+      }
+
+      // Returns the image of vertex v of graph1 in the present mapping
+      vertex2_type core(const vertex1_type& v) const {
+        return state1_.core(v);
+      }
+
       // Returns true if a mapping was found
       bool success() const {
         return state1_.count() == num_vertices(graph1_);
@@ -651,23 +713,21 @@ namespace boost {
     };
 
     
-    // Data structure to keep info used for back tracking during
-    // matching process
-    template<typename Graph1,
-             typename Graph2,
-             typename VertexOrder1>
-    struct vf2_match_continuation {
-      typename VertexOrder1::const_iterator graph1_verts_iter;
-      typename graph_traits<Graph2>::vertex_iterator graph2_verts_iter;
-    };
-
-    // Non-recursive method that explores state space using a depth-first
-    // search strategy.  At each depth possible pairs candidate are compute
-    // and tested for feasibility to extend the mapping. If a complete
-    // mapping is found, the mapping is output to user_callback in the form
-    // of a correspondence map (graph1 to graph2). Returning false from the
-    // user_callback will terminate the search. Function match will return
-    // true if the entire search space was explored.
+    // Explores the state space using a depth-first search strategy.  At
+    // each depth the next vertex of graph1 is the first one of vertex_order1
+    // that is a possible candidate, and its possible candidates in graph2
+    // are tested for feasibility to extend the mapping.  When the vertex
+    // has a matched neighbor, the candidates are limited to the neighbors
+    // of its image.  If a complete mapping is found, the mapping is output
+    // to user_callback in the form of a correspondence map (graph1 to
+    // graph2).  Returning false from the user_callback will terminate the
+    // search.
+    //
+    // With several threads, the search tree is split across them by work
+    // stealing: a thread that runs out of work registers as idle, and the
+    // busy threads give away half of the untried candidates of their
+    // shallowest open level.  Each thread has its own state; the calls to
+    // user_callback are serialized.
     template<typename Graph1,
              typename Graph2,
              typename IndexMap1,
@@ -677,67 +737,335 @@ namespace boost {
              typename VertexEquivalencePredicate, 
              typename SubGraphIsoMapCallback,
              problem_selector problem_selection>
-    bool match(const Graph1& graph1, const Graph2& graph2, 
-               SubGraphIsoMapCallback user_callback, const VertexOrder1& vertex_order1, 
-               state<Graph1, Graph2, IndexMap1, IndexMap2,
-               EdgeEquivalencePredicate, VertexEquivalencePredicate,
-               SubGraphIsoMapCallback, problem_selection>& s) {
-      
-      typename VertexOrder1::const_iterator graph1_verts_iter;
+    class vf2_search {
 
-      typedef typename graph_traits<Graph2>::vertex_iterator vertex2_iterator_type;
-      vertex2_iterator_type graph2_verts_iter, graph2_verts_iter_end;
-    
-      typedef vf2_match_continuation<Graph1, Graph2, VertexOrder1> match_continuation_type;
-      std::vector<match_continuation_type> k;
-      bool found_match = false;
-  
-      recur:
-      if (s.success()) {
-        if (!s.call_back(user_callback)) 
-          return true;
-        found_match = true;
+      typedef typename graph_traits<Graph1>::vertex_descriptor vertex1_type;
+      typedef typename graph_traits<Graph2>::vertex_descriptor vertex2_type;
+
+      typedef state<Graph1, Graph2, IndexMap1, IndexMap2,
+                    EdgeEquivalencePredicate, VertexEquivalencePredicate,
+                    SubGraphIsoMapCallback, problem_selection> state_type;
+
+      // The vertex of graph1 chosen at one depth, with its candidates in
+      // graph2.  The candidates in [next, end) are still to be tried; the
+      // one before next is in the mapping if pushed is true.
+      struct frame {
+        vertex1_type v;
+        std::vector<vertex2_type> candidates;
+        std::size_t next, end;
+        bool pushed;
+      };
+
+      // Partial mapping to resume the search from, with the candidates of
+      // the next vertex that remain to be tried
+      struct task {
+        std::vector<std::pair<vertex1_type, vertex2_type> > prefix;
+        vertex1_type v;
+        std::vector<vertex2_type> candidates;
+      };
+
+      struct worker {
+        explicit worker(const vf2_search& search)
+          : s(search.graph1_, search.graph2_,
+              search.index_map1_, search.index_map2_,
+              search.edge_comp_, search.vertex_comp_),
+            marks(num_vertices(search.graph2_), 0), mark(0) {}
+
+        state_type s;
+        std::vector<frame> frames;
+        std::vector<std::pair<vertex1_type, vertex2_type> > prefix;
+        std::vector<std::size_t> marks;
+        std::size_t mark;
+      };
+
+      enum { stop_flag, idle_count, pool_size };
 
-        goto back_track;
+      const Graph1& graph1_;
+      const Graph2& graph2_;
+      IndexMap1 index_map1_;
+      IndexMap2 index_map2_;
+      const VertexOrder1& vertex_order1_;
+      EdgeEquivalencePredicate edge_comp_;
+      VertexEquivalencePredicate vertex_comp_;
+      SubGraphIsoMapCallback user_callback_;
+      std::size_t num_threads_;
+      bool found_match_;
+
+      std::vector<task> pool_;
+      parallel_counters shared_;
+      parallel_mutex pool_mutex_, callback_mutex_;
+
+      // Forbidden
+      vf2_search(const vf2_search&);
+      vf2_search& operator=(const vf2_search&);
+
+      bool stopped() const {
+        return shared_.load(stop_flag) != 0;
       }
- 
-      if (!s.valid())
-        goto back_track;
 
-      graph1_verts_iter = vertex_order1.begin();
-      while (graph1_verts_iter != vertex_order1.end() && 
-             !s.possible_candidate1(*graph1_verts_iter)) {
-        ++graph1_verts_iter;
+      void add_candidate(worker& w, frame& f, const vertex2_type& x) const {
+        std::size_t& mark = w.marks[get(index_map2_, x)];
+        if (mark != w.mark && w.s.possible_candidate2(x)) {
+          mark = w.mark;
+          f.candidates.push_back(x);
+        }
       }
 
-      boost::tie(graph2_verts_iter, graph2_verts_iter_end) = vertices(graph2);
-      while (graph2_verts_iter != graph2_verts_iter_end) {
-        if (s.possible_candidate2(*graph2_verts_iter)) {
-          if (s.feasible(*graph1_verts_iter, *graph2_verts_iter)) {
-            match_continuation_type kk;
-            kk.graph1_verts_iter = graph1_verts_iter;
-            kk.graph2_verts_iter = graph2_verts_iter;
-            k.push_back(kk);
-            
-            s.push(*graph1_verts_iter, *graph2_verts_iter);
-            goto recur;
+      // Chooses the next vertex of graph1 and collects its candidates
+      void open(worker& w, frame& f) const {
+        typename VertexOrder1::const_iterator graph1_verts_iter = vertex_order1_.begin();
+        while (!w.s.possible_candidate1(*graph1_verts_iter))
+          ++graph1_verts_iter;
+
+        f.v = *graph1_verts_iter;
+        f.candidates.clear();
+        f.next = 0;
+        f.pushed = false;
+
+        // The image of a matched neighbor with the fewest neighbors of
+        // its own
+        bool anchored = false, anchor_out = false;
+        vertex2_type anchor = vertex2_type();
+        std::size_t anchor_degree = 0;
+        BGL_FORALL_INEDGES_T(f.v, e, graph1_, Graph1) {
+          vertex1_type u = source(e, graph1_);
+          if (w.s.in_core(u)) {
+            vertex2_type x = w.s.core(u);
+            if (!anchored || out_degree(x, graph2_) < anchor_degree) {
+              anchored = anchor_out = true;
+              anchor = x;
+              anchor_degree = out_degree(x, graph2_);
+            }
+          }
+        }
+        BGL_FORALL_OUTEDGES_T(f.v, e, graph1_, Graph1) {
+          vertex1_type u = target(e, graph1_);
+          if (w.s.in_core(u)) {
+            vertex2_type x = w.s.core(u);
+            if (!anchored || in_degree(x, graph2_) < anchor_degree) {
+              anchored = true;
+              anchor_out = false;
+              anchor = x;
+              anchor_degree = in_degree(x, graph2_);
+            }
           }
         }
-        graph2_loop: ++graph2_verts_iter;
+
+        ++w.mark;
+        if (!anchored) {
+          BGL_FORALL_VERTICES_T(x, graph2_, Graph2)
+            add_candidate(w, f, x);
+        } else if (anchor_out) {
+          BGL_FORALL_OUTEDGES_T(anchor, e, graph2_, Graph2)
+            add_candidate(w, f, target(e, graph2_));
+        } else {
+          BGL_FORALL_INEDGES_T(anchor, e, graph2_, Graph2)
+            add_candidate(w, f, source(e, graph2_));
+        }
+        f.end = f.candidates.size();
       }
 
-      back_track:
-      if (k.empty()) 
-        return found_match;    
-      
-      const match_continuation_type kk = k.back();
-      graph1_verts_iter = kk.graph1_verts_iter;
-      graph2_verts_iter = kk.graph2_verts_iter;
-      k.pop_back();
-      
-      s.pop(*graph1_verts_iter, *graph2_verts_iter);
-      
-      goto graph2_loop;
+      void report(worker& w) {
+        parallel_lock lock(callback_mutex_);
+        if (stopped())
+          return;
+        found_match_ = true;
+        if (!w.s.call_back(user_callback_))
+          shared_.set(stop_flag, 1);
+      }
+
+      // Gives away half of the untried candidates of the shallowest open
+      // level if a thread is idle and no task is waiting for it.  The
+      // first depth levels are open and all but the last are in the
+      // mapping.
+      void share(worker& w, std::size_t depth) {
+        if (shared_.load(pool_size) >= shared_.load(idle_count))
+          return;
+        for (std::size_t i = 0; i < depth; ++i) {
+          frame& f = w.frames[i];
+          const std::size_t remaining = f.end - f.next;
+          if (remaining == 0)
+            continue;
+
+          task t;
+          t.prefix = w.prefix;
+          for (std::size_t j = 0; j < i; ++j)
+            t.prefix.push_back(std::make_pair(w.frames[j].v,
+                                              w.frames[j].candidates[w.frames[j].next - 1]));
+          t.v = f.v;
+          t.candidates.assign(f.candidates.begin() + (f.end - (remaining + 1) / 2),
+                              f.candidates.begin() + f.end);
+          f.end -= t.candidates.size();
+
+          parallel_lock lock(pool_mutex_);
+          pool_.push_back(task());
+          pool_.back().prefix.swap(t.prefix);
+          pool_.back().v = t.v;
+          pool_.back().candidates.swap(t.candidates);
+          shared_.increment(pool_size);
+          return;
+        }
+      }
+
+      // Searches below the open level w.frames[0]
+      void search(worker& w) {
+        std::size_t depth = 1;
+        while (depth > 0) {
+          if (stopped())
+            return;
+
+          frame* f = &w.frames[depth - 1];
+          if (f->pushed) {
+            w.s.pop(f->v, f->candidates[f->next - 1]);
+            f->pushed = false;
+          }
+          if (num_threads_ > 1)
+            share(w, depth);
+
+          while (f->next < f->end && !w.s.feasible(f->v, f->candidates[f->next]))
+            ++f->next;
+          if (f->next == f->end) {
+            --depth;
+            continue;
+          }
+          w.s.push(f->v, f->candidates[f->next]);
+          ++f->next;
+          f->pushed = true;
+
+          if (w.s.success()) {
+            report(w);
+          } else if (w.s.valid()) {
+            if (w.frames.size() == depth)
+              w.frames.resize(depth + 1);
+            open(w, w.frames[depth]);
+            ++depth;
+          }
+        }
+      }
+
+      // Waits for a task; returns false when the search is over
+      bool next_task(task& t) {
+        bool idle = false;
+        for (;;) {
+          {
+            parallel_lock lock(pool_mutex_);
+            if (stopped())
+              return false;
+            if (!pool_.empty()) {
+              t.prefix.swap(pool_.back().prefix);
+              t.v = pool_.back().v;
+              t.candidates.swap(pool_.back().candidates);
+              pool_.pop_back();
+              shared_.decrement(pool_size);
+              if (idle)
+                shared_.decrement(idle_count);
+              return true;
+            }
+            if (!idle) {
+              shared_.increment(idle_count);
+              idle = true;
+            }
+            if (shared_.load(idle_count) == num_threads_)
+              return false;
+          }
+          parallel_yield();
+        }
+      }
+
+      void work(worker& w) {
+        w.frames.resize(1);
+        task t;
+        while (next_task(t)) {
+          while (!w.prefix.empty()) {
+            w.s.pop(w.prefix.back().first, w.prefix.back().second);
+            w.prefix.pop_back();
+          }
+          for (std::size_t i = 0; i < t.prefix.size(); ++i)
+            w.s.push(t.prefix[i].first, t.prefix[i].second);
+          w.prefix.swap(t.prefix);
+
+          frame& f = w.frames[0];
+          f.v = t.v;
+          f.candidates.swap(t.candidates);
+          f.next = 0;
+          f.end = f.candidates.size();
+          f.pushed = false;
+          search(w);
+        }
+      }
+
+    public:
+
+      vf2_search(const Graph1& graph1, const Graph2& graph2,
+                 IndexMap1 index_map1, IndexMap2 index_map2,
+                 const VertexOrder1& vertex_order1,
+                 EdgeEquivalencePredicate edge_comp,
+                 VertexEquivalencePredicate vertex_comp,
+                 SubGraphIsoMapCallback user_callback,
+                 std::size_t num_threads)
+        : graph1_(graph1), graph2_(graph2),
+          index_map1_(index_map1), index_map2_(index_map2),
+          vertex_order1_(vertex_order1),
+          edge_comp_(edge_comp), vertex_comp_(vertex_comp),
+          user_callback_(user_callback),
+          num_threads_(resolve_number_of_threads(num_threads)),
+          found_match_(false), shared_(3) {}
+
+      // Returns true if a mapping was found
+      bool run() {
+        worker root(*this);
+        if (root.s.success()) {
+          report(root);
+        } else if (root.s.valid()) {
+          root.frames.resize(1);
+          open(root, root.frames[0]);
+          if (num_threads_ == 1) {
+            search(root);
+          } else {
+            pool_.push_back(task());
+            pool_.back().v = root.frames[0].v;
+            pool_.back().candidates.swap(root.frames[0].candidates);
+            shared_.set(pool_size, 1);
+            parallel_for(num_threads_, *this, num_threads_);
+          }
+        }
+        return found_match_;
+      }
+
+      // Body of parallel_for: one call per thread
+      void operator()(std::size_t, std::size_t) {
+        try {
+          worker w(*this);
+          work(w);
+        } catch (...) {
+          shared_.set(stop_flag, 1);
+          throw;
+        }
+      }
+    };
+
+    template<problem_selector problem_selection,
+             typename Graph1,
+             typename Graph2,
+             typename IndexMap1,
+             typename IndexMap2,
+             typename VertexOrder1,
+             typename EdgeEquivalencePredicate,
+             typename VertexEquivalencePredicate, 
+             typename SubGraphIsoMapCallback>
+    bool match(const Graph1& graph1, const Graph2& graph2, 
+               SubGraphIsoMapCallback user_callback,
+               IndexMap1 index_map1, IndexMap2 index_map2,
+               const VertexOrder1& vertex_order1,
+               EdgeEquivalencePredicate edge_comp,
+               VertexEquivalencePredicate vertex_comp,
+               std::size_t num_threads) {
+      vf2_search<Graph1, Graph2, IndexMap1, IndexMap2, VertexOrder1,
+                 EdgeEquivalencePredicate, VertexEquivalencePredicate,
+                 SubGraphIsoMapCallback, problem_selection>
+        search(graph1, graph2, index_map1, index_map2, vertex_order1,
+               edge_comp, vertex_comp, user_callback, num_threads);
+      return search.run();
     }
 
 
@@ -832,7 +1160,8 @@ namespace boost {
                           IndexMapSmall index_map_small, IndexMapLarge index_map_large, 
                           const VertexOrderSmall& vertex_order_small,
                           EdgeEquivalencePredicate edge_comp,
-                          VertexEquivalencePredicate vertex_comp) {
+                          VertexEquivalencePredicate vertex_comp,
+                          std::size_t num_threads) {
 
       // Graph requirements
       BOOST_CONCEPT_ASSERT(( BidirectionalGraphConcept<GraphSmall> ));
@@ -889,12 +1218,10 @@ namespace boost {
       if (num_edges_small > num_edges_large)
         return false;
     
-      detail::state<GraphSmall, GraphLarge, IndexMapSmall, IndexMapLarge,
-                    EdgeEquivalencePredicate, VertexEquivalencePredicate,
-                    SubGraphIsoMapCallback, problem_selection> 
-        s(graph_small, graph_large, index_map_small, index_map_large, edge_comp, vertex_comp);
-
-      return detail::match(graph_small, graph_large, user_callback, vertex_order_small, s);
+      return detail::match<problem_selection>(graph_small, graph_large, user_callback,
+                                              index_map_small, index_map_large,
+                                              vertex_order_small, edge_comp, vertex_comp,
+                                              num_threads);
     }
 
   } // namespace detail
@@ -913,6 +1240,148 @@ namespace boost {
   }
 
 
+  namespace detail {
+
+    // Number of vertices of graph_large that vertex_comp allows v to be
+    // mapped to
+    template<typename GraphSmall,
+             typename GraphLarge,
+             typename VertexEquivalencePredicate>
+    std::size_t count_equivalent(const GraphSmall&, const GraphLarge& graph_large,
+                                 typename graph_traits<GraphSmall>::vertex_descriptor v,
+                                 VertexEquivalencePredicate vertex_comp) {
+      std::size_t count = 0;
+      BGL_FORALL_VERTICES_T(w, graph_large, GraphLarge)
+        if (vertex_comp(v, w))
+          ++count;
+      return count;
+    }
+
+    template<typename GraphSmall,
+             typename GraphLarge>
+    std::size_t count_equivalent(const GraphSmall&, const GraphLarge& graph_large,
+                                 typename graph_traits<GraphSmall>::vertex_descriptor,
+                                 always_equivalent) {
+      return num_vertices(graph_large);
+    }
+
+    // Entry of the queue of vertex_order_by_probability; stale entries are
+    // recognized by their number of connections
+    template<typename Vertex>
+    struct vf3_order_entry {
+      std::size_t connections;
+      double probability;
+      std::size_t degree, index;
+      Vertex v;
+
+      // Ranks a before b if b comes first in the order
+      bool operator<(const vf3_order_entry& b) const {
+        if (connections != b.connections)
+          return connections < b.connections;
+        if (probability != b.probability)
+          return probability > b.probability;
+        if (degree != b.degree)
+          return degree < b.degree;
+        return index > b.index;
+      }
+    };
+
+  } // namespace detail
+
+
+  // Returns a vertex order for graph_small in the manner of VF3: each
+  // vertex is given the probability that a vertex of graph_large picked at
+  // random is equivalent to it and has at least its degree, and the order
+  // starts from the least probable vertex and then repeatedly takes the
+  // vertex with the most neighbors already in the order, breaking ties by
+  // lower probability and then higher degree.  Rare vertices that are
+  // connected to the matched ones prune the search early.
+  template<typename GraphSmall,
+           typename GraphLarge,
+           typename IndexMapSmall,
+           typename VertexEquivalencePredicate>
+  std::vector<typename graph_traits<GraphSmall>::vertex_descriptor>
+    vertex_order_by_probability(const GraphSmall& graph_small,
+                                const GraphLarge& graph_large,
+                                IndexMapSmall index_map_small,
+                                VertexEquivalencePredicate vertex_comp) {
+
+    typedef typename graph_traits<GraphSmall>::vertex_descriptor vertex_small_type;
+    typedef detail::vf3_order_entry<vertex_small_type> entry_type;
+
+    std::vector<std::size_t> degrees_large;
+    BGL_FORALL_VERTICES_T(w, graph_large, GraphLarge)
+      degrees_large.push_back(in_degree(w, graph_large) + out_degree(w, graph_large));
+    std::sort(degrees_large.begin(), degrees_large.end());
+
+    const std::size_t n_small = num_vertices(graph_small);
+    const double n_large = double(num_vertices(graph_large));
+    std::vector<double> probability(n_small);
+    std::vector<std::size_t> connections(n_small, 0);
+    std::vector<bool> ordered(n_small, false);
+
+    std::priority_queue<entry_type> queue;
+    BGL_FORALL_VERTICES_T(v, graph_small, GraphSmall) {
+      const std::size_t i = get(index_map_small, v);
+      entry_type e;
+      e.connections = 0;
+      e.degree = in_degree(v, graph_small) + out_degree(v, graph_small);
+      const std::size_t at_least =
+        degrees_large.end() - std::lower_bound(degrees_large.begin(),
+                                               degrees_large.end(), e.degree);
+      e.probability = probability[i] =
+        detail::count_equivalent(graph_small, graph_large, v, vertex_comp)
+        / n_large * (at_least / n_large);
+      e.index = i;
+      e.v = v;
+      queue.push(e);
+    }
+
+    std::vector<vertex_small_type> vertex_order;
+    vertex_order.reserve(n_small);
+    while (!queue.empty()) {
+      const entry_type top = queue.top();
+      queue.pop();
+      if (ordered[top.index] || top.connections != connections[top.index])
+        continue;
+      ordered[top.index] = true;
+      vertex_order.push_back(top.v);
+
+      std::vector<vertex_small_type> neighbors;
+      BGL_FORALL_OUTEDGES_T(top.v, e, graph_small, GraphSmall)
+        neighbors.push_back(target(e, graph_small));
+      BGL_FORALL_INEDGES_T(top.v, e, graph_small, GraphSmall)
+        neighbors.push_back(source(e, graph_small));
+      for (std::size_t k = 0; k < neighbors.size(); ++k) {
+        const std::size_t i = get(index_map_small, neighbors[k]);
+        if (ordered[i])
+          continue;
+        entry_type e;
+        e.connections = ++connections[i];
+        e.probability = probability[i];
+        e.degree = in_degree(neighbors[k], graph_small) + out_degree(neighbors[k], graph_small);
+        e.index = i;
+        e.v = neighbors[k];
+        queue.push(e);
+      }
+    }
+    return vertex_order;
+  }
+
+
+  // Returns the vertex order of VF3 for graphs whose vertices are all
+  // equivalent
+  template<typename GraphSmall,
+           typename GraphLarge>
+  std::vector<typename graph_traits<GraphSmall>::vertex_descriptor>
+    vertex_order_by_probability(const GraphSmall& graph_small,
+                                const GraphLarge& graph_large) {
+    return vertex_order_by_probability(graph_small, graph_large,
+                                       get(vertex_index, graph_small),
+                                       always_equivalent());
+  }
+
+
   // Enumerates all graph sub-graph monomorphism mappings between graphs
   // graph_small and graph_large. Continues until user_callback returns true or the
   // search space has been fully explored.
@@ -929,14 +1398,16 @@ namespace boost {
                          IndexMapSmall index_map_small, IndexMapLarge index_map_large, 
                          const VertexOrderSmall& vertex_order_small,
                          EdgeEquivalencePredicate edge_comp,
-                         VertexEquivalencePredicate vertex_comp) {
+                         VertexEquivalencePredicate vertex_comp,
+                         std::size_t num_threads = 1) {
     return detail::vf2_subgraph_morphism<detail::subgraph_mono>
                                         (graph_small, graph_large,
                                          user_callback,
                                          index_map_small, index_map_large,
                                          vertex_order_small,
                                          edge_comp,
-                                         vertex_comp);
+                                         vertex_comp,
+                                         num_threads);
   }
 
 
@@ -974,7 +1445,9 @@ namespace boost {
                              choose_param(get_param(params, edges_equivalent_t()),
                                           always_equivalent()),
                              choose_param(get_param(params, vertices_equivalent_t()),
-                                          always_equivalent())
+                                          always_equivalent()),
+                             choose_param(get_param(params, number_of_threads_t()),
+                                          std::size_t(1))
                              );
   }
   
@@ -995,14 +1468,16 @@ namespace boost {
                         IndexMapSmall index_map_small, IndexMapLarge index_map_large, 
                         const VertexOrderSmall& vertex_order_small,
                         EdgeEquivalencePredicate edge_comp,
-                        VertexEquivalencePredicate vertex_comp) {
+                        VertexEquivalencePredicate vertex_comp,
+                        std::size_t num_threads = 1) {
     return detail::vf2_subgraph_morphism<detail::subgraph_iso>
                                         (graph_small, graph_large,
                                          user_callback,
                                          index_map_small, index_map_large,
                                          vertex_order_small,
                                          edge_comp,
-                                         vertex_comp);
+                                         vertex_comp,
+                                         num_threads);
   }
 
 
@@ -1042,7 +1517,9 @@ namespace boost {
                             choose_param(get_param(params, edges_equivalent_t()),
                                          always_equivalent()),
                             choose_param(get_param(params, vertices_equivalent_t()),
-                                         always_equivalent())
+                                         always_equivalent()),
+                            choose_param(get_param(params, number_of_threads_t()),
+                                         std::size_t(1))
                             );
 
   }
@@ -1064,7 +1541,8 @@ namespace boost {
                      IndexMap1 index_map1, IndexMap2 index_map2, 
                      const VertexOrder1& vertex_order1,
                      EdgeEquivalencePredicate edge_comp,
-                     VertexEquivalencePredicate vertex_comp) {
+                     VertexEquivalencePredicate vertex_comp,
+                     std::size_t num_threads = 1) {
 
     // Graph requirements
     BOOST_CONCEPT_ASSERT(( BidirectionalGraphConcept<Graph1> ));
@@ -1122,12 +1600,9 @@ namespace boost {
     if (num_edges1 != num_edges2)
       return false;
 
-    detail::state<Graph1, Graph2, IndexMap1, IndexMap2,
-                  EdgeEquivalencePredicate, VertexEquivalencePredicate,
-                  GraphIsoMapCallback, detail::isomorphism> 
-      s(graph1, graph2, index_map1, index_map2, edge_comp, vertex_comp);
-
-    return detail::match(graph1, graph2, user_callback, vertex_order1, s);
+    return detail::match<detail::isomorphism>(graph1, graph2, user_callback,
+                                              index_map1, index_map2, vertex_order1,
+                                              edge_comp, vertex_comp, num_threads);
   }
 
 
@@ -1167,7 +1642,9 @@ namespace boost {
                          choose_param(get_param(params, edges_equivalent_t()),
                                 always_equivalent()),
                          choose_param(get_param(params, vertices_equivalent_t()),
-                                      always_equivalent())
+                                      always_equivalent()),
+                         choose_param(get_param(params, number_of_threads_t()),
+                                      std::size_t(1))
                          );
 
   }
@@ -10,6 +10,7 @@
 //
 //
 // Revision History:
+//   18 October 2026: Stored the list links of each value together.
 //   13 June 2001: Changed some names for clarity. (Jeremy Siek)
 //   01 April 2001: Modified to use new <boost/limits.hpp> header. (JMaddock)
 //
@@ -34,22 +35,21 @@ namespace boost {
                   const Bucket& _bucket = Bucket(), 
                   const ValueIndexMap& _id = ValueIndexMap()) 
       : head(_max_bucket, invalid_value()),
-        next(_length, invalid_value()), 
-        prev(_length, invalid_value()),
+        links(_length, link()),
         id_to_value(_length),
         bucket(_bucket), id(_id) { }
     
     void remove(const value_type& x) {
       const size_type i = get(id, x);
-      const size_type& next_node = next[i];
-      const size_type& prev_node = prev[i];
+      const size_type next_node = links[i].next;
+      const size_type prev_node = links[i].prev;
     
       //check if i is the end of the bucket list 
       if ( next_node != invalid_value() )
-        prev[next_node] = prev_node; 
+        links[next_node].prev = prev_node; 
       //check if i is the begin of the bucket list
       if ( prev_node != invalid_value() )
-        next[prev_node] = next_node;
+        links[prev_node].next = next_node;
       else //need update head of current bucket list
         head[ bucket[x] ] = next_node;
     }
@@ -70,7 +70,15 @@ namespace boost {
       return (std::numeric_limits<size_type>::max)();
     }
     
+    // the neighbors of a value in its bucket list, together so that
+    // moving a value touches as few cache lines as possible
+    struct link {
+      link() : next(invalid_value()), prev(invalid_value()) { }
+      size_type next, prev;
+    };
+
     typedef typename std::vector<size_type>::iterator Iter;
+    typedef typename std::vector<link>::iterator LinkIter;
     typedef typename std::vector<value_type>::iterator IndexValueMap;
     
   public:
@@ -78,30 +86,30 @@ namespace boost {
 
     class stack {
     public:
-      stack(bucket_type _bucket_id, Iter h, Iter n, Iter p, IndexValueMap v,
+      stack(bucket_type _bucket_id, Iter h, LinkIter l, IndexValueMap v,
             const ValueIndexMap& _id)
-      : bucket_id(_bucket_id), head(h), next(n), prev(p), value(v), id(_id) {}
+      : bucket_id(_bucket_id), head(h), links(l), value(v), id(_id) {}
 
       // Avoid using default arg for ValueIndexMap so that the default
       // constructor of the ValueIndexMap is not required if not used.
-      stack(bucket_type _bucket_id, Iter h, Iter n, Iter p, IndexValueMap v)
-        : bucket_id(_bucket_id), head(h), next(n), prev(p), value(v) {}
+      stack(bucket_type _bucket_id, Iter h, LinkIter l, IndexValueMap v)
+        : bucket_id(_bucket_id), head(h), links(l), value(v) {}
       
       void push(const value_type& x) {
         const size_type new_head = get(id, x);
         const size_type current = head[bucket_id];
         if ( current != invalid_value() )
-          prev[current] = new_head;
-        prev[new_head] = invalid_value();
-        next[new_head] = current;
+          links[current].prev = new_head;
+        links[new_head].prev = invalid_value();
+        links[new_head].next = current;
         head[bucket_id] = new_head;
       }
       void pop() {
         size_type current = head[bucket_id];
-        size_type next_node = next[current];
+        size_type next_node = links[current].next;
         head[bucket_id] = next_node;
         if ( next_node != invalid_value() )
-          prev[next_node] = invalid_value();
+          links[next_node].prev = invalid_value();
       }
       value_type& top() { return value[ head[bucket_id] ]; }
       const value_type& top() const { return value[ head[bucket_id] ]; }
@@ -109,21 +117,18 @@ namespace boost {
     private:
       bucket_type bucket_id;
       Iter head;
-      Iter next;
-      Iter prev;
+      LinkIter links;
       IndexValueMap value;
       ValueIndexMap id;
     };
     
     stack operator[](const bucket_type& i) {
       assert(i < head.size());
-      return stack(i, head.begin(), next.begin(), prev.begin(),
-                   id_to_value.begin(), id);
+      return stack(i, head.begin(), links.begin(), id_to_value.begin(), id);
     }
   protected:
     std::vector<size_type>   head;
-    std::vector<size_type>   next;
-    std::vector<size_type>   prev;
+    std::vector<link>        links;
     std::vector<value_type>  id_to_value;
     Bucket bucket;
     ValueIndexMap id;
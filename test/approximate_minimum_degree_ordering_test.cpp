@@ -0,0 +1,225 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that approximate_minimum_degree_ordering returns a permutation
+// with its inverse and consistent supernodes, and that its fill on
+// meshes and random graphs is close to that of minimum_degree_ordering
+// and well below that of the natural order.
+
+#include <boost/graph/approximate_minimum_degree_ordering.hpp>
+#include <boost/graph/minimum_degree_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+// minimum_degree_ordering wants both directions of each edge.
+typedef adjacency_list<vecS, vecS, directedS> Graph;
+typedef adjacency_list<vecS, vecS, undirectedS> Undirected;
+typedef property_map<Graph, vertex_index_t>::type IndexMap;
+
+void add_pair(Graph& g, std::size_t u, std::size_t v)
+{
+  add_edge(u, v, g);
+  add_edge(v, u, g);
+}
+
+// A nx by ny by nz mesh where each vertex is adjacent to the 8 (in 2D)
+// or 26 (in 3D) vertices around it.
+Graph mesh(int nx, int ny, int nz)
+{
+  Graph g(nx * ny * nz);
+  for (int x = 0; x < nx; ++x)
+    for (int y = 0; y < ny; ++y)
+      for (int z = 0; z < nz; ++z)
+        for (int dx = -1; dx <= 1; ++dx)
+          for (int dy = -1; dy <= 1; ++dy)
+            for (int dz = -1; dz <= 1; ++dz) {
+              int x2 = x + dx, y2 = y + dy, z2 = z + dz;
+              int u = (x * ny + y) * nz + z, v = (x2 * ny + y2) * nz + z2;
+              if (x2 >= 0 && x2 < nx && y2 >= 0 && y2 < ny && z2 >= 0
+                  && z2 < nz && u < v)
+                add_pair(g, u, v);
+            }
+  return g;
+}
+
+// Both directions of each edge of a simple random graph.
+Graph random_graph(std::size_t n, std::size_t m, minstd_rand& gen)
+{
+  Undirected u;
+  generate_random_graph(u, n, m, gen, false, false);
+  Graph g(n);
+  graph_traits<Undirected>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(u); ei != ei_end; ++ei)
+    add_pair(g, source(*ei, u), target(*ei, u));
+  return g;
+}
+
+// The number of nonzeros of the Cholesky factor of the matrix of g,
+// permuted so that vertex v is in position inverse_perm[v], from the
+// elimination tree and the row subtrees.
+template <typename G>
+std::size_t cholesky_nonzeros(const G& g, const std::vector<int>& inverse_perm)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<int> perm(n), parent(n, -1), ancestor(n, -1), mark(n, -1);
+  for (std::size_t v = 0; v < n; ++v)
+    perm[inverse_perm[v]] = v;
+  typename graph_traits<G>::adjacency_iterator ai, ai_end;
+  for (std::size_t k = 0; k < n; ++k)
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j != -1 && j < int(k);) {
+        int next = ancestor[j];
+        ancestor[j] = k;
+        if (next == -1)
+          parent[j] = k;
+        j = next;
+      }
+  std::size_t count = n;
+  for (std::size_t k = 0; k < n; ++k) {
+    mark[k] = k;
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j < int(k) && mark[j] != int(k); j = parent[j]) {
+        mark[j] = k;
+        ++count;
+      }
+  }
+  return count;
+}
+
+// Checks the outputs, and returns the inverse permutation.
+template <typename G>
+std::vector<int> check_amd(const G& g)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<int> inverse_perm(n, -1), perm(n, -1), supernode_size(n, 0),
+    degree(n, 0);
+  typename property_map<G, vertex_index_t>::const_type id = get(vertex_index, g);
+  approximate_minimum_degree_ordering
+    (g, make_iterator_property_map(degree.begin(), id, degree[0]),
+     &inverse_perm[0], &perm[0],
+     make_iterator_property_map(supernode_size.begin(), id, supernode_size[0]),
+     id);
+
+  for (std::size_t v = 0; v < n; ++v) {
+    BOOST_CHECK(inverse_perm[v] >= 0 && inverse_perm[v] < int(n));
+    BOOST_CHECK(perm[inverse_perm[v]] == int(v));
+  }
+  // the vertices of a supernode have consecutive positions
+  int total = 0;
+  for (std::size_t v = 0; v < n; ++v) {
+    int size = supernode_size[v];
+    if (size <= 0) {
+      BOOST_CHECK(supernode_size[-size] > 0);
+      continue;
+    }
+    total += size;
+    int lo = inverse_perm[v], hi = lo;
+    for (std::size_t u = 0; u < n; ++u)
+      if (supernode_size[u] <= 0 && -supernode_size[u] == int(v)) {
+        lo = (std::min)(lo, inverse_perm[u]);
+        hi = (std::max)(hi, inverse_perm[u]);
+      }
+    BOOST_CHECK(hi - lo + 1 == size);
+  }
+  BOOST_CHECK(total == int(n));
+  return inverse_perm;
+}
+
+// minimum_degree_ordering removes edges from its graph, so it is given
+// a copy.
+std::size_t mmd_fill(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  Graph work = g;
+  std::vector<int> inverse_perm(n), perm(n), supernode_size(n, 1), degree(n, 0);
+  IndexMap id = get(vertex_index, work);
+  minimum_degree_ordering
+    (work, make_iterator_property_map(degree.begin(), id, degree[0]),
+     &inverse_perm[0], &perm[0],
+     make_iterator_property_map(supernode_size.begin(), id, supernode_size[0]),
+     0, id);
+  return cholesky_nonzeros(g, inverse_perm);
+}
+
+std::size_t natural_fill(const Graph& g)
+{
+  std::vector<int> identity(num_vertices(g));
+  for (std::size_t v = 0; v < identity.size(); ++v)
+    identity[v] = v;
+  return cholesky_nonzeros(g, identity);
+}
+
+// test/minimum_degree_performance.cpp prints the fills that are compared.
+void compare(const Graph& g)
+{
+  std::size_t amd = cholesky_nonzeros(g, check_amd(g)), mmd = mmd_fill(g), natural = natural_fill(g);
+  BOOST_CHECK(amd * 4 <= mmd * 5);
+  BOOST_CHECK(amd <= natural);
+}
+
+int test_main(int, char*[])
+{
+  // trivial graphs, and a path whose fill is none
+  check_amd(Graph());
+  check_amd(Graph(1));
+  BOOST_CHECK(cholesky_nonzeros(Graph(5), check_amd(Graph(5))) == 5);
+  Graph path(30);
+  for (std::size_t v = 0; v + 1 < 30; ++v)
+    add_pair(path, v, v + 1);
+  BOOST_CHECK(cholesky_nonzeros(path, check_amd(path)) == 59);
+
+  // a complete graph is a single supernode
+  Graph complete(12);
+  for (std::size_t u = 0; u < 12; ++u)
+    for (std::size_t v = u + 1; v < 12; ++v)
+      add_pair(complete, u, v);
+  BOOST_CHECK(cholesky_nonzeros(complete, check_amd(complete)) == 12 * 13 / 2);
+
+  // parallel edges and self-loops are ignored, and one direction of each
+  // edge or an undirected graph give the symmetric matrix
+  minstd_rand gen(1);
+  Graph g = random_graph(200, 500, gen), one_way(200), messy(200);
+  Undirected undirected(200);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (source(*ei, g) < target(*ei, g)) {
+      add_edge(source(*ei, g), target(*ei, g), one_way);
+      add_edge(source(*ei, g), target(*ei, g), messy);
+      add_edge(source(*ei, g), target(*ei, g), messy);
+      add_edge(source(*ei, g), source(*ei, g), messy);
+      add_edge(source(*ei, g), target(*ei, g), undirected);
+    }
+  BOOST_CHECK(check_amd(messy) == check_amd(one_way));
+  std::size_t fill = cholesky_nonzeros(g, check_amd(g));
+  BOOST_CHECK(cholesky_nonzeros(g, check_amd(one_way)) * 4 <= fill * 5);
+  BOOST_CHECK(cholesky_nonzeros(g, check_amd(undirected)) * 4 <= fill * 5);
+
+  // a vertex adjacent to all others is postponed to the end
+  Graph grid = mesh(40, 40, 1), hub = grid;
+  add_vertex(hub);
+  for (std::size_t v = 0; v < 1600; ++v)
+    add_pair(hub, v, 1600);
+  check_amd(hub);
+  std::vector<int> inverse_perm(1601), perm(1601), sizes(1601), degree(1601);
+  approximate_minimum_degree_ordering(hub, &degree[0], &inverse_perm[0],
+                                      &perm[0], &sizes[0],
+                                      get(vertex_index, hub));
+  BOOST_CHECK(perm[1600] == 1600 && sizes[1600] == 1 && degree[1600] == 1600);
+
+  Graph mesh3 = mesh(10, 10, 10);
+  compare(grid);
+  compare(mesh3);
+  for (int i = 0; i < 20; ++i)
+    compare(random_graph(100 + 20 * i, 3 * (100 + 20 * i), gen));
+  return 0;
+}
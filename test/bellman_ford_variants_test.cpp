@@ -0,0 +1,112 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares bellman_ford_shortest_paths_fifo and
+// bellman_ford_shortest_paths_parallel with the classic edge sweep.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/bellman_ford_shortest_paths.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+  property<edge_weight_t, int> > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+// The predecessor maps may legitimately differ when there are ties, so
+// only check that they describe shortest paths.
+bool check_predecessors(const Graph& g, const std::vector<int>& d,
+                        const std::vector<Vertex>& p, Vertex s)
+{
+  const int inf = (std::numeric_limits<int>::max)();
+  for (std::size_t v = 0; v < num_vertices(g); ++v) {
+    if (v == s || d[v] == inf)
+      continue;
+    Graph::edge_descriptor e; bool found;
+    boost::tie(e, found) = edge(p[v], v, g);
+    if (!found || d[p[v]] + get(edge_weight, g, e) != d[v])
+      return false;
+  }
+  return true;
+}
+
+void test_random_graph(std::size_t n, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  Graph g;
+  generate_random_graph(g, n, m, gen, false, false);
+
+  // Weights w(u,v) + p(u) - p(v) with w >= 0 give negative edges but no
+  // negative cycles.
+  uniform_int<int> weight_dist(0, 40), potential_dist(0, 25);
+  variate_generator<minstd_rand&, uniform_int<int> >
+    random_weight(gen, weight_dist), random_potential(gen, potential_dist);
+  std::vector<int> pot(n);
+  for (std::size_t i = 0; i < n; ++i)
+    pot[i] = random_potential();
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    put(edge_weight, g, *ei,
+        random_weight() + pot[source(*ei, g)] - pot[target(*ei, g)]);
+
+  Vertex s = 0;
+  std::vector<int> d1(n), d2(n), d3(n);
+  std::vector<Vertex> p1(n), p2(n), p3(n);
+  BOOST_CHECK(bellman_ford_shortest_paths
+                (g, int(n), distance_map(&d1[0]).predecessor_map(&p1[0])
+                              .root_vertex(s)));
+  BOOST_CHECK(bellman_ford_shortest_paths_fifo
+                (g, s, distance_map(&d2[0]).predecessor_map(&p2[0])));
+  BOOST_CHECK(bellman_ford_shortest_paths_parallel
+                (g, int(n), distance_map(&d3[0]).predecessor_map(&p3[0])
+                              .root_vertex(s).number_of_threads(4)));
+  BOOST_CHECK(d1 == d2);
+  BOOST_CHECK(d1 == d3);
+  BOOST_CHECK(check_predecessors(g, d2, p2, s));
+  BOOST_CHECK(check_predecessors(g, d3, p3, s));
+
+  // Close a negative cycle reachable from s.
+  Vertex a = n / 2, b = n / 3;
+  add_edge(s, a, 0, g);
+  add_edge(a, b, -1000, g);
+  add_edge(b, a, 0, g);
+  BOOST_CHECK(!bellman_ford_shortest_paths_fifo
+                 (g, s, distance_map(&d2[0])));
+  BOOST_CHECK(!bellman_ford_shortest_paths_parallel
+                 (g, int(n), distance_map(&d3[0]).root_vertex(s)
+                               .number_of_threads(3)));
+}
+
+int test_main(int, char*[])
+{
+  test_random_graph(50, 300, 1);
+  test_random_graph(400, 4000, 2);
+  test_random_graph(1000, 2000, 3);
+
+  // A negative self loop is a cycle too.
+  Graph g(2);
+  add_edge(0, 1, 3, g);
+  add_edge(1, 1, -1, g);
+  std::vector<int> d(2);
+  BOOST_CHECK(!bellman_ford_shortest_paths_fifo(g, 0, distance_map(&d[0])));
+
+  // Unreachable vertices keep the infinite distance.
+  Graph h(3);
+  add_edge(0, 1, -2, h);
+  std::vector<int> dh(3);
+  BOOST_CHECK(bellman_ford_shortest_paths_fifo(h, 0, distance_map(&dh[0])));
+  BOOST_CHECK(dh[1] == -2);
+  BOOST_CHECK(dh[2] == (std::numeric_limits<int>::max)());
+  return 0;
+}
@@ -0,0 +1,142 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks hopcroft_karp_maximum_cardinality_matching and the partition map
+// overloads of edmonds_maximum_cardinality_matching against the blossom
+// algorithm, and karp_sipser_matching on one and several threads.
+
+#include <boost/graph/max_cardinality_matching.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/bipartite.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::vector<Vertex> Mates;
+typedef std::vector<default_color_type> Partition;
+
+// A random bipartite graph with a white vertices (0 .. a-1) and b black
+// ones.  Low-degree vertices and chains give the Karp-Sipser rule work.
+void random_bipartite(Graph& g, Partition& partition, std::size_t a,
+                      std::size_t b, std::size_t m, minstd_rand& gen)
+{
+  g = Graph(a + b);
+  partition.assign(a + b, color_traits<default_color_type>::black());
+  for (std::size_t i = 0; i < a; ++i)
+    partition[i] = color_traits<default_color_type>::white();
+  uniform_int<std::size_t> left(0, a - 1), right(a, a + b - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_left(gen, left), random_right(gen, right);
+  for (std::size_t i = 0; i < m; ++i)
+    add_edge(random_left(), random_right(), g);
+  for (std::size_t i = 0; i + 1 < (std::min)(a, b); i += 7)
+    add_edge(i, a + i + 1, g);
+}
+
+// mate must be a matching of edges of g.
+bool valid_matching(const Graph& g, const Mates& mate)
+{
+  for (std::size_t v = 0; v < num_vertices(g); ++v) {
+    Vertex u = mate[v];
+    if (u == graph_traits<Graph>::null_vertex())
+      continue;
+    if (u == v || mate[u] != v || !edge(v, u, g).second)
+      return false;
+  }
+  return true;
+}
+
+void test_graph(std::size_t a, std::size_t b, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  Graph g;
+  Partition partition;
+  random_bipartite(g, partition, a, b, m, gen);
+  const std::size_t n = num_vertices(g);
+  property_map<Graph, vertex_index_t>::type vm = get(vertex_index, g);
+  iterator_property_map<Partition::iterator, property_map<Graph, vertex_index_t>::type>
+    part(partition.begin(), vm);
+
+  Mates blossom(n), hk(n), dispatched(n), checked(n);
+  edmonds_maximum_cardinality_matching(g, &blossom[0]);
+  const std::size_t expected = matching_size(g, &blossom[0]);
+
+  hopcroft_karp_maximum_cardinality_matching(g, &hk[0], vm, part);
+  BOOST_CHECK(valid_matching(g, hk));
+  BOOST_CHECK(matching_size(g, &hk[0]) == expected);
+
+  edmonds_maximum_cardinality_matching(g, &dispatched[0], vm, part);
+  BOOST_CHECK(dispatched == hk);
+  BOOST_CHECK(checked_edmonds_maximum_cardinality_matching(g, &checked[0], vm, part));
+
+  // The partition found by is_bipartite works as well.
+  Partition found(n);
+  iterator_property_map<Partition::iterator, property_map<Graph, vertex_index_t>::type>
+    found_map(found.begin(), vm);
+  BOOST_CHECK(is_bipartite(g, vm, found_map));
+  Mates hk2(n);
+  hopcroft_karp_maximum_cardinality_matching(g, &hk2[0], vm, found_map, 4);
+  BOOST_CHECK(valid_matching(g, hk2));
+  BOOST_CHECK(matching_size(g, &hk2[0]) == expected);
+
+  // The initial matchings are valid and maximal.
+  for (std::size_t threads = 1; threads <= 4; threads += 3) {
+    Mates ks(n);
+    karp_sipser_matching<Graph, Vertex*>::find_matching(g, &ks[0], vm, threads);
+    BOOST_CHECK(valid_matching(g, ks));
+    BOOST_CHECK(matching_size(g, &ks[0]) <= expected);
+    graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      BOOST_CHECK(ks[source(*ei, g)] != graph_traits<Graph>::null_vertex()
+                  || ks[target(*ei, g)] != graph_traits<Graph>::null_vertex());
+  }
+}
+
+// The Karp-Sipser matching on a general graph plugs into the blossom
+// algorithm as its initial matching.
+void test_general(std::size_t n, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> dist(0, n - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> > random_vertex(gen, dist);
+  Graph g(n);
+  for (std::size_t i = 0; i < m; ++i)
+    add_edge(random_vertex(), random_vertex(), g);
+
+  Mates expected(n), ks(n), parallel(n);
+  edmonds_maximum_cardinality_matching(g, &expected[0]);
+  BOOST_CHECK((matching<Graph, Vertex*, property_map<Graph, vertex_index_t>::type,
+               edmonds_augmenting_path_finder, karp_sipser_matching,
+               maximum_cardinality_matching_verifier>
+               (g, &ks[0], get(vertex_index, g))));
+  BOOST_CHECK(matching_size(g, &ks[0]) == matching_size(g, &expected[0]));
+  parallel_karp_sipser_matching<Graph, Vertex*>::find_matching(g, &parallel[0]);
+  BOOST_CHECK(valid_matching(g, parallel));
+}
+
+int test_main(int, char*[])
+{
+  test_graph(1, 1, 1, 1);
+  test_graph(5, 3, 6, 2);
+  for (int seed = 0; seed < 20; ++seed) {
+    test_graph(40, 40, 60, seed);
+    test_graph(60, 30, 200, seed);
+  }
+  test_graph(3000, 2500, 6000, 7);
+  test_graph(6000, 6000, 40000, 8);
+  test_general(1, 0, 1);
+  for (int seed = 0; seed < 10; ++seed)
+    test_general(200, 300, seed);
+  return 0;
+}
@@ -0,0 +1,200 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks boykov_kolmogorov_max_flow_solver on a sequence of segmentation-like
+// grid problems whose capacities change between runs against a fresh
+// boykov_kolmogorov_max_flow() on the same capacities.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/boykov_kolmogorov_max_flow.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list_traits<vecS, vecS, directedS> Traits;
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+  property<edge_capacity_t, long,
+  property<edge_residual_capacity_t, long,
+  property<edge_reverse_t, Traits::edge_descriptor> > > > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef graph_traits<Graph>::edge_descriptor Edge;
+
+typedef boykov_kolmogorov_max_flow_solver<
+  Graph,
+  property_map<Graph, edge_capacity_t>::type,
+  property_map<Graph, edge_residual_capacity_t>::type,
+  property_map<Graph, edge_reverse_t>::type,
+  Edge*, default_color_type*, long*,
+  property_map<Graph, vertex_index_t>::type> Solver;
+
+enum arc_kind { neighbor_arc, source_arc, sink_arc, reverse_arc };
+
+// The arcs in the order they were added, so that two graphs built the same
+// way can be matched up.
+struct network
+{
+  Graph g;
+  std::vector<Edge> arcs;
+
+  void add_arc(Vertex u, Vertex v, long cap, long rev_cap)
+  {
+    Edge e = add_edge(u, v, g).first, r = add_edge(v, u, g).first;
+    put(edge_capacity, g, e, cap);
+    put(edge_capacity, g, r, rev_cap);
+    put(edge_reverse, g, e, r);
+    put(edge_reverse, g, r, e);
+    arcs.push_back(e);
+    arcs.push_back(r);
+  }
+};
+
+// A w x h grid with source w*h and sink w*h+1; kinds[i] tells what arcs[i]
+// is.  Some pixels only have a source arc.
+void make_grid(network& n, std::vector<arc_kind>& kinds, std::size_t w,
+               std::size_t h, minstd_rand& gen)
+{
+  uniform_int<long> cap_dist(0, 12);
+  variate_generator<minstd_rand&, uniform_int<long> > cap(gen, cap_dist);
+  const Vertex s = w * h, t = w * h + 1;
+  n.g = Graph(w * h + 2);
+  n.arcs.clear();
+  kinds.clear();
+  for (std::size_t y = 0; y < h; ++y)
+    for (std::size_t x = 0; x < w; ++x) {
+      Vertex v = y * w + x;
+      if (x + 1 < w) {
+        n.add_arc(v, v + 1, cap(), cap());
+        kinds.push_back(neighbor_arc);
+        kinds.push_back(neighbor_arc);
+      }
+      if (y + 1 < h) {
+        n.add_arc(v, v + w, cap(), cap());
+        kinds.push_back(neighbor_arc);
+        kinds.push_back(neighbor_arc);
+      }
+      n.add_arc(s, v, cap(), 0);
+      kinds.push_back(source_arc);
+      kinds.push_back(reverse_arc);
+      if ((x + y) % 7 != 0) {
+        n.add_arc(v, t, cap(), 0);
+        kinds.push_back(sink_arc);
+        kinds.push_back(reverse_arc);
+      }
+    }
+  n.add_arc(s, t, 5, 0);
+  kinds.push_back(source_arc);
+  kinds.push_back(reverse_arc);
+}
+
+// The residual capacities must describe a feasible flow for the capacities
+// in the solver's graph.  Like the flow value, the residual capacities of
+// the reverses of terminal arcs are not maintained.
+void check_flow(const network& n, const std::vector<arc_kind>& kinds,
+                Vertex s, Vertex t)
+{
+  const Graph& g = n.g;
+  std::vector<long> balance(num_vertices(g), 0);
+  for (std::size_t i = 0; i < n.arcs.size(); ++i) {
+    Edge e = n.arcs[i];
+    long res = get(edge_residual_capacity, g, e);
+    BOOST_CHECK(res >= 0);
+    if (kinds[i] == reverse_arc || (kinds[i] == neighbor_arc && i % 2 == 1))
+      continue;
+    long flow = get(edge_capacity, g, e) - res;
+    if (kinds[i] == neighbor_arc) {
+      Edge r = get(edge_reverse, g, e);
+      BOOST_CHECK(res + get(edge_residual_capacity, g, r)
+                  == get(edge_capacity, g, e) + get(edge_capacity, g, r));
+    } else {
+      BOOST_CHECK(flow >= 0);
+    }
+    balance[source(e, g)] -= flow;
+    balance[target(e, g)] += flow;
+  }
+  for (std::size_t v = 0; v < num_vertices(g); ++v)
+    if (v != s && v != t)
+      BOOST_CHECK(balance[v] == 0);
+}
+
+void test_sequence(std::size_t w, std::size_t h, int seed)
+{
+  minstd_rand gen(seed);
+  network dyn, ref;
+  std::vector<arc_kind> kinds;
+  make_grid(dyn, kinds, w, h, gen);
+  minstd_rand same(seed);
+  make_grid(ref, kinds, w, h, same);
+  const Vertex s = w * h, t = w * h + 1;
+  const std::size_t nv = num_vertices(dyn.g), m = dyn.arcs.size();
+
+  // The capacities of the problem; the solver's may be larger.
+  std::vector<long> cap(m);
+  for (std::size_t i = 0; i < m; ++i)
+    cap[i] = get(edge_capacity, ref.g, ref.arcs[i]);
+
+  std::vector<Edge> pred(nv);
+  std::vector<default_color_type> color(nv);
+  std::vector<long> dist(nv);
+  Solver solver(dyn.g, get(edge_capacity, dyn.g),
+                get(edge_residual_capacity, dyn.g), get(edge_reverse, dyn.g),
+                &pred[0], &color[0], &dist[0], get(vertex_index, dyn.g),
+                s, t);
+
+  uniform_int<std::size_t> arc_dist(0, m - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_arc(gen, arc_dist);
+  uniform_int<long> cap_dist(0, 12);
+  variate_generator<minstd_rand&, uniform_int<long> >
+    random_cap(gen, cap_dist);
+
+  for (int round = 0; round < 25; ++round) {
+    // Mostly terminal changes; now and then a neighbor arc too, which
+    // may force a restart.
+    std::size_t changes = round == 0 ? 0 : 1 + random_arc() % (m / 8);
+    for (std::size_t c = 0; c < changes; ++c) {
+      std::size_t i = random_arc();
+      if (kinds[i] == reverse_arc
+          || (kinds[i] == neighbor_arc && random_arc() % 10 != 0))
+        continue;
+      long new_cap = random_cap();
+      solver.add_capacity(dyn.arcs[i], new_cap - cap[i]);
+      cap[i] = new_cap;
+      put(edge_capacity, ref.g, ref.arcs[i], new_cap);
+    }
+
+    long flow = solver.max_flow();
+    long expected = boykov_kolmogorov_max_flow
+      (ref.g, get(edge_capacity, ref.g), get(edge_residual_capacity, ref.g),
+       get(edge_reverse, ref.g), get(vertex_index, ref.g), s, t);
+    BOOST_CHECK(flow == expected);
+    check_flow(dyn, kinds, s, t);
+
+    // The color map is a cut of the same value.
+    long cut = 0;
+    for (std::size_t i = 0; i < m; ++i) {
+      Vertex u = source(dyn.arcs[i], dyn.g), v = target(dyn.arcs[i], dyn.g);
+      if (color[u] == color_traits<default_color_type>::black()
+          && color[v] != color_traits<default_color_type>::black())
+        cut += cap[i];
+    }
+    BOOST_CHECK(cut == flow);
+  }
+}
+
+int test_main(int, char*[])
+{
+  test_sequence(2, 2, 1);
+  test_sequence(10, 10, 2);
+  test_sequence(40, 30, 3);
+  test_sequence(64, 64, 4);
+  return 0;
+}
@@ -268,9 +268,11 @@ class boykov_kolmogorov_test
           //passive nodes in S or T
           if(v == tSuper::m_source || v == tSuper::m_sink)
             return;
-          typename std::list<tVertex>::const_iterator it = find(tSuper::m_orphans.begin(), tSuper::m_orphans.end(), v);
+          bool is_orphan = false;
+          for(std::size_t i = 0; i < tSuper::m_orphans.size(); ++i)
+            is_orphan = is_orphan || tSuper::m_orphans[i] == v;
           // a node is active, if its in the active_list AND (is has_a_parent, or its already in the orphans_list or its the sink, or its the source)
-          bool is_active = (tSuper::m_in_active_list_map[v] && (tSuper::has_parent(v) || it != tSuper::m_orphans.end() ));
+          bool is_active = (tSuper::m_in_active_list_map[v] && (tSuper::has_parent(v) || is_orphan));
           if(this->get_tree(v) != tColorTraits::gray() && !is_active){
             typename graph_traits<Graph>::out_edge_iterator ei,e_end;
             for(boost::tie(ei, e_end) = out_edges(v, tSuper::m_g); ei != e_end; ++ei){
@@ -0,0 +1,256 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks canonical_labeling by counting the isomorphism classes of all
+// small graphs, by relabeling random and highly symmetric graphs, and
+// checks canonical_isomorphism against isomorphism.
+
+#include <boost/graph/canonical_labeling.hpp>
+#include <boost/graph/isomorphism.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <set>
+#include <vector>
+#include <algorithm>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Undirected;
+typedef adjacency_list<vecS, vecS, bidirectionalS> Directed;
+typedef std::vector<std::size_t> Labels;
+
+// The color of each vertex, as a vertex invariant
+struct color_invariant {
+  typedef std::size_t result_type;
+  explicit color_invariant(const std::vector<int>& colors) : m_colors(&colors) {}
+  std::size_t operator()(std::size_t v) const { return (*m_colors)[v]; }
+  const std::vector<int>* m_colors;
+};
+
+// The graph on n vertices whose possible edges, in the order of pairs,
+// are present as given by the bits of mask.
+template <typename Graph>
+Graph graph_from_mask(std::size_t n, std::size_t mask)
+{
+  Graph g(n);
+  std::size_t bit = 0;
+  for (std::size_t u = 0; u < n; ++u)
+    for (std::size_t v = is_directed(g) ? 0 : u + 1; v < n; ++v)
+      if (u != v && ((mask >> bit++) & 1))
+        add_edge(u, v, g);
+  return g;
+}
+
+template <typename Graph>
+std::size_t count_classes(std::size_t n)
+{
+  const std::size_t pairs = is_directed(Graph()) ? n * (n - 1) : n * (n - 1) / 2;
+  std::set<graph_certificate> classes;
+  for (std::size_t mask = 0; mask < (std::size_t(1) << pairs); ++mask)
+    classes.insert(canonical_certificate(graph_from_mask<Graph>(n, mask)));
+  return classes.size();
+}
+
+template <typename Graph>
+Graph permuted(const Graph& g, const std::vector<std::size_t>& perm)
+{
+  Graph h(num_vertices(g));
+  typename graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    add_edge(perm[source(*ei, g)], perm[target(*ei, g)], h);
+  return h;
+}
+
+std::vector<std::size_t> random_permutation(std::size_t n, minstd_rand& gen)
+{
+  std::vector<std::size_t> perm(n);
+  for (std::size_t i = 0; i < n; ++i)
+    perm[i] = i;
+  for (std::size_t i = n; i > 1; --i) {
+    uniform_int<std::size_t> dist(0, i - 1);
+    std::swap(perm[i - 1], perm[dist(gen)]);
+  }
+  return perm;
+}
+
+// Whether f maps the edges of g onto those of h, with multiplicities.
+// (verify_isomorphism is sensitive to the orientation of undirected
+// edges.)
+template <typename Graph, typename IsoMap>
+bool maps_edges(const Graph& g, const Graph& h, const IsoMap& f)
+{
+  typedef std::pair<std::size_t, std::size_t> Edge;
+  std::vector<Edge> mapped, expected;
+  typename graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    Edge e(f[source(*ei, g)], f[target(*ei, g)]);
+    if (!is_directed(g) && e.second < e.first)
+      std::swap(e.first, e.second);
+    mapped.push_back(e);
+  }
+  for (boost::tie(ei, ei_end) = edges(h); ei != ei_end; ++ei) {
+    Edge e(source(*ei, h), target(*ei, h));
+    if (!is_directed(h) && e.second < e.first)
+      std::swap(e.first, e.second);
+    expected.push_back(e);
+  }
+  std::sort(mapped.begin(), mapped.end());
+  std::sort(expected.begin(), expected.end());
+  return mapped == expected;
+}
+
+// The canonical forms of g and of a relabeled copy are equal, and the
+// labelings give an isomorphism between them.
+template <typename Graph>
+void test_relabeled(const Graph& g, minstd_rand& gen)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<std::size_t> perm = random_permutation(n, gen);
+  Graph h = permuted(g, perm);
+
+  Labels lg(n), lh(n);
+  graph_certificate cg = canonical_labeling(g, &lg[0]);
+  graph_certificate ch = canonical_labeling(h, &lh[0]);
+  BOOST_CHECK(cg == ch);
+  BOOST_CHECK(cg.hash128() == ch.hash128());
+  BOOST_CHECK(hash_value(cg) == hash_value(ch));
+  BOOST_CHECK(cg.num_vertices() == n && cg.num_edges() == num_edges(g));
+
+  Labels sorted = lg;
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t i = 0; i < n; ++i)
+    BOOST_CHECK(sorted[i] == i);
+
+  std::vector<typename graph_traits<Graph>::vertex_descriptor> f(n);
+  BOOST_CHECK(canonical_isomorphism(g, h, &f[0]));
+  BOOST_CHECK(maps_edges(g, h, f));
+}
+
+template <typename Graph>
+Graph random_graph(std::size_t n, std::size_t m, bool loops, minstd_rand& gen)
+{
+  Graph g(n);
+  uniform_int<std::size_t> dist(0, n - 1);
+  for (std::size_t i = 0; i < m; ++i) {
+    std::size_t u = dist(gen), v = dist(gen);
+    if (u != v || loops)
+      add_edge(u, v, g);
+  }
+  return g;
+}
+
+Undirected petersen()
+{
+  Undirected g(10);
+  for (std::size_t i = 0; i < 5; ++i) {
+    add_edge(i, (i + 1) % 5, g);
+    add_edge(i, i + 5, g);
+    add_edge(i + 5, (i + 2) % 5 + 5, g);
+  }
+  return g;
+}
+
+Undirected hypercube(std::size_t d)
+{
+  Undirected g(std::size_t(1) << d);
+  for (std::size_t v = 0; v < num_vertices(g); ++v)
+    for (std::size_t k = 0; k < d; ++k)
+      if (v < (v ^ (std::size_t(1) << k)))
+        add_edge(v, v ^ (std::size_t(1) << k), g);
+  return g;
+}
+
+// Two graphs with the same degrees: a 6-cycle and two triangles
+void test_non_isomorphic()
+{
+  Undirected cycle(6), triangles(6);
+  for (std::size_t i = 0; i < 6; ++i)
+    add_edge(i, (i + 1) % 6, cycle);
+  for (std::size_t i = 0; i < 3; ++i) {
+    add_edge(i, (i + 1) % 3, triangles);
+    add_edge(3 + i, 3 + (i + 1) % 3, triangles);
+  }
+  BOOST_CHECK(canonical_certificate(cycle) != canonical_certificate(triangles));
+  std::vector<std::size_t> f(6);
+  BOOST_CHECK(!canonical_isomorphism(cycle, triangles, &f[0]));
+}
+
+// A path whose ends have different colors: the labeling must respect
+// the colors.
+void test_colors()
+{
+  Undirected path(4), reversed(4);
+  for (std::size_t i = 0; i + 1 < 4; ++i) {
+    add_edge(i, i + 1, path);
+    add_edge(i, i + 1, reversed);
+  }
+  std::vector<int> colors(4, 0), other(4, 0), swapped(4, 0);
+  colors[0] = 1;
+  other[1] = 1;
+  swapped[3] = 1;
+  Labels labels(4);
+  graph_certificate c = canonical_labeling(path, &labels[0],
+                                           get(vertex_index, path),
+                                           color_invariant(colors));
+  BOOST_CHECK(c == canonical_certificate(reversed,
+                     vertex_invariant(color_invariant(swapped))));
+  BOOST_CHECK(c != canonical_certificate(reversed,
+                     vertex_invariant(color_invariant(other))));
+  BOOST_CHECK(c != canonical_certificate(path));
+
+  std::vector<std::size_t> f(4);
+  BOOST_CHECK(canonical_isomorphism(path, reversed, &f[0],
+                                    vertex_invariant1(color_invariant(colors))
+                                    .vertex_invariant2(color_invariant(swapped))));
+  BOOST_CHECK(f[0] == 3 && f[1] == 2 && f[2] == 1 && f[3] == 0);
+}
+
+int test_main(int, char*[])
+{
+  // The numbers of graphs and digraphs up to isomorphism (OEIS A000088
+  // and A000273)
+  BOOST_CHECK(count_classes<Undirected>(1) == 1);
+  BOOST_CHECK(count_classes<Undirected>(4) == 11);
+  BOOST_CHECK(count_classes<Undirected>(5) == 34);
+  BOOST_CHECK(count_classes<Undirected>(6) == 156);
+  BOOST_CHECK(count_classes<Directed>(3) == 16);
+  BOOST_CHECK(count_classes<Directed>(4) == 218);
+
+  BOOST_CHECK(canonical_certificate(Undirected()).num_vertices() == 0);
+
+  minstd_rand gen(1);
+  for (int i = 0; i < 200; ++i) {
+    std::size_t n = 1 + i % 30;
+    test_relabeled(random_graph<Undirected>(n, i % 50, i % 3 == 0, gen), gen);
+    test_relabeled(random_graph<Directed>(n, i % 60, i % 3 == 0, gen), gen);
+  }
+  test_relabeled(petersen(), gen);
+  test_relabeled(hypercube(6), gen);
+  test_relabeled(Undirected(100), gen);
+  test_relabeled(random_graph<Undirected>(2000, 6000, false, gen), gen);
+
+  // Against isomorphism on random pairs with few edges, which are often
+  // isomorphic.
+  for (int i = 0; i < 300; ++i) {
+    std::size_t n = 2 + i % 7;
+    Undirected g = random_graph<Undirected>(n, n - 1, false, gen);
+    Undirected h = random_graph<Undirected>(n, n - 1, false, gen);
+    std::vector<std::size_t> f(n), f2(n);
+    bool iso = isomorphism(g, h, isomorphism_map(&f[0]));
+    BOOST_CHECK(canonical_isomorphism(g, h, &f2[0]) == iso);
+    if (iso)
+      BOOST_CHECK(maps_edges(g, h, f2));
+  }
+
+  test_non_isomorphic();
+  test_colors();
+  return 0;
+}
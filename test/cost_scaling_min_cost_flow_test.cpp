@@ -0,0 +1,229 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#define BOOST_TEST_MODULE cost_scaling_min_cost_flow_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/graph/cost_scaling_min_cost_flow.hpp>
+#include <boost/graph/cycle_canceling.hpp>
+#include <boost/graph/successive_shortest_path_nonnegative_weights.hpp>
+#include <boost/graph/edmonds_karp_max_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+
+#include "min_cost_max_flow_utils.hpp"
+
+
+BOOST_AUTO_TEST_CASE(cost_scaling_def_test) {
+    boost::SampleGraph::vertex_descriptor s,t;
+    boost::SampleGraph::Graph g;
+    boost::SampleGraph::getSampleGraph(g, s, t);
+
+    boost::edmonds_karp_max_flow(g, s, t);
+    boost::cost_scaling_min_cost_flow(g);
+
+    int cost = boost::find_flow_cost(g);
+    BOOST_CHECK_EQUAL(cost, 29);
+}
+
+BOOST_AUTO_TEST_CASE(cost_scaling_def_test2) {
+    boost::SampleGraph::vertex_descriptor s,t;
+    boost::SampleGraph::Graph g;
+    boost::SampleGraph::getSampleGraph2(g, s, t);
+
+    boost::edmonds_karp_max_flow(g, s, t);
+    boost::cost_scaling_min_cost_flow(g);
+
+    int cost = boost::find_flow_cost(g);
+    BOOST_CHECK_EQUAL(cost, 7);
+}
+
+BOOST_AUTO_TEST_CASE(cost_scaling_test) {
+    boost::SampleGraph::vertex_descriptor s,t;
+    typedef boost::SampleGraph::Graph Graph;
+    boost::SampleGraph::Graph g;
+    boost::SampleGraph::getSampleGraph(g, s, t);
+
+    int N = num_vertices(g);
+    std::vector<long> price(N);
+
+    boost::property_map<Graph, boost::vertex_index_t>::const_type idx = get(boost::vertex_index, g);
+
+    boost::push_relabel_max_flow(g, s, t);
+    boost::cost_scaling_min_cost_flow(g, boost::distance_map(boost::make_iterator_property_map(price.begin(), idx)).vertex_index_map(idx));
+
+    int cost = boost::find_flow_cost(g);
+    BOOST_CHECK_EQUAL(cost, 29);
+
+    // The prices certify optimality: no residual arc has a reduced cost
+    // below -1 / (n + 1) in the original units.
+    BGL_FORALL_EDGES(e, g, Graph) {
+        if (get(boost::edge_residual_capacity, g, e) > 0) {
+            long reduced = get(boost::edge_weight, g, e) * (N + 1)
+                + price[source(e, g)] - price[target(e, g)];
+            BOOST_CHECK(reduced >= -1);
+        }
+    }
+}
+
+namespace {
+
+typedef boost::SampleGraph::Graph Graph;
+typedef boost::SampleGraph::vertex_descriptor Vertex;
+
+// A random network on n vertices with costs in [min_cost, 20]; vertex 0 is
+// the source and n - 1 the sink.
+void random_network(Graph& g, std::size_t n, std::size_t m, long min_cost,
+                    boost::minstd_rand& gen) {
+    g = Graph(n);
+    boost::uniform_int<std::size_t> vertex_dist(0, n - 1);
+    boost::variate_generator<boost::minstd_rand&, boost::uniform_int<std::size_t> >
+        random_vertex(gen, vertex_dist);
+    boost::uniform_int<long> cost_dist(min_cost, 20), cap_dist(1, 15);
+    boost::variate_generator<boost::minstd_rand&, boost::uniform_int<long> >
+        random_cost(gen, cost_dist), random_cap(gen, cap_dist);
+    boost::SampleGraph::Weight weight = get(boost::edge_weight, g);
+    boost::SampleGraph::Capacity capacity = get(boost::edge_capacity, g);
+    boost::SampleGraph::Reversed rev = get(boost::edge_reverse, g);
+    boost::SampleGraph::ResidualCapacity residual = get(boost::edge_residual_capacity, g);
+    boost::SampleGraph::EdgeAdder ea(g, weight, capacity, rev, residual);
+    for (std::size_t i = 0; i < m; ++i) {
+        Vertex u = random_vertex(), v = random_vertex();
+        if (u != v && !edge(u, v, g).second && !edge(v, u, g).second)
+            ea.addEdge(u, v, random_cost(), random_cap());
+    }
+}
+
+// The net flow out of every vertex.
+std::vector<long> balances(const Graph& g) {
+    std::vector<long> b(num_vertices(g), 0);
+    BGL_FORALL_EDGES(e, g, Graph) {
+        long f = get(boost::edge_capacity, g, e) - get(boost::edge_residual_capacity, g, e);
+        BOOST_CHECK(get(boost::edge_residual_capacity, g, e) >= 0);
+        if (get(boost::edge_capacity, g, e) > 0) {
+            b[source(e, g)] += f;
+            b[target(e, g)] -= f;
+        }
+    }
+    return b;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(cost_scaling_random_test) {
+    boost::minstd_rand gen(42);
+    for (int round = 0; round < 200; ++round) {
+        std::size_t n = 2 + round % 40;
+        bool negative = round % 2 == 1;
+        Graph g1, g2;
+        boost::minstd_rand same = gen;
+        random_network(g1, n, 4 * n, negative ? -10 : 0, gen);
+        random_network(g2, n, 4 * n, negative ? -10 : 0, same);
+        Vertex s = 0, t = n - 1;
+
+        long cost;
+        if (negative) {
+            boost::edmonds_karp_max_flow(g1, s, t);
+            boost::cycle_canceling(g1);
+            cost = boost::find_flow_cost(g1);
+            boost::edmonds_karp_max_flow(g2, s, t);
+        } else {
+            boost::successive_shortest_path_nonnegative_weights(g1, s, t);
+            cost = boost::find_flow_cost(g1);
+            boost::push_relabel_max_flow(g2, s, t);
+        }
+        std::vector<long> before = balances(g2);
+        boost::cost_scaling_min_cost_flow(g2);
+        BOOST_CHECK(balances(g2) == before);
+        BOOST_CHECK(balances(g1) == before);
+        BOOST_CHECK_EQUAL(boost::find_flow_cost(g2), cost);
+    }
+}
+
+namespace {
+
+typedef boost::adjacency_list_traits<boost::vecS, boost::vecS,
+                                     boost::directedS> IntTraits;
+typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS,
+        boost::no_property,
+        boost::property<boost::edge_capacity_t, long,
+            boost::property<boost::edge_residual_capacity_t, long,
+                boost::property<boost::edge_reverse_t, IntTraits::edge_descriptor,
+                    boost::property<boost::edge_weight_t, int> > > > > IntGraph;
+
+void add_int_arc(IntGraph& g, std::size_t u, std::size_t v, int cost,
+                 long capacity) {
+    IntTraits::edge_descriptor e = add_edge(u, v, g).first;
+    IntTraits::edge_descriptor f = add_edge(v, u, g).first;
+    put(boost::edge_weight, g, e, cost);
+    put(boost::edge_weight, g, f, -cost);
+    put(boost::edge_capacity, g, e, capacity);
+    put(boost::edge_capacity, g, f, 0);
+    put(boost::edge_reverse, g, e, f);
+    put(boost::edge_reverse, g, f, e);
+}
+
+// A random network on n vertices with int costs of up to max_cost in
+// absolute value; vertex 0 is the source and n - 1 the sink.
+void random_int_network(IntGraph& g, std::size_t n, std::size_t m,
+                        int max_cost, boost::minstd_rand& gen) {
+    g = IntGraph(n);
+    boost::uniform_int<std::size_t> vertex_dist(0, n - 1);
+    boost::uniform_int<int> cost_dist(-max_cost, max_cost);
+    boost::uniform_int<long> cap_dist(1, 3);
+    for (std::size_t i = 0; i < m; ++i) {
+        std::size_t u = vertex_dist(gen), v = vertex_dist(gen);
+        if (u != v && !edge(u, v, g).second && !edge(v, u, g).second)
+            add_int_arc(g, u, v, cost_dist(gen), cap_dist(gen));
+    }
+}
+
+}
+
+// The scaled costs, max_cost (n + 1) n, do not fit an int, but the
+// prices are kept in boost::intmax_t.
+BOOST_AUTO_TEST_CASE(cost_scaling_int_limit_test) {
+    const std::size_t n = 60;
+    const int max_cost = 2000000;
+    BOOST_REQUIRE(double(max_cost) * (n + 1) * n
+                  > (std::numeric_limits<int>::max)());
+    boost::minstd_rand gen(7);
+    for (int round = 0; round < 10; ++round) {
+        IntGraph g1, g2;
+        boost::minstd_rand same = gen;
+        random_int_network(g1, n, 4 * n, max_cost, gen);
+        random_int_network(g2, n, 4 * n, max_cost, same);
+        boost::edmonds_karp_max_flow(g1, 0, n - 1);
+        boost::cycle_canceling(g1);
+        boost::edmonds_karp_max_flow(g2, 0, n - 1);
+        boost::cost_scaling_min_cost_flow(g2);
+        BOOST_CHECK_EQUAL(boost::find_flow_cost(g2), boost::find_flow_cost(g1));
+    }
+
+    // An int price map cannot hold such prices.
+    IntGraph g;
+    random_int_network(g, n, 4 * n, max_cost, gen);
+    boost::edmonds_karp_max_flow(g, 0, n - 1);
+    std::vector<int> price(n);
+    BOOST_CHECK_THROW(boost::cost_scaling_min_cost_flow(g,
+        boost::distance_map(&price[0])), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(cost_scaling_overflow_test) {
+    Graph g;
+    boost::minstd_rand gen(3);
+    random_network(g, 10, 40, 0, gen);
+    boost::SampleGraph::Weight weight = get(boost::edge_weight, g);
+    BGL_FORALL_EDGES(e, g, Graph)
+        put(weight, e, get(weight, e) * ((std::numeric_limits<long>::max)() / 400));
+    boost::push_relabel_max_flow(g, 0, 9);
+    BOOST_CHECK_THROW(boost::cost_scaling_min_cost_flow(g), std::overflow_error);
+}
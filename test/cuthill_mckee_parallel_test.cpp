@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that cuthill_mckee_ordering_parallel() and
+// find_starting_node_parallel() give the results of their serial
+// counterparts on 1, 4 and all hardware threads, on meshes, random,
+// disconnected and degenerate graphs.
+
+#include <boost/graph/cuthill_mckee_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <deque>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef adjacency_list<listS, listS, undirectedS,
+                       property<vertex_index_t, std::size_t> > ListGraph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+Graph mesh(int nx, int ny)
+{
+  Graph g(nx * ny);
+  for (int x = 0; x < nx; ++x)
+    for (int y = 0; y < ny; ++y) {
+      if (x + 1 < nx)
+        add_edge(x * ny + y, (x + 1) * ny + y, g);
+      if (y + 1 < ny)
+        add_edge(x * ny + y, x * ny + y + 1, g);
+    }
+  return g;
+}
+
+// Many vertices of equal degree, and parallel edges and self-loops when
+// m is large.
+template <typename G>
+void check(const G& g)
+{
+  typedef typename graph_traits<G>::vertex_descriptor V;
+  std::vector<V> serial, parallel;
+  cuthill_mckee_ordering(g, std::back_inserter(serial));
+  BOOST_CHECK(serial.size() == num_vertices(g));
+  std::size_t threads[] = { 1, 4, 0 };
+  for (int t = 0; t < 3; ++t) {
+    parallel.clear();
+    cuthill_mckee_ordering_parallel(g, std::back_inserter(parallel),
+                                    get(vertex_index, g), threads[t]);
+    BOOST_CHECK(parallel == serial);
+  }
+  if (num_vertices(g) == 0)
+    return;
+
+  // a given starting vertex, and the starting node search alone
+  std::vector<default_color_type> colors(num_vertices(g));
+  iterator_property_map<default_color_type*,
+    typename property_map<G, vertex_index_t>::const_type>
+    color(&colors[0], get(vertex_index, g));
+  V s = *boost::next(vertices(g).first, num_vertices(g) / 2);
+  serial.clear();
+  cuthill_mckee_ordering(g, s, std::back_inserter(serial), color,
+                         make_out_degree_map(g));
+  parallel.clear();
+  cuthill_mckee_ordering_parallel(g, s, std::back_inserter(parallel),
+                                  make_out_degree_map(g),
+                                  get(vertex_index, g), 4);
+  BOOST_CHECK(parallel == serial);
+  BOOST_CHECK(find_starting_node_parallel(g, s, make_out_degree_map(g),
+                                          get(vertex_index, g), 4)
+              == find_starting_node(g, s, color, make_out_degree_map(g)));
+}
+
+int test_main(int, char*[])
+{
+  check(Graph());
+  check(Graph(1));
+  check(Graph(100));
+  check(mesh(1, 500));
+  check(mesh(60, 70));
+
+  minstd_rand gen(1);
+  Graph sparse, dense, loops;
+  generate_random_graph(sparse, 2000, 3000, gen, true, true);
+  check(sparse);
+  generate_random_graph(dense, 2000, 20000, gen, true, true);
+  check(dense);
+  generate_random_graph(loops, 50, 2000, gen, true, true);
+  check(loops);
+
+  // a star, whose center has a level of 999 children to sort
+  Graph star(1000);
+  for (std::size_t v = 1; v < 1000; ++v)
+    add_edge(0, v, star);
+  check(star);
+
+  // several components, one of them a mesh
+  Graph pieces = mesh(30, 30);
+  for (std::size_t v = 0; v < 200; ++v)
+    add_vertex(pieces);
+  for (std::size_t v = 900; v + 1 < 1100; ++v)
+    if (v % 40 != 39)
+      add_edge(v, v + 1, pieces);
+  check(pieces);
+
+  // vertex descriptors that are not indices
+  ListGraph list(300);
+  std::vector<graph_traits<ListGraph>::vertex_descriptor>
+    vs(vertices(list).first, vertices(list).second);
+  for (std::size_t v = 0; v < 300; ++v) {
+    put(vertex_index, list, vs[v], v);
+    add_edge(vs[v], vs[(v * 7 + 3) % 300], list);
+    add_edge(vs[v], vs[(v * 13 + 5) % 300], list);
+  }
+  check(list);
+  return 0;
+}
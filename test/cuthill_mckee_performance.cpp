@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times cuthill_mckee_ordering against cuthill_mckee_ordering_parallel
+// on one and several threads, on a 3D 7-point mesh and a random graph,
+// and checks that the orderings are the same.
+//
+// usage: cuthill_mckee_performance [mesh size [threads]]
+
+#include <boost/graph/cuthill_mckee_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/bandwidth.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+Graph mesh(int n)
+{
+  Graph g(n * n * n);
+  for (int x = 0; x < n; ++x)
+    for (int y = 0; y < n; ++y)
+      for (int z = 0; z < n; ++z) {
+        int v = (x * n + y) * n + z;
+        if (x + 1 < n)
+          add_edge(v, v + n * n, g);
+        if (y + 1 < n)
+          add_edge(v, v + n, g);
+        if (z + 1 < n)
+          add_edge(v, v + 1, g);
+      }
+  return g;
+}
+
+void run(const Graph& g, const char* name, std::size_t threads)
+{
+  const std::size_t n = num_vertices(g);
+  std::cout << name << ": " << n << " vertices, " << num_edges(g)
+            << " edges" << std::endl;
+
+  std::vector<Vertex> serial, one, parallel;
+  double start = now();
+  cuthill_mckee_ordering(g, std::back_inserter(serial));
+  double serial_time = now() - start;
+  start = now();
+  cuthill_mckee_ordering_parallel(g, std::back_inserter(one),
+                                  get(vertex_index, g), 1);
+  double one_time = now() - start;
+  start = now();
+  cuthill_mckee_ordering_parallel(g, std::back_inserter(parallel),
+                                  get(vertex_index, g), threads);
+  double parallel_time = now() - start;
+  BOOST_TEST(one == serial);
+  BOOST_TEST(parallel == serial);
+
+  std::vector<std::size_t> perm(n);
+  for (std::size_t k = 0; k < n; ++k)
+    perm[serial[n - 1 - k]] = k;
+  std::cout << "  cuthill_mckee_ordering: " << serial_time
+            << " s, parallel on 1 thread: " << one_time << " s, on "
+            << threads << " threads: " << parallel_time
+            << " s, bandwidth " << bandwidth(g, &perm[0]) << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  int size = argc > 1 ? lexical_cast<int>(argv[1]) : 60;
+  std::size_t threads = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 4;
+
+  run(mesh(size), "3D 7-point mesh", threads);
+
+  minstd_rand gen(1);
+  const std::size_t n = size * size * size;
+  Graph random(n);
+  uniform_int<std::size_t> dist(0, n - 1);
+  for (std::size_t i = 0; i < 3 * n; ++i)
+    add_edge(dist(gen), dist(gen), random);
+  run(random, "random graph", threads);
+  return boost::report_errors();
+}
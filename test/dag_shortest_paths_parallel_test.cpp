@@ -0,0 +1,154 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks topological_sort_levels and dag_shortest_paths_parallel against
+// the DFS-based topological_sort and dag_shortest_paths.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/dag_shortest_paths.hpp>
+#include <boost/graph/topological_sort.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+  property<edge_weight_t, int> > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+// A wide random DAG: edges only go from lower to higher vertex numbers.
+void make_random_dag(Graph& g, std::size_t n, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> vertex_dist(0, n - 1);
+  uniform_int<int> weight_dist(-20, 50);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_vertex(gen, vertex_dist);
+  variate_generator<minstd_rand&, uniform_int<int> >
+    random_weight(gen, weight_dist);
+  g = Graph(n);
+  for (std::size_t i = 0; i < m; ++i) {
+    std::size_t a = random_vertex(), b = random_vertex();
+    if (a != b)
+      add_edge((std::min)(a, b), (std::max)(a, b), random_weight(), g);
+  }
+}
+
+// The graph may have parallel edges, so look at all of them.
+bool has_tight_edge(const Graph& g, Vertex u, Vertex v,
+                    const std::vector<int>& d)
+{
+  graph_traits<Graph>::out_edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+    if (target(*ei, g) == v && d[u] + get(edge_weight, g, *ei) == d[v])
+      return true;
+  return false;
+}
+
+void check_levels(const Graph& g, std::size_t threads)
+{
+  std::vector<Vertex> order;
+  std::vector<std::size_t> level(num_vertices(g));
+  std::size_t levels = topological_sort_levels
+    (g, std::back_inserter(order), &level[0],
+     number_of_threads(threads));
+  BOOST_CHECK(order.size() == num_vertices(g));
+
+  // Levels are contiguous, increasing, and every edge goes up a level.
+  for (std::size_t i = 1; i < order.size(); ++i)
+    BOOST_CHECK(level[order[i - 1]] <= level[order[i]]);
+  BOOST_CHECK(levels == (order.empty() ? 0 : level[order.back()] + 1));
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    BOOST_CHECK(level[source(*ei, g)] < level[target(*ei, g)]);
+
+  std::vector<Vertex> serial_order;
+  std::vector<std::size_t> serial_level(num_vertices(g));
+  topological_sort_levels(g, std::back_inserter(serial_order),
+                          &serial_level[0]);
+  BOOST_CHECK(order == serial_order);
+  BOOST_CHECK(level == serial_level);
+}
+
+void check_paths(const Graph& g, Vertex s, std::size_t threads)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<int> d1(n), d2(n);
+  std::vector<Vertex> p2(n);
+  dag_shortest_paths(g, s, distance_map(&d1[0]));
+  dag_shortest_paths_parallel(g, s, distance_map(&d2[0])
+                                      .predecessor_map(&p2[0])
+                                      .number_of_threads(threads));
+  BOOST_CHECK(d1 == d2);
+  for (std::size_t v = 0; v < n; ++v)
+    if (v != s && d2[v] != (std::numeric_limits<int>::max)())
+      BOOST_CHECK(has_tight_edge(g, p2[v], v, d2));
+
+  // Longest (critical) paths.
+  std::vector<int> l1(n), l2(n);
+  dag_shortest_paths(g, s, distance_map(&l1[0])
+                             .distance_compare(std::greater<int>())
+                             .distance_inf((std::numeric_limits<int>::min)())
+                             .distance_zero(0));
+  dag_shortest_paths_parallel(g, s, distance_map(&l2[0])
+                                      .distance_compare(std::greater<int>())
+                                      .distance_inf((std::numeric_limits<int>::min)())
+                                      .distance_zero(0)
+                                      .number_of_threads(threads));
+  BOOST_CHECK(l1 == l2);
+}
+
+int test_main(int, char*[])
+{
+  Graph g;
+  make_random_dag(g, 2000, 10000, 7);
+  for (std::size_t threads = 1; threads <= 4; ++threads) {
+    check_levels(g, threads);
+    check_paths(g, 0, threads);
+    check_paths(g, 700, threads);
+  }
+
+  // A cycle is rejected.
+  Graph c(3);
+  add_edge(0, 1, 1, c);
+  add_edge(1, 2, 1, c);
+  add_edge(2, 1, 1, c);
+  std::vector<Vertex> order;
+  std::vector<std::size_t> level(3);
+  bool thrown = false;
+  try {
+    topological_sort_levels(c, std::back_inserter(order), &level[0]);
+  } catch (not_a_dag&) {
+    thrown = true;
+  }
+  BOOST_CHECK(thrown);
+
+  // As for dag_shortest_paths, only the part reachable from s has to be
+  // acyclic: the cycle 1 -> 2 -> 1 is ignored from 3, but not from 0.
+  add_edge(3, 4, 5, c);
+  add_edge(0, 4, 1, c);
+  std::vector<int> d1(5), d2(5);
+  dag_shortest_paths(c, 3, distance_map(&d1[0]));
+  dag_shortest_paths_parallel(c, 3, distance_map(&d2[0])
+                                      .number_of_threads(2));
+  BOOST_CHECK(d1 == d2 && d2[4] == 5);
+  BOOST_CHECK(d2[0] == (std::numeric_limits<int>::max)());
+  thrown = false;
+  try {
+    dag_shortest_paths_parallel(c, 0, distance_map(&d2[0]));
+  } catch (not_a_dag&) {
+    thrown = true;
+  }
+  BOOST_CHECK(thrown);
+  return 0;
+}
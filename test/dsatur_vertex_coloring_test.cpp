@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that dsatur_vertex_coloring() gives valid colorings with at
+// most one color more than the largest degree, that it colors bipartite
+// graphs with two colors and complete graphs with one color per vertex,
+// and that it works with a vertex index map of a listS graph.
+
+#include <boost/graph/dsatur_vertex_coloring.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/test/minimal.hpp>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef graph_traits<Graph>::vertices_size_type size_type;
+
+// Colors g, checks that no edge but a self-loop joins two vertices of
+// the same color and that the colors are below the number returned,
+// which is at most the largest degree plus one, and returns it.
+size_type check(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<size_type> color(n);
+  size_type num_colors = dsatur_vertex_coloring
+    (g, make_iterator_property_map(color.begin(), get(vertex_index, g)));
+
+  std::size_t max_degree = 0;
+  for (std::size_t v = 0; v < n; ++v) {
+    BOOST_CHECK(color[v] < num_colors);
+    if (out_degree(v, g) > max_degree)
+      max_degree = out_degree(v, g);
+  }
+  BOOST_CHECK(num_colors <= max_degree + 1);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (source(*ei, g) != target(*ei, g))
+      BOOST_CHECK(color[source(*ei, g)] != color[target(*ei, g)]);
+  return num_colors;
+}
+
+int test_main(int, char*[])
+{
+  BOOST_CHECK(check(Graph()) == 0);
+  BOOST_CHECK(check(Graph(50)) == 1);
+
+  // even and odd cycles
+  Graph even(100), odd(101);
+  for (std::size_t v = 0; v < 100; ++v)
+    add_edge(v, (v + 1) % 100, even);
+  for (std::size_t v = 0; v < 101; ++v)
+    add_edge(v, (v + 1) % 101, odd);
+  BOOST_CHECK(check(even) == 2);
+  BOOST_CHECK(check(odd) == 3);
+
+  // a grid and a random tree, with a second component, are bipartite
+  Graph grid(30 * 40 + 10);
+  for (std::size_t x = 0; x < 30; ++x)
+    for (std::size_t y = 0; y < 40; ++y) {
+      if (x + 1 < 30)
+        add_edge(x * 40 + y, (x + 1) * 40 + y, grid);
+      if (y + 1 < 40)
+        add_edge(x * 40 + y, x * 40 + y + 1, grid);
+    }
+  for (std::size_t v = 30 * 40; v + 1 < 30 * 40 + 10; ++v)
+    add_edge(v, v + 1, grid);
+  BOOST_CHECK(check(grid) == 2);
+  minstd_rand gen(1);
+  Graph tree(3000);
+  for (std::size_t v = 1; v < 3000; ++v)
+    add_edge(v, uniform_int<std::size_t>(0, v - 1)(gen), tree);
+  BOOST_CHECK(check(tree) == 2);
+
+  // more colors than fit in a word
+  Graph complete(100);
+  for (std::size_t u = 0; u < 100; ++u)
+    for (std::size_t v = u + 1; v < 100; ++v)
+      add_edge(u, v, complete);
+  BOOST_CHECK(check(complete) == 100);
+
+  Graph sparse, dense, loops;
+  generate_random_graph(sparse, 5000, 20000, gen, true, true);
+  check(sparse);
+  generate_random_graph(dense, 20000, 200000, gen, true, true);
+  check(dense);
+  // parallel edges and self-loops
+  generate_random_graph(loops, 100, 3000, gen, true, true);
+  check(loops);
+
+  // a listS graph with an index map
+  typedef adjacency_list<listS, listS, undirectedS,
+                         property<vertex_index_t, std::size_t> > ListGraph;
+  ListGraph lg(5);
+  std::vector<graph_traits<ListGraph>::vertex_descriptor> vs;
+  graph_traits<ListGraph>::vertex_iterator vi, vi_end;
+  std::size_t i = 0;
+  for (boost::tie(vi, vi_end) = vertices(lg); vi != vi_end; ++vi, ++i) {
+    put(vertex_index, lg, *vi, i);
+    vs.push_back(*vi);
+  }
+  add_edge(vs[0], vs[1], lg);
+  add_edge(vs[1], vs[2], lg);
+  add_edge(vs[2], vs[0], lg);
+  add_edge(vs[2], vs[3], lg);
+  std::vector<size_type> color(5);
+  BOOST_CHECK(dsatur_vertex_coloring
+              (lg, make_iterator_property_map(color.begin(),
+                                              get(vertex_index, lg)),
+               get(vertex_index, lg)) == 3);
+  BOOST_CHECK(color[0] != color[1] && color[1] != color[2]
+              && color[2] != color[0] && color[2] != color[3]);
+  return 0;
+}
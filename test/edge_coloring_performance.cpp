@@ -0,0 +1,98 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times edge_coloring against edge_coloring_parallel on one and several
+// threads, on a random simple graph, and prints the number of colors of
+// each.
+//
+// usage: edge_coloring_performance [vertices [average degree [threads]]]
+
+#include <boost/graph/edge_coloring.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_index_t, std::size_t> > Graph;
+typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                              property_map<Graph, edge_index_t>::type>
+  ColorMap;
+
+// Whether no two edges of a vertex have the same color.
+bool proper(const Graph& g, const std::vector<std::size_t>& color)
+{
+  std::vector<std::size_t> seen;
+  graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+    seen.clear();
+    graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei)
+      seen.push_back(color[get(edge_index, g, *ei)]);
+    std::sort(seen.begin(), seen.end());
+    if (std::adjacent_find(seen.begin(), seen.end()) != seen.end())
+      return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 20;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 4;
+
+  // no self-loops or parallel edges
+  minstd_rand gen(1);
+  uniform_int<std::size_t> dist(0, n - 1);
+  std::vector<std::pair<std::size_t, std::size_t> > pairs;
+  for (std::size_t i = 0; i < n * degree / 2; ++i) {
+    std::size_t u = dist(gen), v = dist(gen);
+    if (u != v)
+      pairs.push_back(std::make_pair((std::min)(u, v), (std::max)(u, v)));
+  }
+  std::sort(pairs.begin(), pairs.end());
+  pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+  Graph g(n);
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    add_edge(pairs[i].first, pairs[i].second, i, g);
+  std::size_t max_degree = 0;
+  for (std::size_t v = 0; v < n; ++v)
+    max_degree = (std::max)(max_degree, std::size_t(out_degree(v, g)));
+  std::cout << "random graph: " << n << " vertices, " << num_edges(g)
+            << " edges, max degree " << max_degree << std::endl;
+
+  std::vector<std::size_t> color(num_edges(g));
+  ColorMap color_map(color.begin(), get(edge_index, g));
+
+  double start = now();
+  std::size_t colors = edge_coloring(g, color_map);
+  std::cout << "  edge_coloring: " << now() - start << " s, " << colors
+            << " colors" << std::endl;
+  BOOST_TEST(proper(g, color));
+
+  std::size_t runs[] = { 1, threads };
+  for (int r = 0; r < 2; ++r) {
+    start = now();
+    colors = edge_coloring_parallel(g, color_map, runs[r]);
+    std::cout << "  edge_coloring_parallel, " << runs[r] << " threads: "
+              << now() - start << " s, " << colors << " colors"
+              << std::endl;
+    BOOST_TEST(proper(g, color));
+    BOOST_TEST(colors <= max_degree + 1);
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,135 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that edge_coloring() and edge_coloring_parallel() on 1, 4 and
+// all hardware threads give valid colorings with at most max degree + 1
+// colors, on complete graphs, the Petersen graph, a grid and random
+// graphs.
+
+#include <boost/graph/edge_coloring.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/test/minimal.hpp>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_index_t, std::size_t> > Graph;
+typedef property_map<Graph, edge_index_t>::const_type EdgeIndexMap;
+typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                              EdgeIndexMap> ColorMap;
+
+void add(std::size_t u, std::size_t v, Graph& g)
+{
+  add_edge(u, v, num_edges(g), g);
+}
+
+// Checks that the edges of each vertex have distinct colors below
+// num_colors, and that num_colors is at most max degree + 1.
+void check_coloring(const Graph& g, const std::vector<std::size_t>& color,
+                    std::size_t num_colors)
+{
+  std::size_t max_degree = 0;
+  graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+    if (out_degree(*vi, g) > max_degree)
+      max_degree = out_degree(*vi, g);
+    std::set<std::size_t> colors;
+    graph_traits<Graph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei) {
+      std::size_t c = color[get(edge_index, g, *ei)];
+      BOOST_CHECK(c < num_colors);
+      BOOST_CHECK(colors.insert(c).second);
+    }
+  }
+  BOOST_CHECK(num_colors <= max_degree + 1);
+}
+
+// Returns the number of colors of edge_coloring().
+std::size_t check(const Graph& g)
+{
+  std::vector<std::size_t> color(num_edges(g));
+  ColorMap color_map(color.begin(), get(edge_index, g));
+  std::size_t num_colors = edge_coloring(g, color_map);
+  check_coloring(g, color, num_colors);
+
+  std::size_t threads[] = { 1, 4, 0 };
+  for (int t = 0; t < 3; ++t) {
+    std::fill(color.begin(), color.end(), 0);
+    check_coloring(g, color, edge_coloring_parallel(g, color_map,
+                                                    threads[t]));
+  }
+  return num_colors;
+}
+
+int test_main(int, char*[])
+{
+  check(Graph());
+  check(Graph(10));
+
+  // the graph of example/edge_coloring.cpp
+  Graph example(10);
+  std::size_t pairs[][2] = { {0, 3}, {0, 5}, {1, 2}, {1, 4}, {1, 6},
+                             {1, 9}, {2, 3}, {2, 4}, {3, 5}, {3, 8},
+                             {4, 6}, {5, 6}, {5, 7}, {6, 7} };
+  for (std::size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); ++i)
+    add(pairs[i][0], pairs[i][1], example);
+  check(example);
+
+  // from 5 vertices on, the greedy coloring of edge_coloring_parallel()
+  // leaves edges to the algorithm of Misra and Gries
+  for (std::size_t n = 2; n <= 12; ++n) {
+    Graph complete(n);
+    for (std::size_t u = 0; u < n; ++u)
+      for (std::size_t v = u + 1; v < n; ++v)
+        add(u, v, complete);
+    check(complete);
+  }
+
+  // the outer cycle, the spokes and the inner pentagram; it needs four
+  // colors
+  Graph petersen(10);
+  for (std::size_t i = 0; i < 5; ++i) {
+    add(i, (i + 1) % 5, petersen);
+    add(i, i + 5, petersen);
+    add(i + 5, (i + 2) % 5 + 5, petersen);
+  }
+  BOOST_CHECK(check(petersen) == 4);
+
+  // a bipartite grid
+  Graph grid(20 * 30);
+  for (std::size_t x = 0; x < 20; ++x)
+    for (std::size_t y = 0; y < 30; ++y) {
+      if (x + 1 < 20)
+        add(x * 30 + y, (x + 1) * 30 + y, grid);
+      if (y + 1 < 30)
+        add(x * 30 + y, x * 30 + y + 1, grid);
+    }
+  check(grid);
+
+  minstd_rand gen(1);
+  for (int k = 0; k < 4; ++k) {
+    std::size_t n = 50 + 500 * k;
+    Graph random(n);
+    std::set<std::pair<std::size_t, std::size_t> > added;
+    uniform_int<std::size_t> dist(0, n - 1);
+    for (std::size_t i = 0; i < 10 * n; ++i) {
+      std::size_t u = dist(gen), v = dist(gen);
+      if (u > v)
+        std::swap(u, v);
+      if (u != v && added.insert(std::make_pair(u, v)).second)
+        add(u, v, random);
+    }
+    check(random);
+  }
+  return 0;
+}
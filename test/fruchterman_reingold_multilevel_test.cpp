@@ -0,0 +1,192 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that barnes_hut_force_pairs approximates the repulsion of
+// all_force_pairs, in the plane and in space, that layouts with it do not
+// depend on the number of threads, and that
+// fruchterman_reingold_multilevel_layout() untangles a grid.
+
+#include <boost/graph/fruchterman_reingold_multilevel.hpp>
+#include <boost/graph/fruchterman_reingold.hpp>
+#include <boost/graph/random_layout.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef property_map<Graph, vertex_index_t>::type IndexMap;
+
+Graph grid(std::size_t width)
+{
+  Graph g(width * width);
+  for (std::size_t x = 0; x < width; ++x)
+    for (std::size_t y = 0; y < width; ++y) {
+      if (x + 1 < width)
+        add_edge(x * width + y, (x + 1) * width + y, g);
+      if (y + 1 < width)
+        add_edge(x * width + y, x * width + y + 1, g);
+    }
+  return g;
+}
+
+// Compares the repulsion summed by barnes_hut_force_pairs with the exact
+// one, returning the relative error.
+template<typename Topology>
+double repulsion_error(const Topology& topology, std::size_t n, double theta)
+{
+  typedef typename Topology::point_type Point;
+  typedef typename Topology::point_difference_type PointDiff;
+  typedef iterator_property_map<typename std::vector<Point>::iterator,
+                                IndexMap> PositionMap;
+  typedef iterator_property_map<typename std::vector<PointDiff>::iterator,
+                                IndexMap> DisplacementMap;
+  typedef detail::fr_apply_force<Topology, PositionMap, DisplacementMap,
+                                 square_distance_repulsive_force, Graph>
+    ApplyForce;
+
+  Graph g(n);
+  std::vector<Point> pos(n);
+  PositionMap position(pos.begin(), get(vertex_index, g));
+  random_graph_layout(g, position, topology);
+  double k = std::pow(topology.volume(topology.extent()) / n,
+                      1. / double(Point::dimensions));
+
+  std::vector<PointDiff> exact(n), approx(n);
+  all_force_pairs()(g, ApplyForce(topology, position,
+                                  DisplacementMap(exact.begin(),
+                                                  get(vertex_index, g)),
+                                  square_distance_repulsive_force(), k, g));
+  barnes_hut_force_pairs<Topology, PositionMap> barnes_hut(topology, position,
+                                                           theta, 4);
+  barnes_hut(g, ApplyForce(topology, position,
+                           DisplacementMap(approx.begin(),
+                                           get(vertex_index, g)),
+                           square_distance_repulsive_force(), k, g));
+
+  double error = 0., norm = 0.;
+  for (std::size_t i = 0; i < n; ++i) {
+    error += topology.norm(exact[i] - approx[i]);
+    norm += topology.norm(exact[i]);
+  }
+  return error / norm;
+}
+
+// Positive, negative or zero as c is left of, right of or on the line ab.
+double side(const square_topology<>::point_type& a,
+            const square_topology<>::point_type& b,
+            const square_topology<>::point_type& c)
+{
+  return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+}
+
+// Counts the pairs of edges without common ends that cross.
+std::size_t crossings(const Graph& g,
+                      const std::vector<square_topology<>::point_type>& pos)
+{
+  std::vector<std::pair<std::size_t, std::size_t> > e;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    e.push_back(std::make_pair(source(*ei, g), target(*ei, g)));
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < e.size(); ++i)
+    for (std::size_t j = i + 1; j < e.size(); ++j) {
+      std::size_t a = e[i].first, b = e[i].second;
+      std::size_t c = e[j].first, d = e[j].second;
+      if (a == c || a == d || b == c || b == d)
+        continue;
+      if (side(pos[a], pos[b], pos[c]) * side(pos[a], pos[b], pos[d]) < 0
+          && side(pos[c], pos[d], pos[a]) * side(pos[c], pos[d], pos[b]) < 0)
+        ++count;
+    }
+  return count;
+}
+
+// Lays out g with barnes_hut_force_pairs on the given number of threads.
+std::vector<square_topology<>::point_type>
+barnes_hut_layout(const Graph& g, std::size_t threads)
+{
+  typedef square_topology<>::point_type Point;
+  minstd_rand gen(3);
+  square_topology<> topology(gen, 50.);
+  std::vector<Point> pos(num_vertices(g));
+  iterator_property_map<std::vector<Point>::iterator, IndexMap>
+    position(pos.begin(), get(vertex_index, g));
+  random_graph_layout(g, position, topology);
+  fruchterman_reingold_force_directed_layout
+    (g, position, topology,
+     force_pairs(make_barnes_hut_force_pairs(topology, position, 0.8,
+                                             threads)).
+     cooling(linear_cooling<double>(50)));
+  return pos;
+}
+
+// Runs fruchterman_reingold_multilevel_layout() on g and checks that the
+// vertices stay within the topology.
+std::vector<square_topology<>::point_type>
+multilevel_layout(const Graph& g, std::size_t threads)
+{
+  typedef square_topology<>::point_type Point;
+  minstd_rand gen(3);
+  square_topology<> topology(gen, 50.);
+  std::vector<Point> pos(num_vertices(g));
+  fruchterman_reingold_multilevel_layout
+    (g, make_iterator_property_map(pos.begin(), get(vertex_index, g)),
+     topology, threads);
+  for (std::size_t i = 0; i < pos.size(); ++i)
+    for (std::size_t d = 0; d < 2; ++d)
+      BOOST_CHECK(pos[i][d] >= -50. && pos[i][d] <= 50.);
+  return pos;
+}
+
+bool same(const std::vector<square_topology<>::point_type>& a,
+          const std::vector<square_topology<>::point_type>& b)
+{
+  for (std::size_t i = 0; i < a.size(); ++i)
+    if (a[i][0] != b[i][0] || a[i][1] != b[i][1])
+      return false;
+  return true;
+}
+
+int test_main(int, char*[])
+{
+  minstd_rand gen(1);
+  square_topology<> square(gen, 50.);
+  cube_topology<> cube(gen, 50.);
+  BOOST_CHECK(repulsion_error(square, 500, 0.) < 1e-12);
+  BOOST_CHECK(repulsion_error(square, 2000, 0.8) < 0.01);
+  // there is more to cancel out in space
+  BOOST_CHECK(repulsion_error(cube, 2000, 0.8) < 0.05);
+  BOOST_CHECK(repulsion_error(cube, 2000, 0.5) < 0.02);
+
+  Graph g = grid(12);
+  std::vector<square_topology<>::point_type> one = barnes_hut_layout(g, 1);
+  BOOST_CHECK(same(one, barnes_hut_layout(g, 4)));
+  BOOST_CHECK(same(one, barnes_hut_layout(g, 0)));
+
+  multilevel_layout(Graph(), 1);
+  multilevel_layout(Graph(1), 1);
+  multilevel_layout(Graph(100), 1);
+
+  // a star collapses into one solar system
+  Graph star(200);
+  for (std::size_t i = 1; i < 200; ++i)
+    add_edge(0, i, star);
+  multilevel_layout(star, 1);
+
+  g = grid(20);
+  one = multilevel_layout(g, 1);
+  BOOST_CHECK(same(one, multilevel_layout(g, 4)));
+  BOOST_CHECK(crossings(g, one) < 100);
+  return 0;
+}
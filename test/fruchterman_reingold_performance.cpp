@@ -0,0 +1,119 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times fruchterman_reingold_force_directed_layout() on a square grid
+// with barnes_hut_force_pairs on one and several threads, then
+// fruchterman_reingold_multilevel_layout(), and prints the mean edge length
+// of each layout relative to the mean distance between vertices, which is
+// small for an untangled grid.  The quadratic grid_force_pairs baseline is
+// timed too when the side of the grid is given, so that the default run
+// stays short.
+//
+// usage: fruchterman_reingold_performance [side [threads]]
+
+#include <boost/graph/fruchterman_reingold_multilevel.hpp>
+#include <boost/graph/fruchterman_reingold.hpp>
+#include <boost/graph/random_layout.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef square_topology<> Topology;
+typedef Topology::point_type Point;
+typedef iterator_property_map<std::vector<Point>::iterator,
+                              property_map<Graph, vertex_index_t>::type>
+  PositionMap;
+
+// The mean edge length over the mean distance of vertex i to vertex
+// i * 7919 mod n.
+double stretch(const Graph& g, const std::vector<Point>& pos,
+               const Topology& topology)
+{
+  double edge = 0., spread = 0.;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    edge += topology.distance(pos[source(*ei, g)], pos[target(*ei, g)]);
+  for (std::size_t i = 0; i < pos.size(); ++i)
+    spread += topology.distance(pos[i], pos[i * 7919 % pos.size()]);
+  return (edge / num_edges(g)) / (spread / pos.size());
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 50;
+  std::size_t threads = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 4;
+
+  Graph g(side * side);
+  for (std::size_t x = 0; x < side; ++x)
+    for (std::size_t y = 0; y < side; ++y) {
+      if (x + 1 < side)
+        add_edge(x * side + y, (x + 1) * side + y, g);
+      if (y + 1 < side)
+        add_edge(x * side + y, x * side + y + 1, g);
+    }
+  std::cout << "grid: " << num_vertices(g) << " vertices, " << num_edges(g)
+            << " edges" << std::endl;
+
+  minstd_rand gen(1);
+  Topology topology(gen, 50.);
+  std::vector<Point> pos(num_vertices(g)), start(num_vertices(g));
+  PositionMap position(pos.begin(), get(vertex_index, g));
+  random_graph_layout(g, PositionMap(start.begin(), get(vertex_index, g)),
+                      topology);
+
+  double t;
+  if (argc > 1) {
+    pos = start;
+    t = now();
+    fruchterman_reingold_force_directed_layout
+      (g, position, topology, cooling(linear_cooling<double>(100)));
+    std::cout << "  grid_force_pairs: " << now() - t << " s, stretch "
+              << stretch(g, pos, topology) << std::endl;
+  }
+
+  // The layouts move vertices that land on top of each other toward
+  // random points, so each run gets a topology with the same generator.
+  std::size_t runs[] = { 1, threads };
+  std::vector<Point> first;
+  for (int r = 0; r < 2; ++r) {
+    minstd_rand run_gen(2);
+    Topology run_topology(run_gen, 50.);
+    pos = start;
+    t = now();
+    fruchterman_reingold_force_directed_layout
+      (g, position, run_topology,
+       force_pairs(make_barnes_hut_force_pairs(run_topology, position, 0.8,
+                                               runs[r])).
+       cooling(linear_cooling<double>(100)));
+    std::cout << "  barnes_hut_force_pairs, " << runs[r] << " threads: "
+              << now() - t << " s, stretch " << stretch(g, pos, topology)
+              << std::endl;
+    if (r == 0)
+      first = pos;
+    else
+      for (std::size_t i = 0; i < pos.size(); ++i)
+        BOOST_TEST(pos[i][0] == first[i][0] && pos[i][1] == first[i][1]);
+  }
+
+  for (int r = 0; r < 2; ++r) {
+    t = now();
+    fruchterman_reingold_multilevel_layout(g, position, topology, runs[r]);
+    std::cout << "  fruchterman_reingold_multilevel_layout, " << runs[r]
+              << " threads: " << now() - t << " s, stretch "
+              << stretch(g, pos, topology) << std::endl;
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,181 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks nagamochi_ibaraki_min_cut and karger_stein_min_cut against
+// exhaustive search on small random graphs, against stoer_wagner_min_cut
+// on larger ones and against each other on one and several threads.
+
+#include <boost/graph/global_min_cut.hpp>
+#include <boost/graph/stoer_wagner_min_cut.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, int> > Graph;
+typedef std::vector<char> Sides;
+
+// Random edges, some of them parallel, plus a ring so that the graph is
+// connected unless ring is false.
+void random_graph(Graph& g, std::size_t n, std::size_t m, int max_weight,
+                  bool ring, minstd_rand& gen)
+{
+  g = Graph(n);
+  uniform_int<std::size_t> vertex_dist(0, n - 1);
+  uniform_int<int> weight_dist(0, max_weight);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_vertex(gen, vertex_dist);
+  variate_generator<minstd_rand&, uniform_int<int> > random_weight(gen, weight_dist);
+  for (std::size_t i = 0; i < m; ++i)
+    add_edge(random_vertex(), random_vertex(), random_weight(), g);
+  if (ring)
+    for (std::size_t i = 0; i < n; ++i)
+      add_edge(i, (i + 1) % n, 1, g);
+}
+
+// The weight of the cut given by side, or -1 if one side is empty.
+int cut_weight(const Graph& g, const Sides& side)
+{
+  if (std::find(side.begin(), side.end(), 0) == side.end()
+      || std::find(side.begin(), side.end(), 1) == side.end())
+    return -1;
+  int sum = 0;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (side[source(*ei, g)] != side[target(*ei, g)])
+      sum += get(edge_weight, g, *ei);
+  return sum;
+}
+
+int exhaustive(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  int best = -1;
+  for (std::size_t mask = 1; mask + 1 < (std::size_t(1) << n); ++mask) {
+    Sides side(n);
+    for (std::size_t v = 0; v < n; ++v)
+      side[v] = (mask >> v) & 1;
+    int w = cut_weight(g, side);
+    if (best < 0 || w < best)
+      best = w;
+  }
+  return best;
+}
+
+// Larger graphs are only compared between the algorithms.
+int expected_cut(const Graph& g)
+{
+  if (num_vertices(g) <= 12)
+    return exhaustive(g);
+  if (num_vertices(g) <= 100)
+    return boost::stoer_wagner_min_cut(g, get(edge_weight, g));
+  return nagamochi_ibaraki_min_cut(g, get(edge_weight, g));
+}
+
+void test_graph(std::size_t n, std::size_t m, int max_weight, bool ring,
+                int seed)
+{
+  minstd_rand gen(seed);
+  Graph g;
+  random_graph(g, n, m, max_weight, ring, gen);
+  const int expected = expected_cut(g);
+  property_map<Graph, vertex_index_t>::type vm = get(vertex_index, g);
+
+  for (std::size_t threads = 1; threads <= 4; threads += 3) {
+    Sides side(n);
+    int w = nagamochi_ibaraki_min_cut(g, get(edge_weight, g), &side[0], vm,
+                                      threads);
+    BOOST_CHECK(w == expected);
+    BOOST_CHECK(cut_weight(g, side) == w);
+  }
+
+  Sides first(n), side(n);
+  int w = karger_stein_min_cut(g, get(edge_weight, g), &first[0], vm);
+  BOOST_CHECK(w == expected);
+  BOOST_CHECK(cut_weight(g, first) == w);
+  // The same seed gives the same cut on any number of threads.
+  BOOST_CHECK(karger_stein_min_cut(g, get(edge_weight, g), &side[0], vm,
+                                   0, 1, 4) == w);
+  BOOST_CHECK(side == first);
+}
+
+// Two dense halves joined by a few light edges: the reductions alone
+// contract each half, and the cut must separate them.
+void test_halves(std::size_t n, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> half_dist(0, n / 2 - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_half(gen, half_dist);
+  Graph g(n);
+  for (std::size_t i = 0; i < 8 * n; ++i) {
+    std::size_t base = (i % 2) * (n / 2);
+    add_edge(base + random_half(), base + random_half(), 5, g);
+  }
+  for (std::size_t i = 0; i < n / 2; ++i) {
+    add_edge(i, (i + 1) % (n / 2), 5, g);
+    add_edge(n / 2 + i, n / 2 + (i + 1) % (n / 2), 5, g);
+  }
+  add_edge(0, n / 2, 1, g);
+  add_edge(1, n / 2 + 1, 2, g);
+
+  Sides side(n);
+  BOOST_CHECK(nagamochi_ibaraki_min_cut(g, get(edge_weight, g),
+                                        parity_map(&side[0])) == 3);
+  for (std::size_t v = 1; v < n; ++v)
+    BOOST_CHECK(side[v] == side[0] || v >= n / 2);
+  BOOST_CHECK(side[0] != side[n / 2]);
+  if (n <= 200)
+    BOOST_CHECK(karger_stein_min_cut(g, get(edge_weight, g)) == 3);
+}
+
+void test_floating()
+{
+  typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                         property<edge_weight_t, double> > FloatGraph;
+  FloatGraph g(4);
+  add_edge(0, 1, 1.5, g);
+  add_edge(1, 2, 0.25, g);
+  add_edge(2, 3, 1.5, g);
+  add_edge(3, 0, 0.5, g);
+  add_edge(0, 2, 2.0, g);
+  BOOST_CHECK(nagamochi_ibaraki_min_cut(g, get(edge_weight, g)) == 1.75);
+  BOOST_CHECK(karger_stein_min_cut(g, get(edge_weight, g)) == 1.75);
+}
+
+int test_main(int, char*[])
+{
+  Graph single(1);
+  bool thrown = false;
+  try {
+    nagamochi_ibaraki_min_cut(single, get(edge_weight, single));
+  } catch (bad_graph&) {
+    thrown = true;
+  }
+  BOOST_CHECK(thrown);
+
+  test_graph(2, 0, 5, false, 1);
+  test_graph(2, 3, 5, false, 1);
+  for (int seed = 0; seed < 200; ++seed)
+    test_graph(3 + seed % 10, 2 + seed % 25, 1 + seed % 9, seed % 4 != 0, seed);
+  for (int seed = 0; seed < 10; ++seed) {
+    test_graph(60, 120, 10, true, seed);
+    test_graph(80, 600, 3, seed % 2 == 0, seed);
+  }
+  test_graph(5000, 10000, 20, true, 1);
+  test_graph(5000, 40000, 3, true, 2);
+  test_halves(200, 1);
+  test_halves(20000, 2);
+  test_floating();
+  return 0;
+}
@@ -0,0 +1,129 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Inserts random edges through incremental_topological_order and checks
+// every answer against a search of the graph.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/incremental_topological_order.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+template <typename Graph>
+bool reaches(const Graph& g, std::size_t from, std::size_t to)
+{
+  std::vector<default_color_type> color(num_vertices(g), white_color);
+  breadth_first_search(g, vertex(from, g), color_map(&color[0]));
+  return color[to] != white_color;
+}
+
+template <typename Graph>
+bool valid_order(const Graph& g,
+                 const incremental_topological_order<Graph>& order)
+{
+  if (order.size() != num_vertices(g))
+    return false;
+  for (std::size_t i = 0; i < order.size(); ++i)
+    if (order.position(order.vertex_at(i)) != i)
+      return false;
+  typename graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (!order.precedes(source(*ei, g), target(*ei, g)))
+      return false;
+  return true;
+}
+
+template <typename Graph>
+void test_random_insertions(std::size_t n, std::size_t attempts, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> dist(0, n - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_vertex(gen, dist);
+
+  Graph g(n);
+  incremental_topological_order<Graph> order(g);
+  BOOST_CHECK(valid_order(g, order));
+
+  std::size_t refused = 0;
+  for (std::size_t i = 0; i < attempts; ++i) {
+    std::size_t u = random_vertex(), v = random_vertex();
+    bool cycle = u == v || reaches(g, v, u);
+    BOOST_CHECK(order.creates_cycle(u, v) == cycle);
+
+    std::vector<std::size_t> before(order.begin(), order.end());
+    std::size_t lb = order.position(v), ub = order.position(u);
+    std::size_t edges_before = num_edges(g);
+    bool existed = edge(u, v, g).second;
+
+    bool added = order.add_edge(u, v).second;
+    // With setS out-edges a duplicate is not added either.
+    BOOST_CHECK(cycle ? !added : added || existed);
+    if (cycle) {
+      ++refused;
+      BOOST_CHECK(num_edges(g) == edges_before);
+      BOOST_CHECK(std::equal(before.begin(), before.end(), order.begin()));
+    } else if (lb < ub) {
+      // Only the affected region moves.
+      for (std::size_t p = 0; p < n; ++p)
+        if (p < lb || p > ub)
+          BOOST_CHECK(order.vertex_at(p) == before[p]);
+    }
+    if (i % 97 == 0)
+      BOOST_CHECK(valid_order(g, order));
+  }
+  BOOST_CHECK(refused > 0);
+  BOOST_CHECK(valid_order(g, order));
+
+  // Removing an edge and adding the reverse is fine.
+  typename graph_traits<Graph>::edge_iterator ei, ei_end;
+  boost::tie(ei, ei_end) = edges(g);
+  std::size_t s = source(*ei, g), t = target(*ei, g);
+  while (edge(s, t, g).second)
+    order.remove_edge(edge(s, t, g).first);
+  BOOST_CHECK(order.creates_cycle(t, s) == reaches(g, s, t));
+  if (!reaches(g, s, t)) {
+    BOOST_CHECK(order.add_edge(t, s).second);
+    BOOST_CHECK(order.precedes(t, s));
+  }
+
+  std::size_t w = order.add_vertex();
+  BOOST_CHECK(order.position(w) == n);
+  BOOST_CHECK(order.add_edge(w, order.vertex_at(0)).second);
+  BOOST_CHECK(valid_order(g, order));
+}
+
+int test_main(int, char*[])
+{
+  typedef adjacency_list<vecS, vecS, directedS> Directed;
+  typedef adjacency_list<vecS, vecS, bidirectionalS> Bidirectional;
+  typedef adjacency_list<setS, vecS, directedS> NoParallel;
+  test_random_insertions<Directed>(200, 3000, 1);
+  test_random_insertions<Bidirectional>(200, 3000, 2);
+  test_random_insertions<NoParallel>(50, 2000, 3);
+  test_random_insertions<Directed>(1000, 2500, 4);
+
+  // The constructor rejects a cyclic graph.
+  Directed c(2);
+  add_edge(0, 1, c);
+  add_edge(1, 0, c);
+  bool thrown = false;
+  try {
+    incremental_topological_order<Directed> order(c);
+  } catch (not_a_dag&) {
+    thrown = true;
+  }
+  BOOST_CHECK(thrown);
+  return 0;
+}
@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks the multithreaded and the row-streaming forms of
+// johnson_all_pairs_shortest_paths against floyd_warshall.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/johnson_all_pairs_shortest.hpp>
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+  property<edge_weight_t, int> > Graph;
+typedef std::vector<std::vector<int> > Matrix;
+
+struct matrix_row_sink
+{
+  matrix_row_sink(Matrix& D, std::vector<int>& seen) : D(D), seen(seen) { }
+
+  template <typename Vertex, typename Iter>
+  void operator()(Vertex u, Iter first, Iter last)
+  {
+    ++seen[u];
+    std::copy(first, last, D[u].begin());
+  }
+
+  Matrix& D;
+  std::vector<int>& seen;
+};
+
+int test_main(int, char*[])
+{
+  const int n = 60;
+  minstd_rand gen(42);
+  Graph g;
+  generate_random_graph(g, n, 6 * n, gen, false);
+
+  // Negative weights without negative cycles: w(u,v) + p(u) - p(v) with
+  // w >= 0 keeps every cycle non-negative.
+  uniform_int<int> weight_dist(0, 50), potential_dist(0, 30);
+  variate_generator<minstd_rand&, uniform_int<int> >
+    random_weight(gen, weight_dist), random_potential(gen, potential_dist);
+  std::vector<int> p(n);
+  for (int i = 0; i < n; ++i)
+    p[i] = random_potential();
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    put(edge_weight, g, *ei,
+        random_weight() + p[source(*ei, g)] - p[target(*ei, g)]);
+
+  Matrix expected(n, std::vector<int>(n));
+  BOOST_CHECK(floyd_warshall_all_pairs_shortest_paths(g, expected));
+
+  Matrix serial(n, std::vector<int>(n));
+  BOOST_CHECK(johnson_all_pairs_shortest_paths(g, serial));
+  BOOST_CHECK(serial == expected);
+
+  for (std::size_t threads = 0; threads <= 4; ++threads) {
+    Matrix parallel(n, std::vector<int>(n));
+    BOOST_CHECK(johnson_all_pairs_shortest_paths
+                  (g, parallel, number_of_threads(threads)));
+    BOOST_CHECK(parallel == expected);
+
+    Matrix streamed(n, std::vector<int>(n));
+    std::vector<int> seen(n);
+    BOOST_CHECK(johnson_all_pairs_shortest_paths_rows
+                  (g, matrix_row_sink(streamed, seen),
+                   number_of_threads(threads)));
+    BOOST_CHECK(streamed == expected);
+    BOOST_CHECK(std::count(seen.begin(), seen.end(), 1) == n);
+  }
+
+  // A negative cycle is still reported.
+  add_edge(0, 1, -100, g);
+  add_edge(1, 0, -100, g);
+  Matrix unused(n, std::vector<int>(n));
+  BOOST_CHECK(!johnson_all_pairs_shortest_paths
+                 (g, unused, number_of_threads(3)));
+
+  return 0;
+}
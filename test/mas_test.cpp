@@ -17,6 +17,10 @@
 #include <boost/graph/maximum_adjacency_search.hpp>
 #include <boost/graph/visitors.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
+#include <boost/graph/detail/bucket_max_queue.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/tuple/tuple.hpp>
@@ -223,5 +227,107 @@ BOOST_AUTO_TEST_CASE(test1)
 
 }
 
+// The bucket queue that is used by default for integral weights, passed
+// explicitly on the example of test0
+BOOST_AUTO_TEST_CASE(test2)
+{
+  typedef boost::graph_traits<undirected_graph>::vertex_descriptor vertex_descriptor;
+
+  edge_t edges[] = {{0, 1}, {1, 2}, {2, 3},
+    {0, 4}, {1, 4}, {1, 5}, {2, 6}, {3, 6}, {3, 7}, {4, 5}, {5, 6}, {6, 7}};
+  weight_type ws[] = {2, 3, 4, 3, 2, 2, 2, 2, 2, 3, 1, 3};
+  undirected_graph g(edges, edges + 12, ws, 8, 12);
+
+  typedef boost::property_map<undirected_graph, boost::vertex_index_t>::const_type index_map_type;
+  typedef boost::shared_array_property_map<weight_type, index_map_type> distances_type;
+  distances_type distances = boost::make_shared_array_property_map(num_vertices(g), weight_type(0), get(boost::vertex_index, g));
+  typedef boost::bucket_max_queue<vertex_descriptor, distances_type, index_map_type> queue_type;
+  queue_type pq(num_vertices(g), distances, get(boost::vertex_index, g));
+
+  mas_edge_connectivity_visitor<undirected_graph, queue_type> test_vis(pq);
+
+  boost::maximum_adjacency_search(g,
+        boost::weight_map(get(boost::edge_weight, g)).
+        visitor(test_vis).
+        root_vertex(*vertices(g).first).
+        max_priority_queue(pq));
+
+  BOOST_CHECK_EQUAL(test_vis.curr(), vertex_descriptor(7));
+  BOOST_CHECK_EQUAL(test_vis.prev(), vertex_descriptor(6));
+  BOOST_CHECK_EQUAL(test_vis.reach_weight(), 5);
+  BOOST_CHECK(pq.empty());
+}
+
+template <typename Graph>
+class mas_order_visitor : public boost::default_mas_visitor {
+  public:
+    typedef typename boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+
+    explicit mas_order_visitor(std::vector<vertex_descriptor>& order)
+      : m_order(order) {}
+
+    void start_vertex(vertex_descriptor u, const Graph&) {
+      m_order.push_back(u);
+    }
+
+  private:
+    std::vector<vertex_descriptor>& m_order;
+};
+
+// Whether each vertex of order is, among those that follow it, one of the
+// most tightly connected to the vertices before it.
+bool is_mas_order(const undirected_graph& g, const std::vector<unsigned long>& order)
+{
+  if (order.size() != num_vertices(g))
+    return false;
+  std::vector<weight_type> reach(num_vertices(g), 0);
+  std::vector<bool> visited(num_vertices(g), false);
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    const unsigned long u = order[i];
+    if (visited[u])
+      return false;
+    if (i > 0)
+      for (std::size_t v = 0; v < num_vertices(g); ++v)
+        if (!visited[v] && reach[v] > reach[u])
+          return false;
+    visited[u] = true;
+    BGL_FORALL_OUTEDGES(u, e, g, undirected_graph)
+      reach[target(e, g)] += get(boost::edge_weight, g, e);
+  }
+  return true;
+}
+
+// Random graphs searched with the default queue: a bucket queue for the
+// small weights, and a heap for the large ones
+BOOST_AUTO_TEST_CASE(test3)
+{
+  typedef boost::graph_traits<undirected_graph>::vertex_descriptor vertex_descriptor;
+
+  for (int seed = 0; seed < 50; ++seed) {
+    const std::size_t n = 2 + seed % 30;
+    boost::minstd_rand gen(seed + 1);
+    boost::uniform_int<std::size_t> vertex_dist(0, n - 1);
+    boost::uniform_int<int> weight_dist(0, seed % 2 == 0 ? 3 : 1000000);
+    boost::variate_generator<boost::minstd_rand&, boost::uniform_int<std::size_t> > random_vertex(gen, vertex_dist);
+    boost::variate_generator<boost::minstd_rand&, boost::uniform_int<int> > random_weight(gen, weight_dist);
+
+    undirected_graph g(n);
+    for (std::size_t i = 0; i < 3 * n; ++i)
+      add_edge(random_vertex(), random_vertex(), random_weight(), g);
+
+    std::vector<vertex_descriptor> order;
+    boost::maximum_adjacency_search(g,
+          boost::weight_map(get(boost::edge_weight, g)).
+          visitor(mas_order_visitor<undirected_graph>(order)).
+          root_vertex(random_vertex()));
+    BOOST_CHECK(is_mas_order(g, order));
+
+    order.clear();
+    boost::maximum_adjacency_search(g,
+          boost::visitor(mas_order_visitor<undirected_graph>(order)));
+    BOOST_CHECK(is_mas_order(g, order));
+  }
+}
+
 #include <boost/graph/iteration_macros_undef.hpp>
 
@@ -0,0 +1,99 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times edmonds_maximum_cardinality_matching with and without a partition
+// map, i.e. the blossom algorithm against Hopcroft-Karp, on random
+// bipartite assignment graphs, and the initial matchings on their own.
+//
+// usage: matching_performance [vertices-per-side [degree [threads]]]
+
+#include <boost/graph/max_cardinality_matching.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS> Csr;
+typedef std::size_t Vertex;
+
+// A symmetric CSR graph, so that out_edges() lists all neighbors: workers
+// 0 .. n-1 are white, jobs n .. 2n-1 black.  Each worker is qualified for
+// degree jobs, mostly near its own number, like a skill-based assignment.
+void make_assignment(std::vector<std::pair<Vertex, Vertex> >& arcs,
+                     std::size_t n, std::size_t degree, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> near_dist(0, 63), far_dist(0, n - 1),
+    coin_dist(0, 3);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    near(gen, near_dist), far(gen, far_dist), coin(gen, coin_dist);
+  arcs.clear();
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < degree; ++k) {
+      std::size_t j = coin() == 0 ? far() : (i + near()) % n;
+      arcs.push_back(std::make_pair(i, n + j));
+      arcs.push_back(std::make_pair(n + j, i));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 100000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 4;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 0;
+
+  std::vector<std::pair<Vertex, Vertex> > arcs;
+  make_assignment(arcs, n, degree, 1);
+  Csr g(edges_are_unsorted_multi_pass, arcs.begin(), arcs.end(), 2 * n);
+  property_map<Csr, vertex_index_t>::type vm = get(vertex_index, g);
+  std::vector<default_color_type> partition(2 * n, color_traits<default_color_type>::black());
+  for (std::size_t i = 0; i < n; ++i)
+    partition[i] = color_traits<default_color_type>::white();
+  std::cout << 2 * n << " vertices, " << num_edges(g) / 2 << " edges\n";
+
+  std::vector<Vertex> mate(2 * n);
+  double start = now();
+  greedy_matching<Csr, Vertex*>::find_matching(g, &mate[0]);
+  std::cout << "  greedy_matching: " << matching_size(g, &mate[0])
+            << ", " << now() - start << " s\n";
+  start = now();
+  extra_greedy_matching<Csr, Vertex*>::find_matching(g, &mate[0]);
+  std::cout << "  extra_greedy_matching: " << matching_size(g, &mate[0])
+            << ", " << now() - start << " s\n";
+  start = now();
+  karp_sipser_matching<Csr, Vertex*>::find_matching(g, &mate[0], vm, 1);
+  std::cout << "  karp_sipser_matching: " << matching_size(g, &mate[0])
+            << ", " << now() - start << " s\n";
+  start = now();
+  karp_sipser_matching<Csr, Vertex*>::find_matching(g, &mate[0], vm, threads);
+  BOOST_TEST(is_a_matching(g, &mate[0]));
+  std::cout << "  karp_sipser_matching (" << detail::resolve_number_of_threads(threads)
+            << " threads): " << matching_size(g, &mate[0])
+            << ", " << now() - start << " s\n";
+
+  start = now();
+  edmonds_maximum_cardinality_matching(g, &mate[0]);
+  std::size_t expected = matching_size(g, &mate[0]);
+  std::cout << "  blossom: " << expected << ", " << now() - start << " s\n";
+
+  start = now();
+  edmonds_maximum_cardinality_matching(g, &mate[0], vm, &partition[0]);
+  BOOST_TEST(matching_size(g, &mate[0]) == expected);
+  BOOST_TEST(is_a_matching(g, &mate[0]));
+  std::cout << "  hopcroft_karp: " << matching_size(g, &mate[0]) << ", "
+            << now() - start << " s\n";
+  return boost::report_errors();
+}
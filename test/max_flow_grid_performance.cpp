@@ -0,0 +1,186 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times ibfs_max_flow, boykov_kolmogorov_max_flow and push_relabel_max_flow
+// on segmentation-like grid networks and checks that the flows and the
+// cuts agree.  The pixel neighborhoods come from a grid_graph; since a
+// grid_graph has no room for the terminals, the networks are copied into
+// an adjacency_list with a source and a sink attached to every pixel.
+//
+// usage: max_flow_grid_performance [side [repeat]]
+
+#include <boost/graph/ibfs_max_flow.hpp>
+#include <boost/graph/boykov_kolmogorov_max_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/grid_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/array.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list_traits<vecS, vecS, directedS> Traits;
+typedef adjacency_list<vecS, vecS, directedS,
+  property<vertex_color_t, default_color_type,
+  property<vertex_distance_t, long,
+  property<vertex_predecessor_t, Traits::edge_descriptor> > >,
+  property<edge_capacity_t, long,
+  property<edge_residual_capacity_t, long,
+  property<edge_reverse_t, Traits::edge_descriptor> > > > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef graph_traits<Graph>::edge_descriptor Edge;
+typedef grid_graph<2> Grid;
+
+// push_relabel_max_flow() needs the reverse arcs to have no capacity, so
+// for it every neighbor pair becomes two arcs with reverses of their own.
+bool split_pairs = false;
+
+void add_arc(Graph& g, Vertex u, Vertex v, long cap, long rev_cap)
+{
+  if (split_pairs && rev_cap > 0) {
+    add_arc(g, u, v, cap, 0);
+    add_arc(g, v, u, rev_cap, 0);
+    return;
+  }
+  Edge e1 = add_edge(u, v, g).first;
+  Edge e2 = add_edge(v, u, g).first;
+  put(edge_capacity, g, e1, cap);
+  put(edge_capacity, g, e2, rev_cap);
+  put(edge_reverse, g, e1, e2);
+  put(edge_reverse, g, e2, e1);
+}
+
+// A smooth "image" with noise: pixels prefer the source in a disc and the
+// sink elsewhere, and neighbors are coupled more strongly where the
+// intensities are close.  With diagonals the neighborhood is 8-connected.
+void make_segmentation(Graph& g, std::size_t side, bool diagonals,
+                       long smoothness, int seed)
+{
+  boost::array<std::size_t, 2> lengths = {{ side, side }};
+  Grid grid(lengths);
+  const std::size_t n = num_vertices(grid);
+  minstd_rand gen(seed);
+  uniform_int<long> noise_dist(-40, 40);
+  variate_generator<minstd_rand&, uniform_int<long> > noise(gen, noise_dist);
+
+  std::vector<long> intensity(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    Grid::vertex_descriptor p = vertex(i, grid);
+    long dx = long(p[0]) - long(side / 2), dy = long(p[1]) - long(side / 3);
+    bool inside = 4 * (dx * dx + dy * dy) < long(side * side) / 4;
+    intensity[i] = (inside ? 160 : 90) + noise();
+  }
+
+  g = Graph(n + 2);
+  const Vertex s = n, t = n + 1;
+  for (std::size_t i = 0; i < n; ++i) {
+    // Terminal weights from the distance to the two class means.
+    long to_fg = std::labs(intensity[i] - 160), to_bg = std::labs(intensity[i] - 90);
+    add_arc(g, s, i, to_bg, 0);
+    add_arc(g, i, t, to_fg, 0);
+
+    Grid::vertex_descriptor p = vertex(i, grid);
+    graph_traits<Grid>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = out_edges(p, grid); ei != ei_end; ++ei) {
+      std::size_t j = get(vertex_index, grid, target(*ei, grid));
+      if (j > i) {
+        long w = smoothness * 100 / (10 + std::labs(intensity[i] - intensity[j]));
+        add_arc(g, i, j, w, w);
+      }
+    }
+    if (diagonals && p[0] + 1 < side && p[1] + 1 < side) {
+      std::size_t j = i + side + 1;
+      long w = smoothness * 70 / (10 + std::labs(intensity[i] - intensity[j]));
+      add_arc(g, i, j, w, w);
+      if (p[0] > 0) {
+        j = i + side - 1;
+        w = smoothness * 70 / (10 + std::labs(intensity[i] - intensity[j]));
+        add_arc(g, i, j, w, w);
+      }
+    }
+  }
+}
+
+long cut_value(Graph& g)
+{
+  long cut = 0;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (get(vertex_color, g, source(*ei, g)) == color_traits<default_color_type>::black()
+        && get(vertex_color, g, target(*ei, g)) != color_traits<default_color_type>::black())
+      cut += get(edge_capacity, g, *ei);
+  return cut;
+}
+
+enum solver { ibfs_solver, bk_solver, push_relabel_solver };
+
+long run(Graph& g, Vertex s, Vertex t, solver which)
+{
+  switch (which) {
+  case ibfs_solver: return ibfs_max_flow(g, s, t);
+  case bk_solver: return boykov_kolmogorov_max_flow(g, s, t);
+  default: return push_relabel_max_flow(g, s, t);
+  }
+}
+
+void benchmark(const std::string& name, Graph& shared, Graph& split,
+               int repeat)
+{
+  const Vertex s = num_vertices(shared) - 2, t = num_vertices(shared) - 1;
+  const char* names[] = { "ibfs", "boykov_kolmogorov", "push_relabel" };
+  std::cout << name << ": " << num_vertices(shared) << " vertices, "
+            << num_edges(shared) << " edges\n";
+  long expected = 0;
+  for (int k = 0; k < 3; ++k) {
+    solver which = solver(k);
+    Graph& g = which == push_relabel_solver ? split : shared;
+    long flow = run(g, s, t, which);
+    if (k == 0)
+      expected = flow;
+    BOOST_TEST(flow == expected);
+    if (which != push_relabel_solver)
+      BOOST_TEST(cut_value(g) == flow);
+    double start = now();
+    for (int i = 0; i < repeat; ++i)
+      run(g, s, t, which);
+    double seconds = (now() - start) / repeat;
+    std::cout << "  " << names[k] << ": flow " << flow << ", "
+              << seconds << " s\n";
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 256;
+  int repeat = argc > 2 ? lexical_cast<int>(argv[2]) : 3;
+
+  const long smoothness[] = { 5, 20, 80 };
+  for (int k = 0; k < 3; ++k)
+    for (int diagonals = 0; diagonals < 2; ++diagonals) {
+      Graph shared, split;
+      split_pairs = false;
+      make_segmentation(shared, side, diagonals != 0, smoothness[k], k + 1);
+      split_pairs = true;
+      make_segmentation(split, side, diagonals != 0, smoothness[k], k + 1);
+      benchmark(lexical_cast<std::string>(side) + "x"
+                  + lexical_cast<std::string>(side)
+                  + (diagonals ? ", 8-connected" : ", 4-connected")
+                  + ", smoothness " + lexical_cast<std::string>(smoothness[k]),
+                shared, split, repeat);
+    }
+  return boost::report_errors();
+}
@@ -40,6 +40,7 @@
 #include <boost/graph/boykov_kolmogorov_max_flow.hpp>
 #include <boost/graph/push_relabel_max_flow.hpp>
 #include <boost/graph/edmonds_karp_max_flow.hpp>
+#include <boost/graph/ibfs_max_flow.hpp>
 //boost utilities we use
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/random.hpp>
@@ -128,9 +129,23 @@ int test_main(int argc, char* argv[])
   tEdgeVal bk = boykov_kolmogorov_max_flow(g,source_vertex,sink_vertex); 
   tEdgeVal push_relabel = push_relabel_max_flow(g,source_vertex,sink_vertex);
   tEdgeVal edmonds_karp = edmonds_karp_max_flow(g,source_vertex,sink_vertex);
+  tEdgeVal push_relabel_parallel = push_relabel_max_flow_parallel
+    (g, source_vertex, sink_vertex, number_of_threads(4));
+  tEdgeVal ibfs = ibfs_max_flow(g, source_vertex, sink_vertex);
   
   BOOST_REQUIRE( bk == push_relabel );
   BOOST_REQUIRE( push_relabel == edmonds_karp );
+  BOOST_REQUIRE( push_relabel == push_relabel_parallel );
+  BOOST_REQUIRE( push_relabel == ibfs );
+
+  // the color map holds a minimum cut
+  tEdgeVal cut = 0;
+  property_map < Graph, vertex_color_t >::type color = get(vertex_color, g);
+  for (boost::tie(ei, e_end) = edges(g); ei != e_end; ++ei)
+    if (color[source(*ei, g)] == color_traits<default_color_type>::black()
+        && color[target(*ei, g)] != color_traits<default_color_type>::black())
+      cut += cap[*ei];
+  BOOST_REQUIRE( cut == ibfs );
 
   return 0;
 }
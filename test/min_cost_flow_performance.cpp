@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times cost_scaling_min_cost_flow, successive_shortest_path_nonnegative_weights
+// and cycle_canceling on random transportation problems and checks that the
+// costs agree.  Supplies and demands are modeled by a super source and a
+// super sink; the cost scaling and cycle canceling solvers start from a
+// maximum flow found by push_relabel_max_flow.  cycle_canceling is skipped
+// above 200 warehouses.
+//
+// usage: min_cost_flow_performance [warehouses [arcs-per-warehouse]]
+
+#include <boost/graph/cost_scaling_min_cost_flow.hpp>
+#include <boost/graph/successive_shortest_path_nonnegative_weights.hpp>
+#include <boost/graph/cycle_canceling.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list_traits<vecS, vecS, directedS> Traits;
+typedef adjacency_list<vecS, vecS, directedS,
+  property<vertex_color_t, default_color_type,
+  property<vertex_distance_t, long,
+  property<vertex_predecessor_t, Traits::edge_descriptor> > >,
+  property<edge_capacity_t, long,
+  property<edge_residual_capacity_t, long,
+  property<edge_reverse_t, Traits::edge_descriptor,
+  property<edge_weight_t, long> > > > > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef graph_traits<Graph>::edge_descriptor Edge;
+
+void add_arc(Graph& g, Vertex u, Vertex v, long cap, long cost)
+{
+  Edge e1 = add_edge(u, v, g).first;
+  Edge e2 = add_edge(v, u, g).first;
+  put(edge_capacity, g, e1, cap);
+  put(edge_capacity, g, e2, 0);
+  put(edge_weight, g, e1, cost);
+  put(edge_weight, g, e2, -cost);
+  put(edge_reverse, g, e1, e2);
+  put(edge_reverse, g, e2, e1);
+}
+
+// Warehouses 0 .. w-1 ship to as many customers w .. 2w-1; the source is 2w
+// and the sink 2w+1.  The costs grow with the distance on a circle so that
+// cheap routes are local.
+void make_transportation(Graph& g, std::size_t w, std::size_t degree, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> customer_dist(0, w - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    customer(gen, customer_dist);
+  uniform_int<long> amount_dist(10, 100), noise_dist(0, 50);
+  variate_generator<minstd_rand&, uniform_int<long> >
+    amount(gen, amount_dist), noise(gen, noise_dist);
+
+  g = Graph(2 * w + 2);
+  const Vertex s = 2 * w, t = 2 * w + 1;
+  for (std::size_t i = 0; i < w; ++i) {
+    add_arc(g, s, i, amount(), 0);
+    add_arc(g, w + i, t, amount(), 0);
+    for (std::size_t k = 0; k < degree; ++k) {
+      std::size_t j = customer();
+      std::size_t d = i > j ? i - j : j - i;
+      d = (std::min)(d, w - d);
+      add_arc(g, i, w + j, amount(), long(100 * d / w) * 10 + noise());
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t w = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 1000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 10;
+
+  for (int seed = 1; seed <= 3; ++seed) {
+    Graph g;
+    make_transportation(g, w, degree, seed);
+    const Vertex s = 2 * w, t = 2 * w + 1;
+    std::cout << w << " warehouses, " << num_edges(g) / 2 << " arcs\n";
+
+    double start = now();
+    long flow = push_relabel_max_flow(g, s, t);
+    double max_flow_time = now() - start;
+    start = now();
+    cost_scaling_min_cost_flow(g);
+    long cost = find_flow_cost(g);
+    std::cout << "  cost_scaling_min_cost_flow: flow " << flow << ", cost "
+              << cost << ", " << max_flow_time << " + "
+              << now() - start << " s\n";
+
+    if (w <= 200) {
+      Graph g2;
+      make_transportation(g2, w, degree, seed);
+      push_relabel_max_flow(g2, s, t);
+      start = now();
+      cycle_canceling(g2);
+      BOOST_TEST(find_flow_cost(g2) == cost);
+      std::cout << "  cycle_canceling: " << max_flow_time << " + "
+                << now() - start << " s\n";
+    }
+
+    start = now();
+    successive_shortest_path_nonnegative_weights(g, s, t);
+    BOOST_TEST(find_flow_cost(g) == cost);
+    std::cout << "  successive_shortest_path_nonnegative_weights: "
+              << now() - start << " s\n";
+  }
+  return boost::report_errors();
+}
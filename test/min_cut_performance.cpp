@@ -0,0 +1,97 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times stoer_wagner_min_cut, nagamochi_ibaraki_min_cut and
+// karger_stein_min_cut on random graphs whose edges are mostly local, so
+// that the minimum cut is not simply the lightest vertex.  Stoer-Wagner is
+// only run on the smaller graphs.
+//
+// usage: min_cut_performance [vertices [degree [threads]]]
+
+#include <boost/graph/global_min_cut.hpp>
+#include <boost/graph/stoer_wagner_min_cut.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, int> > Graph;
+
+// Each vertex is joined to its successor on a ring by a heavy edge and to
+// degree other vertices, mostly nearby ones.  The two halves of the ring
+// are only joined by a few of the nearby edges, which makes them the
+// minimum cut rather than the lightest vertex.
+void make_graph(Graph& g, std::size_t n, std::size_t degree, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> near_dist(1, 20), far_dist(0, n - 1),
+    coin_dist(0, 19);
+  uniform_int<int> weight_dist(1, 10);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    near(gen, near_dist), far(gen, far_dist), coin(gen, coin_dist);
+  variate_generator<minstd_rand&, uniform_int<int> > weight(gen, weight_dist);
+  g = Graph(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if ((i + 1) % (n / 2) != 0)
+      add_edge(i, (i + 1) % n, 20, g);
+    for (std::size_t k = 0; k < degree; ++k) {
+      bool is_far = coin() == 0;
+      std::size_t j = is_far ? far() : (i + near()) % n;
+      if ((i < n / 2) != (j < n / 2) && (is_far || coin() != 0))
+        continue;
+      add_edge(i, j, weight(), g);
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 100000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 5;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 0;
+
+  Graph g;
+  make_graph(g, n, degree, 1);
+  property_map<Graph, edge_weight_t>::type w = get(edge_weight, g);
+  property_map<Graph, vertex_index_t>::type vm = get(vertex_index, g);
+  std::cout << n << " vertices, " << num_edges(g) << " edges\n";
+
+  std::vector<char> side(n);
+  double start = now();
+  int best = nagamochi_ibaraki_min_cut(g, w, &side[0], vm);
+  std::cout << "  nagamochi_ibaraki_min_cut: " << best << ", "
+            << now() - start << " s\n";
+
+  start = now();
+  BOOST_TEST(nagamochi_ibaraki_min_cut(g, w, &side[0], vm, threads) == best);
+  std::cout << "  nagamochi_ibaraki_min_cut ("
+            << detail::resolve_number_of_threads(threads) << " threads): "
+            << best << ", " << now() - start << " s\n";
+
+  start = now();
+  int cut = karger_stein_min_cut(g, w, &side[0], vm, 0, 1, threads);
+  BOOST_TEST(cut >= best);
+  std::cout << "  karger_stein_min_cut: " << cut << ", "
+            << now() - start << " s\n";
+
+  if (n <= 5000) {
+    start = now();
+    BOOST_TEST(boost::stoer_wagner_min_cut(g, w) == best);
+    std::cout << "  stoer_wagner_min_cut: " << best << ", "
+              << now() - start << " s\n";
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,190 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times minimum_degree_ordering against approximate_minimum_degree_ordering,
+// and compares the number of nonzeros of the Cholesky factor that their
+// orderings give with that of the natural order, on a 2D 9-point mesh, a
+// 3D 27-point mesh, random graphs with three edges per vertex and the
+// symmetric matrices in the Harwell-Boeing files given on the command line
+// (link with example/iohb.c).  Small matrices are ordered several times.
+//
+// usage: minimum_degree_performance [mesh size [Harwell-Boeing files...]]
+
+#include <boost/graph/minimum_degree_ordering.hpp>
+#include <boost/graph/approximate_minimum_degree_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+#include "iohb.h"
+
+using namespace boost;
+
+// minimum_degree_ordering wants both directions of each edge.
+typedef adjacency_list<vecS, vecS, directedS> Graph;
+typedef property_map<Graph, vertex_index_t>::type IndexMap;
+
+void add_pair(Graph& g, int u, int v)
+{
+  add_edge(u, v, g);
+  add_edge(v, u, g);
+}
+
+// Each vertex is adjacent to the vertices around it: 8 in 2D (nz == 1),
+// 26 in 3D.
+Graph mesh(int nx, int ny, int nz)
+{
+  Graph g(nx * ny * nz);
+  for (int x = 0; x < nx; ++x)
+    for (int y = 0; y < ny; ++y)
+      for (int z = 0; z < nz; ++z)
+        for (int dx = -1; dx <= 1; ++dx)
+          for (int dy = -1; dy <= 1; ++dy)
+            for (int dz = -1; dz <= 1; ++dz) {
+              int x2 = x + dx, y2 = y + dy, z2 = z + dz;
+              int u = (x * ny + y) * nz + z, v = (x2 * ny + y2) * nz + z2;
+              if (x2 >= 0 && x2 < nx && y2 >= 0 && y2 < ny && z2 >= 0
+                  && z2 < nz && u < v)
+                add_pair(g, u, v);
+            }
+  return g;
+}
+
+// Both directions of each edge of a simple random graph.
+Graph random_graph(int n, int m, minstd_rand& gen)
+{
+  typedef adjacency_list<vecS, vecS, undirectedS> Undirected;
+  Undirected u;
+  generate_random_graph(u, n, m, gen, false, false);
+  Graph g(n);
+  graph_traits<Undirected>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(u); ei != ei_end; ++ei)
+    add_pair(g, source(*ei, u), target(*ei, u));
+  return g;
+}
+
+// The graph of the off-diagonal nonzeros of a Harwell-Boeing matrix, of
+// which only the lower triangle is stored.
+bool read_harwell_boeing(const char* filename, Graph& g)
+{
+  int m, n, nonzeros, nrhs;
+  char type_buffer[4];
+  char* type = type_buffer;
+  if (!readHB_info(filename, &m, &n, &nonzeros, &type, &nrhs) || m != n)
+    return false;
+  std::vector<int> colptr(n + 1), rowind(nonzeros);
+  std::vector<double> values(2 * nonzeros + 1);
+  if (!readHB_mat_double(filename, &colptr[0], &rowind[0], &values[0]))
+    return false;
+  g = Graph(n);
+  for (int j = 0; j < n; ++j)
+    for (int p = colptr[j] - 1; p < colptr[j + 1] - 1; ++p)
+      if (rowind[p] - 1 != j)
+        add_pair(g, rowind[p] - 1, j);
+  return true;
+}
+
+// The number of nonzeros of the Cholesky factor from the elimination
+// tree and the row subtrees.
+std::size_t cholesky_nonzeros(const Graph& g, const std::vector<int>& inverse_perm)
+{
+  const int n = num_vertices(g);
+  std::vector<int> perm(n), parent(n, -1), ancestor(n, -1), mark(n, -1);
+  for (int v = 0; v < n; ++v)
+    perm[inverse_perm[v]] = v;
+  graph_traits<Graph>::adjacency_iterator ai, ai_end;
+  for (int k = 0; k < n; ++k)
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j != -1 && j < k;) {
+        int next = ancestor[j];
+        ancestor[j] = k;
+        if (next == -1)
+          parent[j] = k;
+        j = next;
+      }
+  std::size_t count = n;
+  for (int k = 0; k < n; ++k) {
+    mark[k] = k;
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j < k && mark[j] != k; j = parent[j]) {
+        mark[j] = k;
+        ++count;
+      }
+  }
+  return count;
+}
+
+void run(const Graph& g, const char* name)
+{
+  const int n = num_vertices(g);
+  const int repeat = int((std::max)(std::size_t(1), 100000 / (num_edges(g) + 1)));
+  std::cout << name << ": " << n << " vertices, " << num_edges(g) / 2
+            << " edges" << std::endl;
+  std::vector<int> inverse_perm(n), perm(n), supernode_size(n), degree(n);
+
+  for (int v = 0; v < n; ++v)
+    inverse_perm[v] = v;
+  std::cout << "  natural order: nnz(L) " << cholesky_nonzeros(g, inverse_perm)
+            << std::endl;
+
+  // minimum_degree_ordering removes the edges of its graph.
+  double time = 0;
+  for (int i = 0; i < repeat; ++i) {
+    Graph work = g;
+    IndexMap id = get(vertex_index, work);
+    std::fill(supernode_size.begin(), supernode_size.end(), 1);
+    double start = now();
+    minimum_degree_ordering
+      (work, make_iterator_property_map(degree.begin(), id, degree[0]),
+       &inverse_perm[0], &perm[0],
+       make_iterator_property_map(supernode_size.begin(), id,
+                                  supernode_size[0]), 0, id);
+    time += now() - start;
+  }
+  std::size_t mmd = cholesky_nonzeros(g, inverse_perm);
+  std::cout << "  minimum_degree_ordering: " << time / repeat << " s, nnz(L) "
+            << mmd << std::endl;
+
+  IndexMap id = get(vertex_index, g);
+  double start = now();
+  for (int i = 0; i < repeat; ++i)
+    approximate_minimum_degree_ordering
+      (g, make_iterator_property_map(degree.begin(), id, degree[0]),
+       &inverse_perm[0], &perm[0],
+       make_iterator_property_map(supernode_size.begin(), id,
+                                  supernode_size[0]), id);
+  time = now() - start;
+  std::size_t amd = cholesky_nonzeros(g, inverse_perm);
+  std::cout << "  approximate_minimum_degree_ordering: " << time / repeat
+            << " s, nnz(L) " << amd << std::endl;
+  for (int v = 0; v < n; ++v)
+    BOOST_TEST(perm[inverse_perm[v]] == v);
+  // The two heuristics are not expected to agree exactly.
+  BOOST_TEST(amd <= 2 * mmd && mmd <= 2 * amd);
+}
+
+int main(int argc, char* argv[])
+{
+  int size = argc > 1 ? lexical_cast<int>(argv[1]) : 300;
+
+  run(mesh(size, size, 1), "2D 9-point mesh");
+  run(mesh(size / 10, size / 10, size / 10), "3D 27-point mesh");
+  minstd_rand gen(1);
+  for (int n = size; n <= size * size / 10; n *= 4)
+    run(random_graph(n, 3 * n, gen), "random graph");
+  for (int i = 2; i < argc; ++i) {
+    Graph g;
+    BOOST_TEST(read_harwell_boeing(argv[i], g));
+    run(g, argv[i]);
+  }
+  return boost::report_errors();
+}
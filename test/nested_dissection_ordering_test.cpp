@@ -0,0 +1,180 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that nested_dissection_ordering returns a permutation that does
+// not depend on the number of threads, on meshes, random, disconnected
+// and degenerate graphs, and that its fill is close to that of
+// approximate_minimum_degree_ordering on a 2D mesh and below it on a 3D
+// mesh.
+
+#include <boost/graph/nested_dissection_ordering.hpp>
+#include <boost/graph/approximate_minimum_degree_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef adjacency_list<vecS, vecS, directedS> Directed;
+
+// Each vertex is adjacent to the vertices around it: 8 in 2D (nz == 1),
+// 26 in 3D.
+Graph mesh(int nx, int ny, int nz)
+{
+  Graph g(nx * ny * nz);
+  for (int x = 0; x < nx; ++x)
+    for (int y = 0; y < ny; ++y)
+      for (int z = 0; z < nz; ++z)
+        for (int dx = -1; dx <= 1; ++dx)
+          for (int dy = -1; dy <= 1; ++dy)
+            for (int dz = -1; dz <= 1; ++dz) {
+              int x2 = x + dx, y2 = y + dy, z2 = z + dz;
+              int u = (x * ny + y) * nz + z, v = (x2 * ny + y2) * nz + z2;
+              if (x2 >= 0 && x2 < nx && y2 >= 0 && y2 < ny && z2 >= 0
+                  && z2 < nz && u < v)
+                add_edge(u, v, g);
+            }
+  return g;
+}
+
+// The number of nonzeros of the Cholesky factor of the matrix of g,
+// permuted so that vertex v is in position inverse_perm[v], from the
+// elimination tree and the row subtrees.
+std::size_t cholesky_nonzeros(const Graph& g, const std::vector<int>& inverse_perm)
+{
+  const int n = num_vertices(g);
+  std::vector<int> perm(n), parent(n, -1), ancestor(n, -1), mark(n, -1);
+  for (int v = 0; v < n; ++v)
+    perm[inverse_perm[v]] = v;
+  graph_traits<Graph>::adjacency_iterator ai, ai_end;
+  for (int k = 0; k < n; ++k)
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j != -1 && j < k;) {
+        int next = ancestor[j];
+        ancestor[j] = k;
+        if (next == -1)
+          parent[j] = k;
+        j = next;
+      }
+  std::size_t count = n;
+  for (int k = 0; k < n; ++k) {
+    mark[k] = k;
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j < k && mark[j] != k; j = parent[j]) {
+        mark[j] = k;
+        ++count;
+      }
+  }
+  return count;
+}
+
+// Checks that the order is a permutation, the same on 1, 4 and all
+// hardware threads, and returns its inverse.
+template <typename G>
+std::vector<int> check_order(const G& g)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<std::size_t> order, parallel, all;
+  nested_dissection_ordering(g, std::back_inserter(order));
+  nested_dissection_ordering(g, std::back_inserter(parallel),
+                             get(vertex_index, g), 4);
+  nested_dissection_ordering(g, std::back_inserter(all),
+                             get(vertex_index, g), 0);
+  BOOST_CHECK(order.size() == n);
+  BOOST_CHECK(parallel == order);
+  BOOST_CHECK(all == order);
+
+  std::vector<int> inverse_perm(n, -1);
+  for (std::size_t k = 0; k < order.size(); ++k)
+    if (order[k] < n && inverse_perm[order[k]] == -1)
+      inverse_perm[order[k]] = k;
+  for (std::size_t v = 0; v < n; ++v)
+    BOOST_CHECK(inverse_perm[v] != -1);
+  return inverse_perm;
+}
+
+std::size_t amd_fill(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<int> inverse_perm(n), perm(n), sizes(n), degree(n);
+  approximate_minimum_degree_ordering(g, &degree[0], &inverse_perm[0],
+                                      &perm[0], &sizes[0],
+                                      get(vertex_index, g));
+  return cholesky_nonzeros(g, inverse_perm);
+}
+
+// Checks that the fill of nested dissection is at most percent % of
+// that of AMD; test/nested_dissection_performance.cpp prints both.
+void compare(const Graph& g, std::size_t percent)
+{
+  std::size_t nd = cholesky_nonzeros(g, check_order(g)), amd = amd_fill(g);
+  BOOST_CHECK(nd * 100 <= amd * percent);
+}
+
+int test_main(int, char*[])
+{
+  std::vector<std::size_t> order;
+  nested_dissection_ordering(Graph(), std::back_inserter(order));
+  BOOST_CHECK(order.empty());
+  check_order(Graph(1));
+  check_order(Graph(1000));
+
+  // a path is small enough for minimum degree alone, which gives no fill
+  Graph path(150);
+  for (std::size_t v = 0; v + 1 < 150; ++v)
+    add_edge(v, v + 1, path);
+  BOOST_CHECK(cholesky_nonzeros(path, check_order(path)) == 299);
+
+  // a long path is split at single vertices, and each vertex between two
+  // separators is joined to one of them in the factor
+  Graph long_path(5000);
+  for (std::size_t v = 0; v + 1 < 5000; ++v)
+    add_edge(v, v + 1, long_path);
+  BOOST_CHECK(cholesky_nonzeros(long_path, check_order(long_path)) < 15000);
+
+  // inseparable graphs: a complete graph and a star
+  Graph complete(250), star(1000);
+  for (std::size_t u = 0; u < 250; ++u)
+    for (std::size_t v = u + 1; v < 250; ++v)
+      add_edge(u, v, complete);
+  for (std::size_t v = 1; v < 1000; ++v)
+    add_edge(0, v, star);
+  BOOST_CHECK(cholesky_nonzeros(complete, check_order(complete)) == 250 * 251 / 2);
+  BOOST_CHECK(cholesky_nonzeros(star, check_order(star)) == 1999);
+
+  // a directed graph with one direction of each edge and self-loops
+  // gives the same matrix as the undirected graph
+  minstd_rand gen(1);
+  Graph g;
+  generate_random_graph(g, 3000, 6000, gen, true, true);
+  Directed directed(3000);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    add_edge(source(*ei, g), target(*ei, g), directed);
+    add_edge(source(*ei, g), source(*ei, g), directed);
+  }
+  std::size_t fill = cholesky_nonzeros(g, check_order(g));
+  std::size_t directed_fill = cholesky_nonzeros(g, check_order(directed));
+  BOOST_CHECK(directed_fill * 4 <= fill * 5 && fill * 4 <= directed_fill * 5);
+
+  // several components and isolated vertices
+  Graph pieces(4000);
+  for (std::size_t v = 0; v < 3000; ++v)
+    if (v % 1000 != 999)
+      add_edge(v, v + 1, pieces);
+  check_order(pieces);
+
+  // minimum degree does well on small 2D meshes; nested dissection pays
+  // off in 3D
+  compare(mesh(100, 100, 1), 125);
+  compare(mesh(20, 20, 20), 100);
+  return 0;
+}
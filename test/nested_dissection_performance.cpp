@@ -0,0 +1,121 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times nested_dissection_ordering on one and several threads against
+// approximate_minimum_degree_ordering, and compares the number of
+// nonzeros of the Cholesky factor that their orderings give, on a 2D
+// 9-point mesh and a 3D 27-point mesh.
+//
+// usage: nested_dissection_performance [2D mesh size [3D mesh size [threads]]]
+
+#include <boost/graph/nested_dissection_ordering.hpp>
+#include <boost/graph/approximate_minimum_degree_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+
+// Each vertex is adjacent to the vertices around it: 8 in 2D (nz == 1),
+// 26 in 3D.
+Graph mesh(int nx, int ny, int nz)
+{
+  Graph g(nx * ny * nz);
+  for (int x = 0; x < nx; ++x)
+    for (int y = 0; y < ny; ++y)
+      for (int z = 0; z < nz; ++z)
+        for (int dx = -1; dx <= 1; ++dx)
+          for (int dy = -1; dy <= 1; ++dy)
+            for (int dz = -1; dz <= 1; ++dz) {
+              int x2 = x + dx, y2 = y + dy, z2 = z + dz;
+              int u = (x * ny + y) * nz + z, v = (x2 * ny + y2) * nz + z2;
+              if (x2 >= 0 && x2 < nx && y2 >= 0 && y2 < ny && z2 >= 0
+                  && z2 < nz && u < v)
+                add_edge(u, v, g);
+            }
+  return g;
+}
+
+// The number of nonzeros of the Cholesky factor from the elimination
+// tree and the row subtrees.
+double cholesky_nonzeros(const Graph& g, const std::vector<int>& inverse_perm)
+{
+  const int n = num_vertices(g);
+  std::vector<int> perm(n), parent(n, -1), ancestor(n, -1), mark(n, -1);
+  for (int v = 0; v < n; ++v)
+    perm[inverse_perm[v]] = v;
+  graph_traits<Graph>::adjacency_iterator ai, ai_end;
+  for (int k = 0; k < n; ++k)
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j != -1 && j < k;) {
+        int next = ancestor[j];
+        ancestor[j] = k;
+        if (next == -1)
+          parent[j] = k;
+        j = next;
+      }
+  double count = n;
+  for (int k = 0; k < n; ++k) {
+    mark[k] = k;
+    for (boost::tie(ai, ai_end) = adjacent_vertices(perm[k], g); ai != ai_end; ++ai)
+      for (int j = inverse_perm[*ai]; j < k && mark[j] != k; j = parent[j]) {
+        mark[j] = k;
+        ++count;
+      }
+  }
+  return count;
+}
+
+void run(const Graph& g, const char* name, std::size_t threads)
+{
+  const int n = num_vertices(g);
+  std::cout << name << ": " << n << " vertices, " << num_edges(g)
+            << " edges" << std::endl;
+
+  std::vector<std::size_t> order, parallel;
+  double start = now();
+  nested_dissection_ordering(g, std::back_inserter(order));
+  double serial_time = now() - start;
+  start = now();
+  nested_dissection_ordering(g, std::back_inserter(parallel),
+                             get(vertex_index, g), threads);
+  double parallel_time = now() - start;
+  BOOST_TEST(parallel == order);
+  std::vector<int> inverse_perm(n);
+  for (int k = 0; k < n; ++k)
+    inverse_perm[order[k]] = k;
+  std::cout << "  nested_dissection_ordering: " << serial_time << " s, "
+            << threads << " threads: " << parallel_time << " s, nnz(L) "
+            << cholesky_nonzeros(g, inverse_perm) << std::endl;
+
+  std::vector<int> perm(n), sizes(n), degree(n);
+  start = now();
+  approximate_minimum_degree_ordering(g, &degree[0], &inverse_perm[0],
+                                      &perm[0], &sizes[0],
+                                      get(vertex_index, g));
+  double amd_time = now() - start;
+  std::cout << "  approximate_minimum_degree_ordering: " << amd_time
+            << " s, nnz(L) " << cholesky_nonzeros(g, inverse_perm)
+            << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  int size2 = argc > 1 ? lexical_cast<int>(argv[1]) : 400;
+  int size3 = argc > 2 ? lexical_cast<int>(argv[2]) : 40;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 4;
+
+  run(mesh(size2, size2, 1), "2D 9-point mesh", threads);
+  run(mesh(size3, size3, size3), "3D 27-point mesh", threads);
+  return boost::report_errors();
+}
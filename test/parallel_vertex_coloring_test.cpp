@@ -0,0 +1,148 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that speculative_vertex_coloring() and the Jones-Plassmann
+// colorings give valid colorings on 1, 4 and all hardware threads, that
+// the Jones-Plassmann colorings are those of sequential_vertex_coloring()
+// in priority order, and that speculative coloring on one thread is that
+// of sequential_vertex_coloring().
+
+#include <boost/graph/parallel_vertex_coloring.hpp>
+#include <boost/graph/sequential_vertex_coloring.hpp>
+#include <boost/graph/smallest_last_ordering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef graph_traits<Graph>::vertices_size_type size_type;
+
+// Checks that no edge but a self-loop joins two vertices of the same
+// color and that the colors are below num_colors.
+void check_coloring(const Graph& g, const std::vector<size_type>& color,
+                    size_type num_colors)
+{
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (source(*ei, g) != target(*ei, g))
+      BOOST_CHECK(color[source(*ei, g)] != color[target(*ei, g)]);
+  for (std::size_t v = 0; v < num_vertices(g); ++v)
+    BOOST_CHECK(color[v] < num_colors);
+}
+
+// The vertices by decreasing priority, then increasing index.
+struct by_priority
+{
+  explicit by_priority(const std::vector<std::size_t>& p) : priority(p) { }
+  bool operator()(Vertex u, Vertex v) const
+  {
+    return priority[u] != priority[v] ? priority[u] > priority[v] : u < v;
+  }
+  const std::vector<std::size_t>& priority;
+};
+
+std::vector<size_type> sequential(const Graph& g,
+                                  const std::vector<Vertex>& order,
+                                  size_type& num_colors)
+{
+  std::vector<size_type> color(num_vertices(g));
+  num_colors = sequential_vertex_coloring
+    (g, make_iterator_property_map(order.begin(), identity_property_map()),
+     make_iterator_property_map(color.begin(), get(vertex_index, g)));
+  return color;
+}
+
+void check(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  std::size_t threads[] = { 1, 4, 0 };
+
+  // largest degree first and smallest last against the serial colorings
+  std::vector<std::size_t> degree(n);
+  std::vector<Vertex> order(n);
+  for (std::size_t v = 0; v < n; ++v) {
+    degree[v] = out_degree(v, g);
+    order[v] = v;
+  }
+  std::sort(order.begin(), order.end(), by_priority(degree));
+  size_type ldf_colors, sl_colors, natural_colors;
+  std::vector<size_type> ldf = sequential(g, order, ldf_colors);
+  std::vector<size_type> sl = sequential(g, smallest_last_vertex_ordering(g),
+                                         sl_colors);
+  for (std::size_t v = 0; v < n; ++v)
+    order[v] = v;
+  std::vector<size_type> natural = sequential(g, order, natural_colors);
+
+  for (int t = 0; t < 3; ++t) {
+    std::vector<size_type> color(n);
+    BOOST_CHECK(jones_plassmann_vertex_coloring
+                (g, make_iterator_property_map(color.begin(),
+                                               get(vertex_index, g)),
+                 threads[t]) == ldf_colors);
+    BOOST_CHECK(color == ldf);
+    BOOST_CHECK(smallest_last_vertex_coloring
+                (g, make_iterator_property_map(color.begin(),
+                                               get(vertex_index, g)),
+                 threads[t]) == sl_colors);
+    BOOST_CHECK(color == sl);
+
+    size_type num_colors = speculative_vertex_coloring
+      (g, make_iterator_property_map(color.begin(), get(vertex_index, g)),
+       threads[t]);
+    check_coloring(g, color, num_colors);
+    if (threads[t] == 1) {
+      BOOST_CHECK(num_colors == natural_colors);
+      BOOST_CHECK(color == natural);
+    }
+  }
+}
+
+int test_main(int, char*[])
+{
+  check(Graph());
+  check(Graph(1));
+  check(Graph(50));
+
+  // the graph of sequential_vertex_coloring.cpp, with a self-loop
+  typedef std::pair<int, int> Edge;
+  enum nodes {A, B, C, D, E, n};
+  Edge edge_array[] = { Edge(A, C), Edge(B, B), Edge(B, D), Edge(B, E),
+                        Edge(C, B), Edge(C, D), Edge(D, E), Edge(E, A),
+                        Edge(E, B) };
+  Graph small(edge_array, edge_array + sizeof(edge_array) / sizeof(Edge), n);
+  check(small);
+  std::vector<size_type> color(n);
+  BOOST_CHECK(speculative_vertex_coloring
+              (small, make_iterator_property_map(color.begin(),
+                                                 get(vertex_index, small)),
+               4) <= 3);
+
+  Graph complete(60);
+  for (std::size_t u = 0; u < 60; ++u)
+    for (std::size_t v = u + 1; v < 60; ++v)
+      add_edge(u, v, complete);
+  check(complete);
+
+  minstd_rand gen(1);
+  Graph sparse, dense, loops;
+  generate_random_graph(sparse, 5000, 20000, gen, true, true);
+  check(sparse);
+  generate_random_graph(dense, 20000, 200000, gen, true, true);
+  check(dense);
+  // parallel edges and self-loops
+  generate_random_graph(loops, 100, 3000, gen, true, true);
+  check(loops);
+  return 0;
+}
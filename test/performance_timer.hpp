@@ -0,0 +1,33 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_TEST_PERFORMANCE_TIMER_HPP
+#define BOOST_GRAPH_TEST_PERFORMANCE_TIMER_HPP
+
+// Wall-clock time for the *_performance drivers.  boost::timer measures CPU
+// time, which adds up the time of all threads of the parallel algorithms.
+
+#include <boost/config.hpp>
+#include <ctime>
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+#  include <chrono>
+#endif
+
+// Seconds since an arbitrary starting point; only differences are
+// meaningful.
+inline double now()
+{
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+  return std::chrono::duration<double>
+    (std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+  return double(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+#endif // BOOST_GRAPH_TEST_PERFORMANCE_TIMER_HPP
@@ -0,0 +1,171 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times the serial and the parallel push-relabel on the DIMACS instances in
+// prgen_input_graphs (read as undirected networks from the first to the
+// last vertex) and on a random network, and checks that the flows agree.
+//
+// usage: push_relabel_performance [path-to-libs-graph-test [vertices [threads]]]
+
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/edmonds_karp_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/read_dimacs.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list_traits<vecS, vecS, directedS> Traits;
+typedef adjacency_list<vecS, vecS, directedS,
+  property<vertex_color_t, default_color_type,
+  property<vertex_distance_t, long,
+  property<vertex_predecessor_t, Traits::edge_descriptor> > >,
+  property<edge_capacity_t, long,
+  property<edge_residual_capacity_t, long,
+  property<edge_reverse_t, Traits::edge_descriptor> > > > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef graph_traits<Graph>::edge_descriptor Edge;
+
+template <typename Algo>
+long run_serial(Graph& g, Vertex s, Vertex t, bool statistics)
+{
+  Algo algo(g, get(edge_capacity, g), get(edge_residual_capacity, g),
+            get(edge_reverse, g), s, t, get(vertex_index, g));
+  long flow = algo.maximum_preflow();
+  algo.convert_preflow_to_flow();
+  if (statistics)
+    algo.print_statistics(std::cout);
+  return flow;
+}
+
+template <typename Algo>
+long run_parallel(Graph& g, Vertex s, Vertex t, std::size_t threads,
+                  bool statistics)
+{
+  Algo algo(g, get(edge_capacity, g), get(edge_residual_capacity, g),
+            get(edge_reverse, g), s, t, get(vertex_index, g));
+  detail::parallel_push_relabel<Algo> parallel(algo, threads);
+  long flow = parallel.maximum_preflow();
+  algo.convert_preflow_to_flow();
+  BOOST_TEST(algo.is_flow());
+  if (statistics)
+    algo.print_statistics(std::cout);
+  return flow;
+}
+
+void benchmark(Graph& g, Vertex s, Vertex t, const std::string& name,
+               std::size_t threads, int repeat)
+{
+  typedef detail::push_relabel<Graph,
+    property_map<Graph, edge_capacity_t>::type,
+    property_map<Graph, edge_residual_capacity_t>::type,
+    property_map<Graph, edge_reverse_t>::type,
+    property_map<Graph, vertex_index_t>::type, long> Algo;
+
+  std::cout << name << ": " << num_vertices(g) << " vertices, "
+            << num_edges(g) / 2 << " arcs\n";
+  long expected = edmonds_karp_max_flow(g, s, t);
+
+  std::cout << "serial:\n";
+  long flow = run_serial<Algo>(g, s, t, true);
+  double start = now();
+  for (int i = 0; i < repeat; ++i)
+    run_serial<Algo>(g, s, t, false);
+  double serial_time = (now() - start) / repeat;
+  BOOST_TEST(flow == expected);
+
+  std::cout << "parallel, " << threads << " threads:\n";
+  flow = run_parallel<Algo>(g, s, t, threads, true);
+  start = now();
+  for (int i = 0; i < repeat; ++i)
+    run_parallel<Algo>(g, s, t, threads, false);
+  double parallel_time = (now() - start) / repeat;
+  BOOST_TEST(flow == expected);
+
+  BOOST_TEST(push_relabel_max_flow_parallel
+               (g, s, t, number_of_threads(threads)) == expected);
+
+  std::cout << "flow " << flow << ", serial " << serial_time
+            << " s, parallel " << parallel_time << " s\n\n";
+}
+
+void add_arc(Graph& g, Vertex u, Vertex v, long capacity)
+{
+  Edge e1 = add_edge(u, v, g).first;
+  Edge e2 = add_edge(v, u, g).first;
+  put(edge_capacity, g, e1, capacity);
+  put(edge_capacity, g, e2, 0);
+  put(edge_reverse, g, e1, e2);
+  put(edge_reverse, g, e2, e1);
+}
+
+// The prgen files describe undirected min-cut instances: every edge
+// becomes an arc in each direction.
+void read_prgen(Graph& g, const std::string& file)
+{
+  std::ifstream in(file.c_str());
+  BOOST_TEST(in.good());
+  read_dimacs_min_cut(g, get(edge_capacity, g), get(edge_reverse, g), in);
+  std::vector<Edge> arcs;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (get(edge_capacity, g, *ei) > 0)
+      arcs.push_back(*ei);
+  for (std::size_t i = 0; i < arcs.size(); ++i)
+    add_arc(g, target(arcs[i], g), source(arcs[i], g),
+            get(edge_capacity, g, arcs[i]));
+}
+
+void make_random_network(Graph& g, std::size_t n, int seed)
+{
+  minstd_rand gen(seed);
+  Graph tmp;
+  generate_random_graph(tmp, n, 8 * n, gen, false, false);
+  g = Graph(n);
+  uniform_int<long> cap_dist(1, 1000);
+  variate_generator<minstd_rand&, uniform_int<long> > random_cap(gen, cap_dist);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(tmp); ei != ei_end; ++ei)
+    add_arc(g, source(*ei, tmp), target(*ei, tmp), random_cap());
+}
+
+int main(int argc, char* argv[])
+{
+  std::string test_dir = argc > 1 ? argv[1] : ".";
+  std::size_t n = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 20000;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3])
+                                 : detail::resolve_number_of_threads(0);
+  if (threads < 2)
+    threads = 2;
+
+  const char* files[] = { "prgen_20_70_2.net", "prgen_50_40_2.net",
+                          "prgen_50_70_2.net" };
+  for (std::size_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+    Graph g;
+    read_prgen(g, test_dir + "/prgen_input_graphs/" + files[i]);
+    benchmark(g, 0, num_vertices(g) - 1, files[i], threads, 200);
+  }
+
+  for (int seed = 1; seed <= 3; ++seed) {
+    Graph g;
+    make_random_network(g, n, seed);
+    benchmark(g, 0, n - 1, "random " + lexical_cast<std::string>(seed),
+              threads, 3);
+  }
+  return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times r_c_shortest_paths on a random shortest path problem with time
+// windows, as it arises in the pricing step of column generation for
+// vehicle routing: with the standard allocator and no dominance key, with
+// the default pool allocator, and with the pool allocator and the cost, or
+// the cost and the time, as dominance keys, and with the two keys on
+// several threads.  All runs must find the same pareto-optimal solutions.
+//
+// usage: r_c_shortest_paths_performance [vertices [degree [horizon
+//                                        [threads]]]]
+
+#include <boost/graph/r_c_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+struct Vertex_Prop
+{
+  Vertex_Prop( int n = 0, int e = 0, int l = 0 ) : num( n ), eat( e ), lat( l ) {}
+  int num;
+  int eat;
+  int lat;
+};
+
+struct Arc_Prop
+{
+  Arc_Prop( int n = 0, int c = 0, int t = 0 ) : num( n ), cost( c ), time( t ) {}
+  int num;
+  int cost;
+  int time;
+};
+
+typedef adjacency_list<vecS, vecS, directedS, Vertex_Prop, Arc_Prop> Graph;
+typedef graph_traits<Graph>::edge_descriptor Edge;
+
+struct Resources
+{
+  Resources( int c = 0, int t = 0 ) : cost( c ), time( t ) {}
+  int cost;
+  int time;
+};
+
+bool operator==( const Resources& r1, const Resources& r2 )
+{
+  return r1.cost == r2.cost && r1.time == r2.time;
+}
+
+bool operator<( const Resources& r1, const Resources& r2 )
+{
+  return r1.cost < r2.cost || ( r1.cost == r2.cost && r1.time < r2.time );
+}
+
+struct Extension
+{
+  bool operator()( const Graph& g, Resources& new_res, 
+                   const Resources& old_res, Edge ed ) const
+  {
+    new_res.cost = old_res.cost + g[ed].cost;
+    new_res.time = (std::max)( old_res.time + g[ed].time, 
+                               g[target( ed, g )].eat );
+    return new_res.time <= g[target( ed, g )].lat;
+  }
+};
+
+struct Dominance
+{
+  bool operator()( const Resources& r1, const Resources& r2 ) const
+  {
+    return r1.cost <= r2.cost && r1.time <= r2.time;
+  }
+};
+
+struct Cost_Key
+{
+  int operator()( const Resources& r ) const { return r.cost; }
+};
+
+struct Time_Key
+{
+  int operator()( const Resources& r ) const { return r.time; }
+};
+
+// Customers with time windows within the horizon, and arcs to customers
+// whose windows close later, with reduced costs that are often negative.
+// The depot is split into a source 0 and a sink n - 1.
+void make_graph( Graph& g, int n, int degree, int horizon )
+{
+  minstd_rand gen( 1 );
+  uniform_int<int> start_dist( 0, horizon ), width_dist( 1, horizon / 2 ), 
+    cost_dist( -20, 30 ), time_dist( 1, horizon / 20 );
+  g = Graph();
+  add_vertex( Vertex_Prop( 0, 0, horizon ), g );
+  for( int i = 1; i + 1 < n; ++i )
+  {
+    int eat = start_dist( gen );
+    add_vertex( Vertex_Prop( i, eat, eat + width_dist( gen ) ), g );
+  }
+  add_vertex( Vertex_Prop( n - 1, 0, 2 * horizon ), g );
+  int num = 0;
+  uniform_int<int> customer_dist( 1, n - 2 );
+  for( int i = 1; i + 1 < n; ++i )
+  {
+    add_edge( 0, i, Arc_Prop( num++, cost_dist( gen ), time_dist( gen ) ), g );
+    add_edge( i, n - 1, Arc_Prop( num++, 0, 0 ), g );
+    for( int k = 0; k < degree; ++k )
+    {
+      int j = customer_dist( gen );
+      if( g[j].lat > g[i].eat )
+        add_edge( i, j, 
+                  Arc_Prop( num++, cost_dist( gen ), time_dist( gen ) ), g );
+    }
+  }
+}
+
+template<class Allocator, class Dominance_Function>
+double run( const Graph& g, const Dominance_Function& dominance, 
+            std::vector<Resources>& pareto_optimal_resources, 
+            std::size_t threads = 1 )
+{
+  std::vector<std::vector<Edge> > pareto_optimal_solutions;
+  double start = now();
+  r_c_shortest_paths( g, get( &Vertex_Prop::num, g ), 
+                      get( &Arc_Prop::num, g ), 
+                      0, num_vertices( g ) - 1, 
+                      pareto_optimal_solutions, pareto_optimal_resources, 
+                      Resources( 0, 0 ), Extension(), dominance, 
+                      Allocator(), default_r_c_shortest_paths_visitor(), 
+                      threads );
+  return now() - start;
+}
+
+int main( int argc, char* argv[] )
+{
+  int n = argc > 1 ? lexical_cast<int>( argv[1] ) : 2000;
+  int degree = argc > 2 ? lexical_cast<int>( argv[2] ) : 10;
+  int horizon = argc > 3 ? lexical_cast<int>( argv[3] ) : 1000;
+  std::size_t threads = 
+    argc > 4 ? lexical_cast<std::size_t>( argv[4] ) : 4;
+  Graph g;
+  make_graph( g, n, degree, horizon );
+  std::cout << num_vertices( g ) << " vertices, " << num_edges( g ) 
+            << " arcs\n";
+
+  std::vector<Resources> plain, pooled, keyed, two_keys, parallel;
+  std::cout << "  std::allocator: " 
+            << run<std::allocator<int> >( g, Dominance(), plain ) << " s\n";
+  std::cout << "  pool allocator: " 
+            << run<r_c_shortest_paths_pool_allocator<int> >
+                 ( g, Dominance(), pooled ) << " s\n";
+  std::cout << "  pool allocator, cost as dominance key: " 
+            << run<r_c_shortest_paths_pool_allocator<int> >
+                 ( g, make_keyed_dominance( Dominance(), Cost_Key() ), keyed ) 
+            << " s\n";
+  std::cout << "  pool allocator, cost and time as dominance keys: " 
+            << run<r_c_shortest_paths_pool_allocator<int> >
+                 ( g, make_keyed_dominance( Dominance(), Cost_Key(), 
+                                            Time_Key() ), two_keys ) 
+            << " s\n";
+  std::cout << "  pool allocator, cost and time as dominance keys, " 
+            << threads << " threads: " 
+            << run<r_c_shortest_paths_pool_allocator<int> >
+                 ( g, make_keyed_dominance( Dominance(), Cost_Key(), 
+                                            Time_Key() ), parallel, threads ) 
+            << " s\n";
+  std::cout << "  " << plain.size() << " pareto-optimal solutions\n";
+  BOOST_TEST( pooled == plain );
+  BOOST_TEST( keyed == plain );
+  BOOST_TEST( two_keys == plain );
+  // the parallel run reports the solutions in the order of their resources
+  std::sort( plain.begin(), plain.end() );
+  BOOST_TEST( parallel == plain );
+  return boost::report_errors();
+}
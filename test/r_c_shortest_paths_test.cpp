@@ -13,7 +13,10 @@
 //#include <boost/graph/dijkstra_shortest_paths.hpp>
 
 #include <boost/graph/r_c_shortest_paths.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
 #include <iostream>
+#include <set>
 #include <boost/test/minimal.hpp>
 
 using namespace boost;
@@ -197,8 +200,350 @@ public:
     // for tie-breaking
   }
 };
+// dominance keys: a label can only be dominated by labels that are not 
+// more expensive and not later
+struct spptw_cost_key
+{
+  int operator()( const spp_spptw_res_cont& rc ) const { return rc.cost; }
+};
+
+struct spptw_time_key
+{
+  int operator()( const spp_spptw_res_cont& rc ) const { return rc.time; }
+};
+
+// the bidirectional label setting needs the in-edges of the graph
+typedef adjacency_list<vecS, 
+                       vecS, 
+                       bidirectionalS, 
+                       SPPRC_Example_Graph_Vert_Prop, 
+                       SPPRC_Example_Graph_Arc_Prop> 
+  SPPRC_Bidirectional_Graph;
+
+// ref_spptw on the bidirectional graph
+class ref_spptw_forward
+{
+public:
+  inline bool operator()( const SPPRC_Bidirectional_Graph& g, 
+                          spp_spptw_res_cont& new_cont, 
+                          const spp_spptw_res_cont& old_cont, 
+                          graph_traits
+                            <SPPRC_Bidirectional_Graph>::edge_descriptor ed ) 
+    const
+  {
+    new_cont.cost = old_cont.cost + g[ed].cost;
+    new_cont.time = (std::max)( old_cont.time + g[ed].time, 
+                                g[target( ed, g )].eat );
+    return new_cont.time <= g[target( ed, g )].lat;
+  }
+};
+
+// backward extension, halfway point and join for instances in which every 
+// latest arrival time is the same capacity and no earliest arrival time 
+// is positive: the time is then a load that the arcs add up, and the 
+// backward labels hold the load from their vertex to t
+class ref_spptw_backward
+{
+public:
+  inline bool operator()( const SPPRC_Bidirectional_Graph& g, 
+                          spp_spptw_res_cont& new_cont, 
+                          const spp_spptw_res_cont& old_cont, 
+                          graph_traits
+                            <SPPRC_Bidirectional_Graph>::edge_descriptor ed ) 
+    const
+  {
+    new_cont.cost = old_cont.cost + g[ed].cost;
+    new_cont.time = old_cont.time + g[ed].time;
+    return new_cont.time <= g[source( ed, g )].lat;
+  }
+};
+
+struct halfway_spptw
+{
+  halfway_spptw( int c ) : capacity( c ) {}
+  bool operator()( const spp_spptw_res_cont& rc, bool /*b_forward*/ ) const
+  {
+    return 2 * rc.time > capacity;
+  }
+  int capacity;
+};
+
+class join_spptw
+{
+public:
+  inline bool operator()( const SPPRC_Bidirectional_Graph& g, 
+                          spp_spptw_res_cont& result, 
+                          const spp_spptw_res_cont& forward_cont, 
+                          const spp_spptw_res_cont& backward_cont, 
+                          graph_traits
+                            <SPPRC_Bidirectional_Graph>::edge_descriptor ed ) 
+    const
+  {
+    result.cost = forward_cont.cost + g[ed].cost + backward_cont.cost;
+    result.time = forward_cont.time + g[ed].time + backward_cont.time;
+    return result.time <= g[target( ed, g )].lat;
+  }
+};
 // end data structures for shortest path problem with time windows (spptw)
 
+// a random instance with time windows; every arc takes some time, so that 
+// only finitely many labels are feasible
+void random_spptw_graph( SPPRC_Example_Graph& g, int n, int m, 
+                         minstd_rand& gen )
+{
+  g = SPPRC_Example_Graph();
+  uniform_int<int> vertex_dist( 0, n - 1 ), cost_dist( -5, 20 ), 
+    time_dist( 1, 8 ), window_dist( 0, 30 );
+  for( int i = 0; i < n; ++i )
+  {
+    int eat = window_dist( gen );
+    add_vertex
+      ( SPPRC_Example_Graph_Vert_Prop( i, eat, eat + window_dist( gen ) ), g );
+  }
+  for( int i = 0; i < m; ++i )
+    add_edge( vertex_dist( gen ), vertex_dist( gen ), 
+              SPPRC_Example_Graph_Arc_Prop
+                ( i, cost_dist( gen ), time_dist( gen ) ), g );
+}
+
+// a random instance in which the time is a load limited by capacity
+void random_capacity_graph( SPPRC_Example_Graph& g, int n, int m, 
+                            int capacity, minstd_rand& gen )
+{
+  g = SPPRC_Example_Graph();
+  uniform_int<int> vertex_dist( 0, n - 1 ), cost_dist( -5, 20 ), 
+    time_dist( 1, 8 );
+  for( int i = 0; i < n; ++i )
+    add_vertex( SPPRC_Example_Graph_Vert_Prop( i, 0, capacity ), g );
+  for( int i = 0; i < m; ++i )
+    add_edge( vertex_dist( gen ), vertex_dist( gen ), 
+              SPPRC_Example_Graph_Arc_Prop
+                ( i, cost_dist( gen ), time_dist( gen ) ), g );
+}
+
+// the pareto-optimal (cost, time) pairs at t, by enumerating all feasible 
+// labels
+std::set<std::pair<int, int> > 
+enumerated_pareto_front( const SPPRC_Example_Graph& g, int s, int t )
+{
+  std::set<std::pair<int, std::pair<int, int> > > seen;
+  std::vector<std::pair<int, spp_spptw_res_cont> > stack;
+  stack.push_back( std::make_pair( s, spp_spptw_res_cont( 0, 0 ) ) );
+  seen.insert( std::make_pair( s, std::make_pair( 0, 0 ) ) );
+  std::vector<std::pair<int, int> > at_t;
+  while( !stack.empty() )
+  {
+    std::pair<int, spp_spptw_res_cont> cur = stack.back();
+    stack.pop_back();
+    if( cur.first == t )
+      at_t.push_back( std::make_pair( cur.second.cost, cur.second.time ) );
+    graph_traits<SPPRC_Example_Graph>::out_edge_iterator oei, oei_end;
+    for( boost::tie( oei, oei_end ) = out_edges( cur.first, g ); 
+         oei != oei_end; ++oei )
+    {
+      spp_spptw_res_cont next;
+      int v = static_cast<int>( target( *oei, g ) );
+      if( ref_spptw()( g, next, cur.second, *oei ) 
+          && seen.insert( std::make_pair
+                ( v, std::make_pair( next.cost, next.time ) ) ).second )
+        stack.push_back( std::make_pair( v, next ) );
+    }
+  }
+  std::set<std::pair<int, int> > front;
+  for( size_t i = 0; i < at_t.size(); ++i )
+  {
+    bool b_dominated = false;
+    for( size_t j = 0; j < at_t.size() && !b_dominated; ++j )
+      b_dominated = at_t[j] != at_t[i] 
+                    && at_t[j].first <= at_t[i].first 
+                    && at_t[j].second <= at_t[i].second;
+    if( !b_dominated )
+      front.insert( at_t[i] );
+  }
+  return front;
+}
+
+// compares r_c_shortest_paths with the standard allocator, with the pool 
+// allocator and with dominance keys against enumeration
+void test_random_instances()
+{
+  typedef graph_traits<SPPRC_Example_Graph>::edge_descriptor Edge;
+  minstd_rand gen( 17 );
+  for( int i = 0; i < 60; ++i )
+  {
+    SPPRC_Example_Graph g;
+    random_spptw_graph( g, 4 + i % 7, 8 + i % 23, gen );
+    int s = 0, t = static_cast<int>( num_vertices( g ) ) - 1;
+
+    std::vector<std::vector<Edge> > solutions[3];
+    std::vector<spp_spptw_res_cont> rcs[3];
+    r_c_shortest_paths( g, 
+                        get( &SPPRC_Example_Graph_Vert_Prop::num, g ), 
+                        get( &SPPRC_Example_Graph_Arc_Prop::num, g ), 
+                        s, t, solutions[0], rcs[0], 
+                        spp_spptw_res_cont( 0, 0 ), 
+                        ref_spptw(), 
+                        dominance_spptw(), 
+                        std::allocator<int>(), 
+                        default_r_c_shortest_paths_visitor() );
+    r_c_shortest_paths( g, 
+                        get( &SPPRC_Example_Graph_Vert_Prop::num, g ), 
+                        get( &SPPRC_Example_Graph_Arc_Prop::num, g ), 
+                        s, t, solutions[1], rcs[1], 
+                        spp_spptw_res_cont( 0, 0 ), 
+                        ref_spptw(), 
+                        make_keyed_dominance
+                          ( dominance_spptw(), spptw_cost_key() ) );
+    r_c_shortest_paths( g, 
+                        get( &SPPRC_Example_Graph_Vert_Prop::num, g ), 
+                        get( &SPPRC_Example_Graph_Arc_Prop::num, g ), 
+                        s, t, solutions[2], rcs[2], 
+                        spp_spptw_res_cont( 0, 0 ), 
+                        ref_spptw(), 
+                        make_keyed_dominance
+                          ( dominance_spptw(), spptw_time_key() ) );
+
+    std::set<std::pair<int, int> > front = 
+      enumerated_pareto_front( g, s, t );
+    for( int k = 0; k < 3; ++k )
+    {
+      BOOST_CHECK( solutions[k] == solutions[0] );
+      BOOST_CHECK( rcs[k] == rcs[0] );
+      std::set<std::pair<int, int> > found;
+      for( size_t j = 0; j < rcs[k].size(); ++j )
+        found.insert( std::make_pair( rcs[k][j].cost, rcs[k][j].time ) );
+      BOOST_CHECK( found == front && found.size() == rcs[k].size() );
+    }
+    for( size_t j = 0; j < solutions[0].size(); ++j )
+    {
+      spp_spptw_res_cont actual_final_rc;
+      bool b_is_a_path_at_all = false;
+      bool b_feasible = false;
+      bool b_correctly_extended = false;
+      Edge ed_last_extended_arc;
+      // the solution lists the arcs from t back to s; walks with cycles 
+      // are not recognized reliably in that order
+      std::vector<Edge> path( solutions[0][j].rbegin(), 
+                              solutions[0][j].rend() );
+      check_r_c_path( g, path, spp_spptw_res_cont( 0, 0 ), 
+                      true, rcs[0][j], actual_final_rc, ref_spptw(), 
+                      b_is_a_path_at_all, b_feasible, 
+                      b_correctly_extended, ed_last_extended_arc );
+      BOOST_CHECK( b_is_a_path_at_all && b_feasible 
+                   && b_correctly_extended );
+    }
+  }
+}
+
+// whether the solutions are paths from s to t with the given resource 
+// consumptions and their (cost, time) pairs are front
+template<class Graph, class Resource_Extension_Function>
+bool check_solutions
+( const Graph& g, int s, int t, 
+  const std::vector<std::vector
+    <typename graph_traits<Graph>::edge_descriptor> >& solutions, 
+  const std::vector<spp_spptw_res_cont>& rcs, 
+  const std::set<std::pair<int, int> >& front, 
+  Resource_Extension_Function ref )
+{
+  typedef typename graph_traits<Graph>::edge_descriptor Edge;
+  std::set<std::pair<int, int> > found;
+  for( size_t j = 0; j < rcs.size(); ++j )
+  {
+    found.insert( std::make_pair( rcs[j].cost, rcs[j].time ) );
+    std::vector<Edge> path( solutions[j].rbegin(), solutions[j].rend() );
+    if( path.empty() || static_cast<int>( source( path[0], g ) ) != s 
+        || static_cast<int>( target( path.back(), g ) ) != t )
+      return false;
+    spp_spptw_res_cont actual_final_rc;
+    bool b_is_a_path_at_all = false;
+    bool b_feasible = false;
+    bool b_correctly_extended = false;
+    Edge ed_last_extended_arc;
+    check_r_c_path( g, path, spp_spptw_res_cont( 0, 0 ), 
+                    true, rcs[j], actual_final_rc, ref, 
+                    b_is_a_path_at_all, b_feasible, 
+                    b_correctly_extended, ed_last_extended_arc );
+    if( !b_is_a_path_at_all || !b_feasible || !b_correctly_extended )
+      return false;
+  }
+  return found == front && found.size() == rcs.size();
+}
+
+// compares the parallel and the bidirectional label setting against 
+// enumeration
+void test_parallel_and_bidirectional()
+{
+  typedef graph_traits<SPPRC_Example_Graph>::edge_descriptor Edge;
+  minstd_rand gen( 23 );
+  for( int i = 0; i < 80; ++i )
+  {
+    SPPRC_Example_Graph g;
+    const int capacity = 10 + i % 25;
+    if( i % 2 == 0 )
+      random_spptw_graph( g, 4 + i % 9, 8 + i % 29, gen );
+    else
+      random_capacity_graph( g, 4 + i % 9, 8 + i % 29, capacity, gen );
+    int s = 0, t = static_cast<int>( num_vertices( g ) ) - 1;
+    std::set<std::pair<int, int> > front = 
+      enumerated_pareto_front( g, s, t );
+
+    std::vector<std::vector<Edge> > solutions;
+    std::vector<spp_spptw_res_cont> rcs;
+    r_c_shortest_paths( g, 
+                        get( &SPPRC_Example_Graph_Vert_Prop::num, g ), 
+                        get( &SPPRC_Example_Graph_Arc_Prop::num, g ), 
+                        s, t, solutions, rcs, 
+                        spp_spptw_res_cont( 0, 0 ), 
+                        ref_spptw(), 
+                        make_keyed_dominance
+                          ( dominance_spptw(), spptw_cost_key() ), 
+                        default_r_c_shortest_paths_allocator(), 
+                        default_r_c_shortest_paths_visitor(), 
+                        4 );
+    BOOST_CHECK( check_solutions( g, s, t, solutions, rcs, front, 
+                                  ref_spptw() ) );
+    // with several threads, the solutions are ordered by their resource 
+    // consumption
+    for( size_t j = 1; j < rcs.size(); ++j )
+      BOOST_CHECK( !( rcs[j] < rcs[j - 1] ) );
+
+    if( i % 2 == 0 )
+      continue;
+    // the same instance with in-edges
+    SPPRC_Bidirectional_Graph bg( num_vertices( g ) );
+    for( int v = 0; v < static_cast<int>( num_vertices( g ) ); ++v )
+      bg[v] = g[v];
+    graph_traits<SPPRC_Example_Graph>::edge_iterator ei, ei_end;
+    for( boost::tie( ei, ei_end ) = edges( g ); ei != ei_end; ++ei )
+      add_edge( source( *ei, g ), target( *ei, g ), g[*ei], bg );
+    std::vector<std::vector
+      <graph_traits<SPPRC_Bidirectional_Graph>::edge_descriptor> > 
+      bidirectional_solutions;
+    for( std::size_t threads = 1; threads <= 4; threads += 3 )
+    {
+      r_c_shortest_paths_bidirectional
+        ( bg, 
+          get( &SPPRC_Example_Graph_Vert_Prop::num, bg ), 
+          get( &SPPRC_Example_Graph_Arc_Prop::num, bg ), 
+          s, t, bidirectional_solutions, rcs, 
+          spp_spptw_res_cont( 0, 0 ), 
+          spp_spptw_res_cont( 0, 0 ), 
+          ref_spptw_forward(), 
+          ref_spptw_backward(), 
+          dominance_spptw(), 
+          make_keyed_dominance( dominance_spptw(), spptw_time_key() ), 
+          halfway_spptw( capacity ), 
+          join_spptw(), 
+          default_r_c_shortest_paths_allocator(), 
+          default_r_c_shortest_paths_visitor(), 
+          threads );
+      BOOST_CHECK( check_solutions( bg, s, t, bidirectional_solutions, rcs, 
+                                    front, ref_spptw_forward() ) );
+    }
+  }
+}
+
 int test_main(int, char*[])
 {
   SPPRC_Example_Graph g;
@@ -637,5 +982,8 @@ int test_main(int, char*[])
 
   BOOST_CHECK(pareto_opt_rc.cost == 3);
 
+  test_random_instances();
+  test_parallel_and_bidirectional();
+
   return 0;
 }
@@ -0,0 +1,76 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares reachability_index and reachability_closure with a
+// breadth-first search from every vertex.
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/reachability_index.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, directedS> Graph;
+
+void test_graph(const Graph& g)
+{
+  const std::size_t n = num_vertices(g);
+  reachability_index<Graph> index(g);
+  reachability_index<Graph> parallel_index(g, get(vertex_index, g), 5, 4);
+  reachability_closure<Graph> closure(g);
+  reachability_closure<Graph> parallel_closure(g, 4);
+  reachability_index<Graph>::workspace ws;
+
+  for (std::size_t u = 0; u < n; ++u) {
+    std::vector<default_color_type> color(n, white_color);
+    breadth_first_search(g, u, color_map(&color[0]));
+    for (std::size_t v = 0; v < n; ++v) {
+      bool expected = color[v] != white_color;
+      BOOST_CHECK(index.reachable(u, v) == expected);
+      BOOST_CHECK(parallel_index.reachable(u, v, ws) == expected);
+      BOOST_CHECK(closure.reachable(u, v) == expected);
+      BOOST_CHECK(parallel_closure.reachable(u, v) == expected);
+    }
+  }
+  BOOST_CHECK(index.num_components() == closure.num_components());
+}
+
+int test_main(int, char*[])
+{
+  minstd_rand gen(17);
+
+  // Sparse enough to leave many small strong components.
+  Graph sparse;
+  generate_random_graph(sparse, 400, 500, gen, true, false);
+  test_graph(sparse);
+
+  // A denser DAG.
+  Graph dag(300);
+  for (std::size_t i = 0; i < 2000; ++i) {
+    std::size_t a = gen() % 300, b = gen() % 300;
+    if (a < b)
+      add_edge(a, b, dag);
+  }
+  test_graph(dag);
+
+  // One big cycle plus a tail.
+  Graph ring(70);
+  for (std::size_t i = 0; i < 50; ++i)
+    add_edge(i, (i + 1) % 50, ring);
+  for (std::size_t i = 50; i < 69; ++i)
+    add_edge(i, i + 1, ring);
+  add_edge(10, 50, ring);
+  test_graph(ring);
+
+  test_graph(Graph());
+  return 0;
+}
@@ -0,0 +1,166 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks that stress_majorization_layout() keeps the graph distances of
+// paths, cycles and grids, in the plane and in space, with weights and
+// with a side length, that it does not depend on the number of threads,
+// and that it leaves the layout of a disconnected graph alone.
+
+#include <boost/graph/stress_majorization_layout.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/test/minimal.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, double> > Graph;
+typedef square_topology<>::point_type Point;
+
+Graph grid(std::size_t width)
+{
+  Graph g(width * width);
+  for (std::size_t x = 0; x < width; ++x)
+    for (std::size_t y = 0; y < width; ++y) {
+      if (x + 1 < width)
+        add_edge(x * width + y, (x + 1) * width + y, 1., g);
+      if (y + 1 < width)
+        add_edge(x * width + y, x * width + y + 1, 1., g);
+    }
+  return g;
+}
+
+template<typename Topology>
+std::vector<typename Topology::point_type>
+layout(const Graph& g, const Topology& topology, double length,
+       std::size_t pivots, std::size_t threads, bool connected = true)
+{
+  typedef typename Topology::point_type P;
+  std::vector<P> pos(num_vertices(g));
+  BOOST_CHECK(stress_majorization_layout
+                (g, make_iterator_property_map(pos.begin(),
+                                               get(vertex_index, g)),
+                 get(edge_weight, g), topology, edge_length(length),
+                 layout_tolerance<double>(), pivots, get(vertex_index, g),
+                 threads) == connected);
+  return pos;
+}
+
+template<typename P>
+double length_between(const P& a, const P& b)
+{
+  double d = 0.;
+  for (std::size_t c = 0; c < P::dimensions; ++c)
+    d += (a[c] - b[c]) * (a[c] - b[c]);
+  return std::sqrt(d);
+}
+
+// The largest relative error of the edge lengths.
+template<typename P>
+double edge_error(const Graph& g, const std::vector<P>& pos, double length)
+{
+  double error = 0.;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    double want = length * get(edge_weight, g, *ei);
+    double d = length_between(pos[source(*ei, g)], pos[target(*ei, g)]);
+    error = (std::max)(error, std::abs(d - want) / want);
+  }
+  return error;
+}
+
+bool same(const std::vector<Point>& a, const std::vector<Point>& b)
+{
+  for (std::size_t i = 0; i < a.size(); ++i)
+    if (a[i][0] != b[i][0] || a[i][1] != b[i][1])
+      return false;
+  return true;
+}
+
+int test_main(int, char*[])
+{
+  minstd_rand gen(1);
+  square_topology<> square(gen, 50.);
+  cube_topology<> cube(gen, 50.);
+
+  layout(Graph(), square, 1., 10, 1);
+  std::vector<Point> pos = layout(Graph(1), square, 1., 10, 1);
+  BOOST_CHECK(pos[0][0] == square.center()[0]
+              && pos[0][1] == square.center()[1]);
+
+  // a weighted path lies straight, with more pivots than vertices
+  Graph path(4);
+  add_edge(0, 1, 1., path);
+  add_edge(1, 2, 2., path);
+  add_edge(2, 3, 3., path);
+  pos = layout(path, square, 2., 10, 1);
+  BOOST_CHECK(edge_error(path, pos, 2.) < 1e-3);
+  BOOST_CHECK(std::abs(length_between(pos[0], pos[3]) - 12.) < 1e-2);
+
+  // a cycle folds into a loop, its opposite vertices farthest apart
+  Graph cycle(12);
+  for (std::size_t i = 0; i < 12; ++i)
+    add_edge(i, (i + 1) % 12, 1., cycle);
+  pos = layout(cycle, square, 1., 4, 1);
+  for (std::size_t i = 1; i < 6; ++i)
+    BOOST_CHECK(length_between(pos[0], pos[6])
+                > length_between(pos[0], pos[i]));
+
+  // with every vertex a pivot, the stress is the full one; the grid
+  // bulges under the distances between its far vertices alike
+  Graph g = grid(20);
+  std::vector<Point> full = layout(g, square, 1., 400, 1);
+  pos = layout(g, square, 1., 20, 1);
+  BOOST_CHECK(edge_error(g, pos, 1.) < 0.6);
+  BOOST_CHECK(std::abs(length_between(pos[0], pos[399])
+                       / length_between(full[0], full[399]) - 1.) < 0.05);
+  BOOST_CHECK(std::abs(length_between(pos[0], pos[19])
+                       / length_between(full[0], full[19]) - 1.) < 0.05);
+  BOOST_CHECK(same(pos, layout(g, square, 1., 20, 4)));
+  BOOST_CHECK(same(pos, layout(g, square, 1., 20, 0)));
+
+  // called with the arguments of kamada_kawai_spring_layout()
+  std::vector<Point> plain(num_vertices(g)), threaded(num_vertices(g));
+  stress_majorization_layout
+    (g, make_iterator_property_map(plain.begin(), get(vertex_index, g)),
+     get(edge_weight, g), square, edge_length(1.), layout_tolerance<double>());
+  BOOST_CHECK(same(plain, layout(g, square, 1., 50, 1)));
+  stress_majorization_layout
+    (g, make_iterator_property_map(threaded.begin(), get(vertex_index, g)),
+     get(edge_weight, g), square, edge_length(1.), layout_tolerance<double>(),
+     20, 4);
+  BOOST_CHECK(same(threaded, pos));
+
+  // the largest distance from a pivot, corner to corner, is 38 edges
+  std::vector<Point> sided(num_vertices(g));
+  stress_majorization_layout
+    (g, make_iterator_property_map(sided.begin(), get(vertex_index, g)),
+     get(edge_weight, g), square, side_length(19.));
+  BOOST_CHECK(std::abs(length_between(sided[0], sided[399])
+                       / length_between(pos[0], pos[399]) - 0.5) < 0.01);
+
+  Graph small = grid(8);
+  std::vector<cube_topology<>::point_type> spaced = layout(small, cube, 1.,
+                                                           10, 2);
+  BOOST_CHECK(edge_error(small, spaced, 1.) < 0.6);
+
+  Graph split(4);
+  add_edge(0, 1, 1., split);
+  add_edge(2, 3, 1., split);
+  std::vector<Point> kept(4, square.center());
+  kept[3][0] = 7.;
+  BOOST_CHECK(!stress_majorization_layout
+                (split, make_iterator_property_map(kept.begin(),
+                                                   get(vertex_index, split)),
+                 get(edge_weight, split), square, edge_length(1.)));
+  BOOST_CHECK(kept[3][0] == 7.);
+  return 0;
+}
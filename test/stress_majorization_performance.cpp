@@ -0,0 +1,143 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times kamada_kawai_spring_layout(), from a random layout, and
+// stress_majorization_layout() on a small square grid and prints the
+// stress of both layouts over all pairs of vertices, then
+// times stress_majorization_layout() on a large grid, on one and several
+// threads, and prints the largest relative error of its edge lengths.
+//
+// usage: stress_majorization_performance [side [large_side [threads]]]
+
+#include <boost/graph/stress_majorization_layout.hpp>
+#include <boost/graph/kamada_kawai_spring_layout.hpp>
+#include <boost/graph/random_layout.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/topology.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, double> > Graph;
+typedef square_topology<> Topology;
+typedef Topology::point_type Point;
+typedef iterator_property_map<std::vector<Point>::iterator,
+                              property_map<Graph, vertex_index_t>::type>
+  PositionMap;
+
+Graph grid(std::size_t side)
+{
+  Graph g(side * side);
+  for (std::size_t x = 0; x < side; ++x)
+    for (std::size_t y = 0; y < side; ++y) {
+      if (x + 1 < side)
+        add_edge(x * side + y, (x + 1) * side + y, 1., g);
+      if (y + 1 < side)
+        add_edge(x * side + y, x * side + y + 1, 1., g);
+    }
+  return g;
+}
+
+double length_between(const Point& a, const Point& b)
+{
+  return std::sqrt((a[0] - b[0]) * (a[0] - b[0])
+                   + (a[1] - b[1]) * (a[1] - b[1]));
+}
+
+// The stress over all pairs of vertices, from a breadth-first search
+// out of each.
+double full_stress(const Graph& g, const std::vector<Point>& pos)
+{
+  double stress = 0.;
+  std::vector<std::size_t> d(num_vertices(g));
+  for (std::size_t s = 0; s < num_vertices(g); ++s) {
+    std::fill(d.begin(), d.end(), 0);
+    breadth_first_search
+      (g, s, visitor(make_bfs_visitor
+                       (record_distances(&d[0], on_tree_edge()))));
+    for (std::size_t t = s + 1; t < num_vertices(g); ++t) {
+      double error = length_between(pos[s], pos[t]) - double(d[t]);
+      stress += error * error / (double(d[t]) * double(d[t]));
+    }
+  }
+  return stress;
+}
+
+double edge_error(const Graph& g, const std::vector<Point>& pos)
+{
+  double error = 0.;
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    error = (std::max)(error, std::abs(length_between(pos[source(*ei, g)],
+                                                      pos[target(*ei, g)])
+                                       - 1.));
+  return error;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 15;
+  std::size_t large = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 200;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 4;
+  Topology topology(50.);
+
+  Graph g = grid(side);
+  std::cout << "grid: " << num_vertices(g) << " vertices, " << num_edges(g)
+            << " edges" << std::endl;
+  std::vector<Point> pos(num_vertices(g));
+  PositionMap position(pos.begin(), get(vertex_index, g));
+  minstd_rand gen(1);
+  random_graph_layout(g, position, Topology(gen, double(side) / 2.));
+  double t = now();
+  BOOST_TEST(kamada_kawai_spring_layout(g, position, get(edge_weight, g),
+                                        topology, edge_length(1.),
+                                        layout_tolerance<double>(1e-5)));
+  std::cout << "  kamada_kawai_spring_layout: " << now() - t
+            << " s, full stress " << full_stress(g, pos)
+            << ", largest edge error " << edge_error(g, pos) << std::endl;
+  t = now();
+  BOOST_TEST(stress_majorization_layout(g, position, get(edge_weight, g),
+                                        topology, edge_length(1.)));
+  std::cout << "  stress_majorization_layout: " << now() - t
+            << " s, full stress " << full_stress(g, pos)
+            << ", largest edge error " << edge_error(g, pos) << std::endl;
+
+  g = grid(large);
+  std::cout << "grid: " << num_vertices(g) << " vertices, " << num_edges(g)
+            << " edges" << std::endl;
+  std::size_t runs[] = { 1, threads };
+  std::vector<Point> first;
+  for (int r = 0; r < 2; ++r) {
+    pos.assign(num_vertices(g), Point());
+    PositionMap large_position(pos.begin(), get(vertex_index, g));
+    t = now();
+    BOOST_TEST(stress_majorization_layout(g, large_position,
+                                          get(edge_weight, g), topology,
+                                          edge_length(1.),
+                                          layout_tolerance<double>(), 50,
+                                          runs[r]));
+    std::cout << "  stress_majorization_layout, " << runs[r] << " threads: "
+              << now() - t << " s, largest edge error " << edge_error(g, pos)
+              << std::endl;
+    if (r == 0)
+      first = pos;
+    else
+      for (std::size_t i = 0; i < pos.size(); ++i)
+        BOOST_TEST(pos[i][0] == first[i][0] && pos[i][1] == first[i][1]);
+  }
+  return boost::report_errors();
+}
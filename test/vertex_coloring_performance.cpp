@@ -0,0 +1,110 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times sequential_vertex_coloring against speculative_vertex_coloring
+// and the Jones-Plassmann colorings on one and several threads, and
+// smallest_last_vertex_ordering and dsatur_vertex_coloring, on a random
+// graph, and prints the number of colors of each.
+//
+// usage: vertex_coloring_performance [vertices [average degree [threads]]]
+
+#include <boost/graph/parallel_vertex_coloring.hpp>
+#include <boost/graph/sequential_vertex_coloring.hpp>
+#include <boost/graph/smallest_last_ordering.hpp>
+#include <boost/graph/dsatur_vertex_coloring.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS> Graph;
+typedef graph_traits<Graph>::vertices_size_type size_type;
+
+// Whether no edge joins two vertices of the same color.
+bool proper(const Graph& g, const std::vector<size_type>& color)
+{
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    if (source(*ei, g) != target(*ei, g)
+        && color[source(*ei, g)] == color[target(*ei, g)])
+      return false;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 200000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 20;
+  std::size_t threads = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 4;
+
+  // both directions of each edge, so that the adjacent vertices are
+  // all the neighbors
+  minstd_rand gen(1);
+  uniform_int<std::size_t> dist(0, n - 1);
+  std::vector<std::pair<std::size_t, std::size_t> > edges;
+  for (std::size_t i = 0; i < n * degree / 2; ++i) {
+    std::size_t u = dist(gen), v = dist(gen);
+    edges.push_back(std::make_pair(u, v));
+    edges.push_back(std::make_pair(v, u));
+  }
+  Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+  std::cout << "random graph: " << n << " vertices, " << edges.size() / 2
+            << " edges" << std::endl;
+
+  std::vector<size_type> color(n);
+  iterator_property_map<size_type*, property_map<Graph, vertex_index_t>::type>
+    color_map(&color[0], get(vertex_index, g));
+
+  double start = now();
+  size_type colors = sequential_vertex_coloring(g, color_map);
+  std::cout << "  sequential_vertex_coloring: " << now() - start << " s, "
+            << colors << " colors" << std::endl;
+
+  start = now();
+  std::vector<size_type> order = smallest_last_vertex_ordering(g);
+  std::cout << "  smallest_last_vertex_ordering: " << now() - start << " s"
+            << std::endl;
+
+  start = now();
+  colors = dsatur_vertex_coloring(g, color_map);
+  std::cout << "  dsatur_vertex_coloring: " << now() - start << " s, "
+            << colors << " colors" << std::endl;
+  BOOST_TEST(proper(g, color));
+
+  std::size_t runs[] = { 1, threads };
+  for (int r = 0; r < 2; ++r) {
+    start = now();
+    colors = speculative_vertex_coloring(g, color_map, runs[r]);
+    std::cout << "  speculative_vertex_coloring, " << runs[r]
+              << " threads: " << now() - start << " s, " << colors
+              << " colors" << std::endl;
+    BOOST_TEST(proper(g, color));
+
+    start = now();
+    colors = jones_plassmann_vertex_coloring(g, color_map, runs[r]);
+    std::cout << "  jones_plassmann_vertex_coloring, " << runs[r]
+              << " threads: " << now() - start << " s, " << colors
+              << " colors" << std::endl;
+    BOOST_TEST(proper(g, color));
+
+    start = now();
+    colors = smallest_last_vertex_coloring(g, color_map, runs[r]);
+    std::cout << "  smallest_last_vertex_coloring, " << runs[r]
+              << " threads: " << now() - start << " s, " << colors
+              << " colors" << std::endl;
+    BOOST_TEST(proper(g, color));
+  }
+  return boost::report_errors();
+}
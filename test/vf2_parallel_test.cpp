@@ -0,0 +1,177 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Counts the mappings found by vf2_subgraph_mono, vf2_subgraph_iso and
+// vf2_graph_iso on small random labeled graphs, with the default and the
+// VF3 vertex orders and on one and several threads, against exhaustive
+// search.
+
+#include <boost/graph/vf2_sub_graph_iso.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, bidirectionalS,
+                       property<vertex_name_t, int> > Directed;
+typedef adjacency_list<vecS, vecS, undirectedS,
+                       property<vertex_name_t, int> > Undirected;
+
+enum problem { mono, sub_iso, iso };
+
+// Counts the mappings, and stops after limit of them if limit is not 0.
+struct count_callback {
+  count_callback(std::size_t& count, std::size_t limit = 0)
+    : m_count(count), m_limit(limit) {}
+
+  template <typename Map1To2, typename Map2To1>
+  bool operator()(Map1To2, Map2To1) const {
+    ++m_count;
+    return m_limit == 0 || m_count < m_limit;
+  }
+
+  std::size_t& m_count;
+  std::size_t m_limit;
+};
+
+// A simple graph: no self-loops or parallel edges.
+template <typename Graph>
+void random_graph(Graph& g, std::size_t n, std::size_t m, int labels,
+                  minstd_rand& gen)
+{
+  g = Graph(n);
+  uniform_int<std::size_t> vertex_dist(0, n - 1);
+  uniform_int<int> label_dist(0, labels - 1);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_vertex(gen, vertex_dist);
+  variate_generator<minstd_rand&, uniform_int<int> > random_label(gen, label_dist);
+  for (std::size_t v = 0; v < n; ++v)
+    put(vertex_name, g, v, random_label());
+  for (std::size_t i = 0; i < m; ++i) {
+    std::size_t u = random_vertex(), v = random_vertex();
+    if (u != v && !edge(u, v, g).second)
+      add_edge(u, v, g);
+  }
+}
+
+template <typename Graph>
+bool mapping_holds(const Graph& g1, const Graph& g2,
+                   const std::vector<std::size_t>& f, problem p)
+{
+  for (std::size_t u = 0; u < f.size(); ++u)
+    for (std::size_t v = 0; v < f.size(); ++v) {
+      bool e1 = edge(u, v, g1).second, e2 = edge(f[u], f[v], g2).second;
+      if (e1 && !e2)
+        return false;
+      if (p != mono && e2 && !e1)
+        return false;
+    }
+  return true;
+}
+
+template <typename Graph>
+std::size_t exhaustive(const Graph& g1, const Graph& g2,
+                       std::vector<std::size_t>& f, std::vector<bool>& used,
+                       problem p)
+{
+  if (f.size() == num_vertices(g1))
+    return mapping_holds(g1, g2, f, p) ? 1 : 0;
+  std::size_t count = 0;
+  for (std::size_t w = 0; w < num_vertices(g2); ++w)
+    if (!used[w] && get(vertex_name, g1, f.size()) == get(vertex_name, g2, w)) {
+      used[w] = true;
+      f.push_back(w);
+      count += exhaustive(g1, g2, f, used, p);
+      f.pop_back();
+      used[w] = false;
+    }
+  return count;
+}
+
+template <typename Graph>
+std::size_t count_vf2(const Graph& g1, const Graph& g2, problem p,
+                      bool vf3_order, std::size_t threads, std::size_t limit)
+{
+  typedef typename property_map<Graph, vertex_name_t>::const_type NameMap;
+  property_map_equivalent<NameMap, NameMap> vertex_comp =
+    make_property_map_equivalent(get(vertex_name, g1), get(vertex_name, g2));
+  std::vector<typename graph_traits<Graph>::vertex_descriptor> order =
+    vf3_order ? vertex_order_by_probability(g1, g2, get(vertex_index, g1),
+                                            vertex_comp)
+              : vertex_order_by_mult(g1);
+  BOOST_CHECK(order.size() == num_vertices(g1));
+
+  std::size_t count = 0;
+  count_callback callback(count, limit);
+  bool found = false;
+  if (p == mono)
+    found = vf2_subgraph_mono(g1, g2, callback, get(vertex_index, g1),
+                              get(vertex_index, g2), order,
+                              always_equivalent(), vertex_comp, threads);
+  else if (p == sub_iso)
+    found = vf2_subgraph_iso(g1, g2, callback, order,
+                             vertices_equivalent(vertex_comp)
+                             .number_of_threads(threads));
+  else
+    found = vf2_graph_iso(g1, g2, callback, get(vertex_index, g1),
+                          get(vertex_index, g2), order,
+                          always_equivalent(), vertex_comp, threads);
+  BOOST_CHECK(found == (count > 0));
+  return count;
+}
+
+template <typename Graph>
+void test_graphs(std::size_t n1, std::size_t m1, std::size_t n2,
+                 std::size_t m2, int labels, int seed)
+{
+  minstd_rand gen(seed);
+  Graph g1, g2;
+  random_graph(g1, n1, m1, labels, gen);
+  random_graph(g2, n2, m2, labels, gen);
+
+  for (int p = mono; p <= iso; ++p) {
+    Graph& small = p == iso ? g2 : g1;
+    std::vector<std::size_t> f;
+    std::vector<bool> used(n2, false);
+    const std::size_t expected = exhaustive(small, g2, f, used, problem(p));
+    for (int vf3_order = 0; vf3_order < 2; ++vf3_order)
+      for (std::size_t threads = 1; threads <= 4; threads += 3) {
+        BOOST_CHECK(count_vf2(small, g2, problem(p), vf3_order != 0,
+                              threads, 0) == expected);
+        // Stopping after the first mapping reports exactly one.
+        BOOST_CHECK(count_vf2(small, g2, problem(p), vf3_order != 0,
+                              threads, 1) == (expected > 0 ? 1u : 0u));
+      }
+  }
+}
+
+int test_main(int, char*[])
+{
+  for (int seed = 0; seed < 20; ++seed) {
+    test_graphs<Directed>(seed % 5, 2 * (seed % 5), 6, 8 + seed % 7,
+                          1 + seed % 2, seed);
+    test_graphs<Undirected>(1 + seed % 5, seed % 6, 7, 6 + seed % 9,
+                            1 + seed % 3, seed);
+  }
+
+  // A larger search that the threads have to share.
+  minstd_rand gen(1);
+  Undirected cycle(6), g;
+  for (std::size_t v = 0; v < 6; ++v)
+    add_edge(v, (v + 1) % 6, cycle);
+  random_graph(g, 40, 120, 1, gen);
+  std::size_t serial = count_vf2(cycle, g, mono, false, 1, 0);
+  BOOST_CHECK(serial > 0);
+  BOOST_CHECK(count_vf2(cycle, g, mono, true, 4, 0) == serial);
+  BOOST_CHECK(count_vf2(cycle, g, mono, false, 0, 0) == serial);
+  return 0;
+}
@@ -0,0 +1,107 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times maximum_weighted_matching and minimum_weight_perfect_matching on
+// random graphs whose edges are mostly local, like pairing nearby requests.
+// A second batch changes the weights of a few edges and is solved both from
+// scratch and warm started from the first batch's matching.
+//
+// usage: weighted_matching_performance [vertices [degree]]
+
+#include <boost/graph/maximum_weighted_matching.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "performance_timer.hpp"
+
+using namespace boost;
+
+struct Arc { long weight; };
+typedef compressed_sparse_row_graph<directedS, no_property, Arc> Csr;
+typedef graph_traits<Csr>::vertex_descriptor Vertex;
+
+// Each edge is listed once; the matching functions read the edge list and
+// do not need both directions.
+void make_graph(std::vector<std::pair<Vertex, Vertex> >& arcs,
+                std::vector<Arc>& weights, std::size_t n, std::size_t degree,
+                int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<std::size_t> near_dist(1, 40), far_dist(0, n - 1),
+    coin_dist(0, 9);
+  uniform_int<long> weight_dist(1, 1000);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    near(gen, near_dist), far(gen, far_dist), coin(gen, coin_dist);
+  variate_generator<minstd_rand&, uniform_int<long> > weight(gen, weight_dist);
+  arcs.clear();
+  weights.clear();
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < degree; ++k) {
+      std::size_t j = coin() == 0 ? far() : (i + near()) % n;
+      if (j == i)
+        continue;
+      arcs.push_back(std::make_pair(i, j));
+      Arc a = { weight() };
+      weights.push_back(a);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20000;
+  std::size_t degree = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 5;
+
+  std::vector<std::pair<Vertex, Vertex> > arcs;
+  std::vector<Arc> weights;
+  make_graph(arcs, weights, n, degree, 1);
+  Csr g(edges_are_unsorted_multi_pass, arcs.begin(), arcs.end(),
+        weights.begin(), n);
+  property_map<Csr, long Arc::*>::type w = get(&Arc::weight, g);
+  std::cout << n << " vertices, " << num_edges(g) << " edges\n";
+
+  std::vector<Vertex> mate(n), warm(n);
+  double start = now();
+  maximum_weighted_matching(g, &mate[0], get(vertex_index, g), w);
+  long best = matching_weight_sum(g, w, &mate[0]);
+  std::cout << "  maximum_weighted_matching: " << best << ", "
+            << now() - start << " s\n";
+
+  // The next batch: one edge in a hundred changes its weight.
+  minstd_rand gen(2);
+  uniform_int<long> weight_dist(1, 1000);
+  variate_generator<minstd_rand&, uniform_int<long> > weight(gen, weight_dist);
+  for (std::size_t i = 0; i < weights.size(); i += 100)
+    weights[i].weight = weight();
+  Csr g2(edges_are_unsorted_multi_pass, arcs.begin(), arcs.end(),
+         weights.begin(), n);
+  property_map<Csr, long Arc::*>::type w2 = get(&Arc::weight, g2);
+  start = now();
+  maximum_weighted_matching(g2, &warm[0], get(vertex_index, g2), w2);
+  best = matching_weight_sum(g2, w2, &warm[0]);
+  std::cout << "  next batch from scratch: " << best << ", "
+            << now() - start << " s\n";
+  start = now();
+  maximum_weighted_matching(g2, &warm[0], get(vertex_index, g2), w2, &mate[0]);
+  BOOST_TEST(matching_weight_sum(g2, w2, &warm[0]) == best);
+  std::cout << "  next batch warm started: " << matching_weight_sum(g2, w2, &warm[0])
+            << ", " << now() - start << " s\n";
+
+  start = now();
+  bool perfect = minimum_weight_perfect_matching(g2, &mate[0], get(vertex_index, g2), w2);
+  std::cout << "  minimum_weight_perfect_matching: "
+            << (perfect ? "perfect" : "not perfect") << ", "
+            << matching_weight_sum(g2, w2, &mate[0]) << ", "
+            << now() - start << " s\n";
+  return boost::report_errors();
+}
@@ -0,0 +1,208 @@
+//=======================================================================
+// Copyright 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Checks maximum_weighted_matching and minimum_weight_perfect_matching
+// against exhaustive search on small random graphs, with and without a
+// warm start, and against the cardinality matching on larger ones.
+
+#include <boost/graph/maximum_weighted_matching.hpp>
+#include <boost/graph/max_cardinality_matching.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/test/minimal.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, long> > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::vector<Vertex> Mates;
+
+const long no_edge = -1000000;
+
+void random_graph(Graph& g, std::size_t n, std::size_t m, long lo, long hi,
+                  minstd_rand& gen)
+{
+  g = Graph(n);
+  if (n < 2)
+    return;
+  uniform_int<std::size_t> vertex_dist(0, n - 1);
+  uniform_int<long> weight_dist(lo, hi);
+  variate_generator<minstd_rand&, uniform_int<std::size_t> >
+    random_vertex(gen, vertex_dist);
+  variate_generator<minstd_rand&, uniform_int<long> > random_weight(gen, weight_dist);
+  for (std::size_t i = 0; i < m; ++i) {
+    Vertex u = random_vertex(), v = random_vertex();
+    if (u != v && !edge(u, v, g).second)
+      add_edge(u, v, random_weight(), g);
+  }
+}
+
+// mate must be a matching of edges of g.
+bool valid_matching(const Graph& g, const Mates& mate)
+{
+  for (std::size_t v = 0; v < num_vertices(g); ++v) {
+    Vertex u = mate[v];
+    if (u == graph_traits<Graph>::null_vertex())
+      continue;
+    if (u == v || mate[u] != v || !edge(v, u, g).second)
+      return false;
+  }
+  return true;
+}
+
+// The best matching of the vertices in each subset, by dynamic programming
+// over the lowest vertex.  With perfect set only perfect matchings count.
+long exhaustive(const Graph& g, bool perfect)
+{
+  const std::size_t n = num_vertices(g);
+  std::vector<std::vector<long> > w(n, std::vector<long>(n, no_edge));
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    Vertex u = source(*ei, g), v = target(*ei, g);
+    long x = perfect ? -get(edge_weight, g, *ei) : get(edge_weight, g, *ei);
+    w[u][v] = w[v][u] = (std::max)(w[u][v], x);
+  }
+  std::vector<long> best(std::size_t(1) << n, no_edge);
+  best[0] = 0;
+  for (std::size_t mask = 1; mask < best.size(); ++mask) {
+    std::size_t i = 0;
+    while (!(mask & (std::size_t(1) << i)))
+      ++i;
+    std::size_t rest = mask & ~(std::size_t(1) << i);
+    if (!perfect)
+      best[mask] = best[rest];
+    for (std::size_t j = i + 1; j < n; ++j)
+      if ((rest & (std::size_t(1) << j)) && w[i][j] != no_edge
+          && best[rest & ~(std::size_t(1) << j)] != no_edge)
+        best[mask] = (std::max)(best[mask],
+                                w[i][j] + best[rest & ~(std::size_t(1) << j)]);
+  }
+  return perfect && best.back() != no_edge ? -best.back() : best.back();
+}
+
+void test_small(std::size_t n, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  Graph g;
+  random_graph(g, n, m, -5, 20, gen);
+  Mates mate(n), warm(n), initial(n);
+
+  maximum_weighted_matching(g, &mate[0]);
+  BOOST_CHECK(valid_matching(g, mate));
+  const long expected = exhaustive(g, false);
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &mate[0]) == expected);
+
+  // Warm starts from a maximal matching and from the optimum itself.
+  greedy_matching<Graph, Vertex*>::find_matching(g, &initial[0]);
+  maximum_weighted_matching(g, &warm[0], get(vertex_index, g),
+                            get(edge_weight, g), &initial[0]);
+  BOOST_CHECK(valid_matching(g, warm));
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &warm[0]) == expected);
+  maximum_weighted_matching(g, &warm[0], get(vertex_index, g),
+                            get(edge_weight, g), &warm[0]);
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &warm[0]) == expected);
+
+  const long cheapest = exhaustive(g, true);
+  const bool found = minimum_weight_perfect_matching(g, &mate[0]);
+  BOOST_CHECK(valid_matching(g, mate));
+  BOOST_CHECK(found == (cheapest != no_edge));
+  if (found)
+    BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &mate[0]) == cheapest);
+  BOOST_CHECK(minimum_weight_perfect_matching(g, &warm[0], get(vertex_index, g),
+                                              get(edge_weight, g), &initial[0])
+              == found);
+  if (found)
+    BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &warm[0]) == cheapest);
+}
+
+// With unit weights the maximum weight is the maximum cardinality; on
+// complete graphs with an even number of vertices the perfect matching
+// always exists.
+void test_large(std::size_t n, std::size_t m, int seed)
+{
+  minstd_rand gen(seed);
+  Graph g;
+  random_graph(g, n, m, 1, 1, gen);
+  Mates mate(n), expected(n), warm(n);
+  edmonds_maximum_cardinality_matching(g, &expected[0]);
+  maximum_weighted_matching(g, &mate[0]);
+  BOOST_CHECK(valid_matching(g, mate));
+  BOOST_CHECK(matching_size(g, &mate[0]) == matching_size(g, &expected[0]));
+
+  random_graph(g, n, m, 1, 1000, gen);
+  maximum_weighted_matching(g, &mate[0]);
+  const long best = matching_weight_sum(g, get(edge_weight, g), &mate[0]);
+  // Drop every third pair of the optimum and start from what is left.
+  for (std::size_t v = 0, k = 0; v < n; ++v)
+    if (mate[v] != graph_traits<Graph>::null_vertex() && v < mate[v] && ++k % 3 == 0) {
+      mate[mate[v]] = graph_traits<Graph>::null_vertex();
+      mate[v] = graph_traits<Graph>::null_vertex();
+    }
+  maximum_weighted_matching(g, &warm[0], get(vertex_index, g),
+                            get(edge_weight, g), &mate[0]);
+  BOOST_CHECK(valid_matching(g, warm));
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &warm[0]) == best);
+}
+
+void test_complete(std::size_t n, int seed)
+{
+  minstd_rand gen(seed);
+  uniform_int<long> weight_dist(1, 100);
+  variate_generator<minstd_rand&, uniform_int<long> > random_weight(gen, weight_dist);
+  Graph g(n);
+  for (std::size_t u = 0; u < n; ++u)
+    for (std::size_t v = u + 1; v < n; ++v)
+      add_edge(u, v, random_weight(), g);
+  Mates mate(n);
+  BOOST_CHECK(minimum_weight_perfect_matching(g, &mate[0]));
+  BOOST_CHECK(valid_matching(g, mate));
+  BOOST_CHECK(matching_size(g, &mate[0]) == n / 2);
+  if (n <= 14)
+    BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &mate[0])
+                == exhaustive(g, true));
+}
+
+// Floating point weights that are exact in binary.
+void test_floating()
+{
+  typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                         property<edge_weight_t, double> > FloatGraph;
+  FloatGraph g(6);
+  add_edge(0, 1, 2.5, g);
+  add_edge(1, 2, 3.25, g);
+  add_edge(2, 3, 2.5, g);
+  add_edge(3, 4, 1.75, g);
+  add_edge(4, 5, 2.0, g);
+  add_edge(5, 0, 0.5, g);
+  add_edge(0, 3, 4.0, g);
+  std::vector<graph_traits<FloatGraph>::vertex_descriptor> mate(6);
+  maximum_weighted_matching(g, &mate[0]);
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &mate[0]) == 9.25);
+  BOOST_CHECK(minimum_weight_perfect_matching(g, &mate[0]));
+  BOOST_CHECK(matching_weight_sum(g, get(edge_weight, g), &mate[0]) == 5.5);
+}
+
+int test_main(int, char*[])
+{
+  test_small(0, 0, 1);
+  test_small(1, 0, 1);
+  test_small(2, 1, 1);
+  for (int seed = 0; seed < 300; ++seed)
+    test_small(2 + seed % 11, 3 + seed % 37, seed);
+  for (int seed = 0; seed < 20; ++seed)
+    test_complete(2 + 2 * (seed % 7), seed);
+  test_complete(200, 1);
+  test_floating();
+  test_large(2000, 3000, 1);
+  test_large(5000, 20000, 2);
+  return 0;
+}